@@ -310,8 +310,8 @@ _aff3ct() {
 		--itl-type)
 			local params
 			case "${simutype}" in
-				BFER)      params="LTE CCSDS RANDOM RAND_COL ROW_COL COL_ROW GOLDEN USER NO" ;;
-				BFERI)     params="LTE CCSDS RANDOM RAND_COL ROW_COL COL_ROW GOLDEN USER NO" ;;
+				BFER)      params="LTE CCSDS RANDOM FEISTEL RAND_COL ROW_COL COL_ROW GOLDEN USER NO" ;;
+				BFERI)     params="LTE CCSDS RANDOM FEISTEL RAND_COL ROW_COL COL_ROW GOLDEN USER NO" ;;
 			esac
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
@@ -8,6 +8,7 @@
 
 #include "Tools/Algo/Noise/Standard/Noise_std.hpp"
 #include "Tools/Algo/Noise/Fast/Noise_fast.hpp"
+#include "Tools/Algo/Noise/Philox/Noise_philox.hpp"
 #ifdef CHANNEL_MKL
 #include "Tools/Algo/Noise/MKL/Noise_MKL.hpp"
 #endif
@@ -58,7 +59,7 @@ void Channel::parameters
 		 "type of the channel to use in the simulation.",
 		 "NO, USER, AWGN, RAYLEIGH, RAYLEIGH_USER"};
 
-	std::string implem_avail = "STD, FAST";
+	std::string implem_avail = "STD, FAST, PHILOX";
 #ifdef CHANNEL_GSL
 	implem_avail += ", GSL";
 #endif
@@ -98,7 +99,8 @@ void Channel::parameters
 
 	opt_args[{p+"-gain-occur"}] =
 		{"strictly_positive_int",
-		 "the number of times a gain is used on consecutive symbols (used with \"--chn-type RAYLEIGH_USER\")."};
+		 "the number of times a gain is used on consecutive symbols (used with \"--chn-type RAYLEIGH\" and"
+		 " \"--chn-type RAYLEIGH_USER\")."};
 }
 
 void Channel::parameters
@@ -136,7 +138,7 @@ void Channel::parameters
 	if (this->type == "USER" || this->type == "RAYLEIGH_USER")
 		headers[p].push_back(std::make_pair("Path", this->path));
 
-	if (this->type == "RAYLEIGH_USER")
+	if (this->type == "RAYLEIGH" || this->type == "RAYLEIGH_USER")
 		headers[p].push_back(std::make_pair("Gain occurrences", std::to_string(this->gain_occur)));
 
 	if (this->type.find("RAYLEIGH") != std::string::npos)
@@ -154,20 +156,24 @@ module::Channel<R>* Channel::parameters
 ::build() const
 {
 	tools::Noise<R>* n = nullptr;
-	     if (implem == "STD" ) n = new tools::Noise_std <R>(seed);
-	else if (implem == "FAST") n = new tools::Noise_fast<R>(seed);
+	     if (implem == "STD"   ) n = new tools::Noise_std   <R>(seed);
+	else if (implem == "FAST"  ) n = new tools::Noise_fast  <R>(seed);
+	else if (implem == "PHILOX") n = new tools::Noise_philox<R>(seed, 1); // the stream 0 is used by the sources
 #ifdef CHANNEL_MKL
-	else if (implem == "MKL" ) n = new tools::Noise_MKL <R>(seed);
+	else if (implem == "MKL"   ) n = new tools::Noise_MKL   <R>(seed);
 #endif
 #ifdef CHANNEL_GSL
-	else if (implem == "GSL" ) n = new tools::Noise_GSL <R>(seed);
+	else if (implem == "GSL"   ) n = new tools::Noise_GSL   <R>(seed);
 #endif
 	else
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
 
+	// with the FRAME block fading policy the same gain is used on all the symbols of a frame
+	const auto occur = (block_fading == "FRAME") ? (complex ? N / 2 : N) : gain_occur;
+
 	     if (type == "AWGN"         ) return new module::Channel_AWGN_LLR         <R>(N,                            n, add_users, sigma, n_frames);
-	else if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,                   n, add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,                   n, add_users, sigma, n_frames, occur);
 	else if (type == "RAYLEIGH_USER") return new module::Channel_Rayleigh_LLR_user<R>(N, complex, path, gain_occur, n, add_users, sigma, n_frames);
 	else
 	{
@@ -101,6 +101,15 @@ void Codec_turbo_DB::parameters
 
 	enc->store(vals);
 
+	// the Turbo DB encoder and decoders read the lookup tables of the interleaver, the keyed Feistel interleaver does
+	// not build them
+	if (this->enc->itl->core->type == "FEISTEL")
+	{
+		std::stringstream message;
+		message << "The FEISTEL interleaver is not supported by the Turbo DB codec, it has no lookup tables.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (this->pct)
 	{
 		this->pct->K        = this->enc->K;
@@ -119,6 +128,15 @@ void Codec_turbo_DB::parameters
 
 	dec->store(vals);
 
+	// the double binary Flip aNd Check reads the frames in the natural layout, the inter frame SIMD decoder interleaves
+	// them
+	if (this->dec->fnc->enable && this->dec->sub->simd_strategy == "INTER")
+	{
+		std::stringstream message;
+		message << "The Flip aNd Check is not supported by the Turbo DB decoder with the 'INTER' SIMD strategy.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	auto pdes = dec->sub->get_prefix();
 
 	if (!this->enc->sub->standard.empty() && !exist(vals, {pdes+"-implem"}))
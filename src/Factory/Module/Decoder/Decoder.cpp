@@ -1,5 +1,6 @@
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_naive.hpp"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp"
 #include "Module/Decoder/Generic/Chase/Decoder_chase_std.hpp"
 
 #include "Decoder.hpp"
@@ -52,7 +53,7 @@ void Decoder::parameters
 	opt_args[{p+"-implem"}] =
 		{"string",
 		 "select the implementation of the algorithm to decode.",
-		 "STD, NAIVE"};
+		 "STD, NAIVE, FAST"};
 
 	opt_args[{p+"-hamming"}] =
 		{"",
@@ -61,6 +62,10 @@ void Decoder::parameters
 	opt_args[{p+"-flips"}] =
 		{"strictly_positive_int",
 		 "set the maximum number of flips in the CHASE decoder."};
+
+	opt_args[{p+"-ml-threads"}] =
+		{"strictly_positive_int",
+		 "set the number of threads used to explore the codewords of a frame in the FAST ML decoder."};
 }
 
 void Decoder::parameters
@@ -72,12 +77,21 @@ void Decoder::parameters
 	if(exist(vals, {p+"-cw-size",   "N"})) this->N_cw       = std::stoi(vals.at({p+"-cw-size",   "N"}));
 	if(exist(vals, {p+"-fra",       "F"})) this->n_frames   = std::stoi(vals.at({p+"-fra",       "F"}));
 	if(exist(vals, {p+"-flips"         })) this->flips      = std::stoi(vals.at({p+"-flips"         }));
+	if(exist(vals, {p+"-ml-threads"    })) this->ml_threads = std::stoi(vals.at({p+"-ml-threads"    }));
 	if(exist(vals, {p+"-type",      "D"})) this->type       =           vals.at({p+"-type",      "D"});
 	if(exist(vals, {p+"-implem"        })) this->implem     =           vals.at({p+"-implem"        });
 	if(exist(vals, {p+"-no-sys"        })) this->systematic = false;
 	if(exist(vals, {p+"-hamming"       })) this->hamming    = true;
 
 	this->R = (float)this->K / (float)this->N_cw;
+
+	// the FAST ML decoder stores an information sequence in a 64-bit word and explores the 2^K sequences
+	if (this->type == "ML" && this->implem == "FAST" && this->K >= 64)
+	{
+		std::stringstream message;
+		message << "The FAST ML decoder requires 'K' < 64 ('K' = " << this->K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 void Decoder::parameters
@@ -96,6 +110,8 @@ void Decoder::parameters
 		headers[p].push_back(std::make_pair("Distance", this->hamming ? "Hamming" : "Euclidean"));
 	if(this->type == "CHASE")
 		headers[p].push_back(std::make_pair("Max flips", std::to_string(this->flips)));
+	if(this->type == "ML" && this->implem == "FAST")
+		headers[p].push_back(std::make_pair("ML threads", std::to_string(this->ml_threads)));
 }
 
 template <typename B, typename Q>
@@ -108,6 +124,7 @@ module::Decoder_SIHO<B,Q>* Decoder::parameters
 		{
 			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
 			if (this->implem == "NAIVE") return new module::Decoder_ML_naive<B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
+			if (this->implem == "FAST" ) return new module::Decoder_ML_fast <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->ml_threads, this->n_frames);
 		}
 		else if (this->type == "CHASE")
 		{
@@ -6,6 +6,11 @@
 #include "Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_offset_normalize_min_sum.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/AMS/Decoder_LDPC_BP_flooding_approximate_min_star.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_LSPA_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/AMS/Decoder_LDPC_BP_flooding_AMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp"
@@ -149,6 +154,11 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 ::build_siso(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos, 
              module::Encoder<B> *encoder) const
 {
+	// the Gallager A decoders (sequential and inter-frame SIMD) are hard decision decoders, they are only built as
+	// SIHO decoders (see the 'build' method)
+	if (this->implem == "GALA")
+		throw tools::cannot_allocate(__FILE__, __LINE__, __func__, "The Gallager A decoders have no soft output.");
+
 	if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy.empty())
 	{
 		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_flooding_ONMS     <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
@@ -163,6 +173,20 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 				return new module::Decoder_LDPC_BP_flooding_AMS<B,Q,tools::min_star<Q>>            (this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
 	}
+	else if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy == "INTER")
+	{
+		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_flooding_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		else if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_flooding_SPA_inter <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		else if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_flooding_LSPA_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		else if (this->implem == "AMS" ) {
+			if (this->min == "MIN")
+				return new module::Decoder_LDPC_BP_flooding_AMS_inter<B,Q,tools::min_i<Q>>             (this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			else if (this->min == "MINL")
+				return new module::Decoder_LDPC_BP_flooding_AMS_inter<B,Q,tools::min_star_linear2_i<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			else if (this->min == "MINS")
+				return new module::Decoder_LDPC_BP_flooding_AMS_inter<B,Q,tools::min_star_i<Q>>        (this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
 	else if (this->type == "BP_LAYERED" && this->simd_strategy.empty())
 	{
 		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS      <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
@@ -192,6 +216,10 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 		{
 			if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_GALA<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
+		else if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_GALA_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
 
 		return build_siso<B,Q>(H, info_bits_pos);
 	}
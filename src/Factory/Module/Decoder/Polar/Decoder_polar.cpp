@@ -5,14 +5,17 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys_inter.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys_inter.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
 
@@ -100,6 +103,10 @@ void Decoder_polar::parameters
 		{"",
 		 "enable the partial adaptive mode for the ASCL decoder (by default full adaptive is selected)."};
 
+	opt_args[{p+"-conv-stop"}] =
+		{"",
+		 "stop the SCAN decoder when the hard decisions do not change between two iterations (FAST implem. only)."};
+
 	opt_args[{p+"-no-sys"}] =
 		{"",
 		 "does not suppose a systematic encoding."};
@@ -117,6 +124,7 @@ void Decoder_polar::parameters
 	if(exist(vals, {p+"-simd"            })) this->simd_strategy =           vals.at({p+"-simd"       });
 	if(exist(vals, {p+"-polar-nodes"     })) this->polar_nodes   =           vals.at({p+"-polar-nodes"});
 	if(exist(vals, {p+"-partial-adaptive"})) this->full_adaptive = false;
+	if(exist(vals, {p+"-conv-stop"       })) this->conv_stop     = true;
 
 	// force 1 iteration max if not SCAN (and polar code)
 	if (this->type != "SCAN") this->n_ite = 1;
@@ -135,7 +143,11 @@ void Decoder_polar::parameters
 			headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
 
 		if (this->type == "SCAN")
+		{
 			headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
+			if (this->implem == "FAST")
+				headers[p].push_back(std::make_pair("Convergence stop", this->conv_stop ? "on" : "off"));
+		}
 
 		if (this->type == "SCL" || this->type == "SCL_MEM")
 			headers[p].push_back(std::make_pair("Num. of lists (L)", std::to_string(this->L)));
@@ -151,18 +163,25 @@ void Decoder_polar::parameters
 		     this->type == "SCL"     ||
 		     this->type == "ASCL"    ||
 		     this->type == "SCL_MEM" ||
-		     this->type == "ASCL_MEM") && this->implem == "FAST")
+		     this->type == "ASCL_MEM" ||
+		     this->type == "SCAN") && this->implem == "FAST")
 			headers[p].push_back(std::make_pair("Polar node types", this->polar_nodes));
 	}
 }
 
 template <typename B, typename Q>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
-::build_siso(const std::vector<bool> &frozen_bits, module::Encoder<B> *encoder) const
+::build_siso(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
 {
 	if (this->type == "SCAN" && this->systematic)
 	{
 		if (this->implem == "NAIVE") return new module::Decoder_polar_SCAN_naive_sys<B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		if (this->implem == "FAST")
+		{
+			     if (this->simd_strategy == "INTRA") return _build_scan_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
+			else if (this->simd_strategy == "INTER") return _build_scan_fast<B,Q,tools::API_polar_dynamic_inter<B,Q>>(frozen_bits, crc, encoder);
+			else if (this->simd_strategy.empty()   ) return _build_scan_fast<B,Q,tools::API_polar_dynamic_seq  <B,Q>>(frozen_bits, crc, encoder);
+		}
 	}
 	else if (this->type == "SCAN" && !this->systematic)
 	{
@@ -244,6 +263,40 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scl_fast_inter(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
+{
+	int idx_r0, idx_r1;
+	auto polar_patterns = tools::nodes_parser(this->polar_nodes, idx_r0, idx_r1);
+
+	if (this->implem == "FAST" && this->systematic && this->type == "SCL")
+	{
+		if (crc != nullptr && crc->get_size() > 0)
+			return new module::Decoder_polar_SCL_fast_CA_sys_inter<B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, polar_patterns, idx_r0, idx_r1, *crc, this->n_frames);
+		else
+			return new module::Decoder_polar_SCL_fast_sys_inter   <B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, polar_patterns, idx_r0, idx_r1,       this->n_frames);
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename Q, class API_polar>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scan_fast(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
+{
+	int idx_r0, idx_r1;
+	auto polar_patterns = tools::nodes_parser(this->polar_nodes, idx_r0, idx_r1);
+
+	if (this->type == "SCAN" && this->implem == "FAST" && this->systematic)
+	{
+		auto crc_scan = (crc != nullptr && crc->get_size() > 0) ? crc : nullptr;
+		return new module::Decoder_polar_SCAN_fast_sys<B, Q, API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, polar_patterns, idx_r0, idx_r1, crc_scan, this->conv_stop, this->n_frames);
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
@@ -254,6 +307,13 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	}
 	catch (tools::cannot_allocate const&)
 	{
+		if (this->type == "SCAN" && this->implem == "FAST")
+		{
+			     if (this->simd_strategy == "INTRA") return _build_scan_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
+			else if (this->simd_strategy == "INTER") return _build_scan_fast<B,Q,tools::API_polar_dynamic_inter<B,Q>>(frozen_bits, crc, encoder);
+			else if (this->simd_strategy.empty()   ) return _build_scan_fast<B,Q,tools::API_polar_dynamic_seq  <B,Q>>(frozen_bits, crc, encoder);
+		}
+
 		if (this->type.find("SCL") != std::string::npos && this->implem == "FAST")
 		{
 			if (this->simd_strategy == "INTRA")
@@ -271,6 +331,10 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 					return _build_scl_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
 				}
 			}
+			else if (this->simd_strategy == "INTER")
+			{
+				return _build_scl_fast_inter<B,Q,tools::API_polar_dynamic_inter<B,Q>>(frozen_bits, crc, encoder);
+			}
 			else if (this->simd_strategy.empty())
 			{
 				return _build_scl_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
@@ -352,10 +416,10 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 
 template <typename B, typename Q>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_polar
-::build_siso(const parameters& params, const std::vector<bool> &frozen_bits,
+::build_siso(const parameters& params, const std::vector<bool> &frozen_bits, module::CRC<B> *crc,
              module::Encoder<B> *encoder)
 {
-	return params.template build_siso<B,Q>(frozen_bits, encoder);
+	return params.template build_siso<B,Q>(frozen_bits, crc, encoder);
 }
 
 template <typename B, typename Q>
@@ -369,17 +433,17 @@ module::Decoder_SIHO<B,Q>* Decoder_polar
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
-template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_polar::parameters::build_siso<B_8 ,Q_8 >(const std::vector<bool>&, module::Encoder<B_8 >*) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_polar::parameters::build_siso<B_16,Q_16>(const std::vector<bool>&, module::Encoder<B_16>*) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_polar::parameters::build_siso<B_32,Q_32>(const std::vector<bool>&, module::Encoder<B_32>*) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_polar::parameters::build_siso<B_64,Q_64>(const std::vector<bool>&, module::Encoder<B_64>*) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_polar::build_siso<B_8 ,Q_8 >(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::Encoder<B_8 >*);
-template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_polar::build_siso<B_16,Q_16>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::Encoder<B_16>*);
-template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_polar::build_siso<B_32,Q_32>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::Encoder<B_32>*);
-template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_polar::build_siso<B_64,Q_64>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::Encoder<B_64>*);
+template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_polar::parameters::build_siso<B_8 ,Q_8 >(const std::vector<bool>&, module::CRC<B_8 >*, module::Encoder<B_8 >*) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_polar::parameters::build_siso<B_16,Q_16>(const std::vector<bool>&, module::CRC<B_16>*, module::Encoder<B_16>*) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_polar::parameters::build_siso<B_32,Q_32>(const std::vector<bool>&, module::CRC<B_32>*, module::Encoder<B_32>*) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_polar::parameters::build_siso<B_64,Q_64>(const std::vector<bool>&, module::CRC<B_64>*, module::Encoder<B_64>*) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_polar::build_siso<B_8 ,Q_8 >(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::CRC<B_8 >*, module::Encoder<B_8 >*);
+template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_polar::build_siso<B_16,Q_16>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::CRC<B_16>*, module::Encoder<B_16>*);
+template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_polar::build_siso<B_32,Q_32>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::CRC<B_32>*, module::Encoder<B_32>*);
+template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_polar::build_siso<B_64,Q_64>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::CRC<B_64>*, module::Encoder<B_64>*);
 #else
-template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_polar::parameters::build_siso<B,Q>(const std::vector<bool>&, module::Encoder<B>*) const;
-template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_polar::build_siso<B,Q>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::Encoder<B>*);
+template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_polar::parameters::build_siso<B,Q>(const std::vector<bool>&, module::CRC<B>*, module::Encoder<B>*) const;
+template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_polar::build_siso<B,Q>(const aff3ct::factory::Decoder_polar::parameters&, const std::vector<bool>&, module::CRC<B>*, module::Encoder<B>*);
 #endif
 
 #ifdef MULTI_PREC
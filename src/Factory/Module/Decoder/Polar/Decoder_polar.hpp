@@ -28,6 +28,7 @@ struct Decoder_polar : public Decoder
 		std::string simd_strategy = "";
 		std::string polar_nodes   = "{R0,R0L,R1,REP,REPL,SPC}";
 		bool        full_adaptive = true;
+		bool        conv_stop     = false;
 		int         n_ite         = 1;
 		int         L             = 8;
 
@@ -43,7 +44,7 @@ struct Decoder_polar : public Decoder
 
 		// builder
 		template <typename B = int, typename Q = float>
-		module::Decoder_SISO_SIHO<B,Q>* build_siso(const std::vector<bool> &frozen_bits,
+		module::Decoder_SISO_SIHO<B,Q>* build_siso(const std::vector<bool> &frozen_bits, module::CRC<B> *crc = nullptr,
 		                                           module::Encoder<B> *encoder = nullptr) const;
 
 		template <typename B = int, typename Q = float>
@@ -64,6 +65,16 @@ struct Decoder_polar : public Decoder
 		                                           module::CRC<B> *crc = nullptr,
 		                                           module::Encoder<B> *encoder = nullptr) const;
 
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SIHO<B,Q>* _build_scl_fast_inter(const std::vector<bool> &frozen_bits,
+		                                                 module::CRC<B> *crc = nullptr,
+		                                                 module::Encoder<B> *encoder = nullptr) const;
+
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SISO_SIHO<B,Q>* _build_scan_fast(const std::vector<bool> &frozen_bits,
+		                                                 module::CRC<B> *crc = nullptr,
+		                                                 module::Encoder<B> *encoder = nullptr) const;
+
 		template <typename B = int, typename Q = float, class API_polar>
 		module::Decoder_SIHO<B,Q>* _build_gen(module::CRC<B> *crc = nullptr,
 		                                      module::Encoder<B> *encoder = nullptr) const;
@@ -74,7 +85,7 @@ struct Decoder_polar : public Decoder
 
 	template <typename B = int, typename Q = float>
 	static module::Decoder_SISO_SIHO<B,Q>* build_siso(const parameters& params, const std::vector<bool> &frozen_bits,
-	                                                  module::Encoder<B> *encoder = nullptr);
+	                                                  module::CRC<B> *crc = nullptr, module::Encoder<B> *encoder = nullptr);
 
 	template <typename B = int, typename Q = float>
 	static module::Decoder_SIHO<B,Q>* build(const parameters& params, const std::vector<bool> &frozen_bits,
@@ -13,6 +13,7 @@
 
 #include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_std.hpp"
 #include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_fast.hpp"
+#include "Module/Decoder/RSC/BCJR/Intra/Decoder_RSC_BCJR_intra_radix4.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_SSE.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_AVX.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x4_AVX.hpp"
@@ -20,6 +21,9 @@
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_std.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_very_fast.hpp"
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_radix4.hpp"
+
+#include "Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window.hpp"
 
 #include "Decoder_RSC.hpp"
 
@@ -58,13 +62,18 @@ void Decoder_RSC::parameters
 	req_args.erase({p+"-cw-size", "N"});
 
 	opt_args[{p+"-type", "D"}][2] += ", BCJR";
-	opt_args[{p+"-implem"   }][2] += ", GENERIC, FAST, VERY_FAST";
+	opt_args[{p+"-implem"   }][2] += ", GENERIC, FAST, VERY_FAST, RADIX4, WINDOW";
 
 	opt_args[{p+"-simd"}] =
 		{"string",
 		 "the SIMD strategy you want to use.",
 		 "INTRA, INTER"};
 
+	opt_args[{p+"-win-size"}] =
+		{"strictly_positive_int",
+		 "number of trellis sections in a window (WINDOW implementation, the windows are decoded in parallel on the "
+		 "SIMD lanes)."};
+
 	opt_args[{p+"-max"}] =
 		{"string",
 		 "the MAX implementation for the nodes.",
@@ -91,10 +100,11 @@ void Decoder_RSC::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-simd"   })) this->simd_strategy = vals.at({p+"-simd"});
-	if(exist(vals, {p+"-max"    })) this->max           = vals.at({p+"-max" });
-	if(exist(vals, {p+"-std"    })) this->standard      = vals.at({p+"-std" });
-	if(exist(vals, {p+"-no-buff"})) this->buffered      = false;
+	if(exist(vals, {p+"-simd"    })) this->simd_strategy = vals.at({p+"-simd"});
+	if(exist(vals, {p+"-max"     })) this->max           = vals.at({p+"-max" });
+	if(exist(vals, {p+"-std"     })) this->standard      = vals.at({p+"-std" });
+	if(exist(vals, {p+"-win-size"})) this->win_size      = std::stoi(vals.at({p+"-win-size"}));
+	if(exist(vals, {p+"-no-buff" })) this->buffered      = false;
 
 	if (this->standard == "LTE" && !exist(vals, {p+"-poly"}))
 		this->poly = {013, 015};
@@ -113,7 +123,7 @@ void Decoder_RSC::parameters
 #endif
 	}
 
-	if (this->poly[0] != 013 || this->poly[1] != 015)
+	if ((this->poly[0] != 013 || this->poly[1] != 015) && this->implem != "WINDOW")
 		this->implem = "GENERIC";
 
 	this->tail_length = (int)(2 * std::floor(std::log2((float)std::max(this->poly[0], this->poly[1]))));
@@ -145,6 +155,9 @@ void Decoder_RSC::parameters
 		if (!this->simd_strategy.empty())
 			headers[p].push_back(std::make_pair(std::string("SIMD strategy"), this->simd_strategy));
 
+		if (this->implem == "WINDOW")
+			headers[p].push_back(std::make_pair(std::string("Window size"), std::to_string(this->win_size)));
+
 		headers[p].push_back(std::make_pair(std::string("Max type"), this->max));
 	}
 }
@@ -178,11 +191,14 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 		     if (this->implem == "STD"      ) return new module::Decoder_RSC_BCJR_inter_std      <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		else if (this->implem == "FAST"     ) return new module::Decoder_RSC_BCJR_inter_fast     <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		else if (this->implem == "VERY_FAST") return new module::Decoder_RSC_BCJR_inter_very_fast<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		else if (this->implem == "RADIX4"   ) return new module::Decoder_RSC_BCJR_inter_radix4   <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 	}
 
 	if (this->type == "BCJR" && this->simd_strategy == "INTRA")
 	{
-		if (this->implem == "STD")
+		if (this->implem == "WINDOW")
+			return new module::Decoder_RSC_BCJR_window<B,Q,MAX>(this->K, trellis, this->win_size, this->buffered, this->n_frames);
+		else if (this->implem == "STD")
 		{
 			switch (mipp::nElReg<Q>())
 			{
@@ -212,6 +228,15 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 			}
 #endif
 		}
+		else if (this->implem == "RADIX4")
+		{
+			switch (mipp::nElReg<Q>())
+			{
+				case 8: return new module::Decoder_RSC_BCJR_intra_radix4<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+				default:
+					break;
+			}
+		}
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
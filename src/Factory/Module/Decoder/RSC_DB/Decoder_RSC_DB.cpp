@@ -3,6 +3,7 @@
 #include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_generic.hpp"
 #include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS1.hpp"
 #include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS2.hpp"
+#include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hpp"
 
 #include "Decoder_RSC_DB.hpp"
 
@@ -48,6 +49,11 @@ void Decoder_RSC_DB::parameters
 		 "the MAX implementation for the nodes.",
 		 "MAX, MAXL, MAXS"};
 
+	opt_args[{p+"-simd"}] =
+		{"string",
+		 "the SIMD strategy you want to use.",
+		 "INTER"};
+
 	opt_args[{p+"-no-buff"}] =
 		{"",
 		 "does not suppose a buffered encoding."};
@@ -60,8 +66,9 @@ void Decoder_RSC_DB::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-max"    })) this->max      = vals.at({p+"-max"});
-	if(exist(vals, {p+"-no-buff"})) this->buffered = false;
+	if(exist(vals, {p+"-max"    })) this->max           = vals.at({p+"-max"});
+	if(exist(vals, {p+"-simd"   })) this->simd_strategy = vals.at({p+"-simd"});
+	if(exist(vals, {p+"-no-buff"})) this->buffered      = false;
 
 	this->N_cw = 2 * this->K;
 	this->R    = (float)this->K / (float)this->N_cw;
@@ -81,6 +88,9 @@ void Decoder_RSC_DB::parameters
 
 		if (full) headers[p].push_back(std::make_pair("Buffered", (this->buffered ? "on" : "off")));
 
+		if (!this->simd_strategy.empty())
+			headers[p].push_back(std::make_pair(std::string("SIMD strategy"), this->simd_strategy));
+
 		headers[p].push_back(std::make_pair(std::string("Max type"), this->max));
 	}
 }
@@ -99,13 +109,36 @@ module::Decoder_RSC_DB_BCJR<B,Q>* Decoder_RSC_DB::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, tools::proto_max_i<Q> MAX>
+module::Decoder_RSC_DB_BCJR<B,Q>* Decoder_RSC_DB::parameters
+::_build_siso_simd(const std::vector<std::vector<int>> &trellis, module::Encoder<B> *encoder) const
+{
+	if (this->type == "BCJR" && this->simd_strategy == "INTER")
+	{
+		// the inter-frame implementation is generic: it works for the GENERIC, DVB-RCS1 and DVB-RCS2 trellis
+		if (this->implem == "GENERIC" || this->implem == "DVB-RCS1" || this->implem == "DVB-RCS2")
+			return new module::Decoder_RSC_DB_BCJR_inter<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B, typename Q>
 module::Decoder_RSC_DB_BCJR<B,Q>* Decoder_RSC_DB::parameters
 ::build_siso(const std::vector<std::vector<int>> &trellis, module::Encoder<B> *encoder) const
 {
-	     if (this->max == "MAX" ) return _build_siso<B,Q,tools::max       <Q>>(trellis, encoder);
-	else if (this->max == "MAXS") return _build_siso<B,Q,tools::max_star  <Q>>(trellis, encoder);
-	else if (this->max == "MAXL") return _build_siso<B,Q,tools::max_linear<Q>>(trellis, encoder);
+	if (this->simd_strategy.empty())
+	{
+		     if (this->max == "MAX" ) return _build_siso<B,Q,tools::max       <Q>>(trellis, encoder);
+		else if (this->max == "MAXS") return _build_siso<B,Q,tools::max_star  <Q>>(trellis, encoder);
+		else if (this->max == "MAXL") return _build_siso<B,Q,tools::max_linear<Q>>(trellis, encoder);
+	}
+	else
+	{
+		     if (this->max == "MAX" ) return _build_siso_simd<B,Q,tools::max_i       <Q>>(trellis, encoder);
+		else if (this->max == "MAXS") return _build_siso_simd<B,Q,tools::max_star_i  <Q>>(trellis, encoder);
+		else if (this->max == "MAXL") return _build_siso_simd<B,Q,tools::max_linear_i<Q>>(trellis, encoder);
+	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -1,6 +1,7 @@
 #include "Tools/Exception/exception.hpp"
 
 #include "Module/Decoder/Turbo_DB/Decoder_turbo_DB.hpp"
+#include "Module/Decoder/Turbo_DB/Decoder_turbo_DB_fast.hpp"
 
 #include "Decoder_turbo_DB.hpp"
 
@@ -94,6 +95,7 @@ void Decoder_turbo_DB::parameters
 	opt_args.erase({pi+"-fra", "F"});
 
 	opt_args[{p+"-type", "D"}][2] += ", TURBO_DB";
+	opt_args[{p+"-implem"   }][2] += ", FAST";
 
 	opt_args[{p+"-ite", "i"}] =
 		{"strictly_positive_int",
@@ -136,6 +138,9 @@ void Decoder_turbo_DB::parameters
 
 	sub->store(vals);
 
+	if (this->sub->simd_strategy == "INTER" && !exist(vals, {p+"-implem"}))
+		this->implem = "FAST";
+
 	this->N_cw = 2 * this->sub->N_cw - this->K;
 	this->R    = (float)this->K / (float)this->N_cw;
 
@@ -191,7 +196,8 @@ module::Decoder_turbo_DB<B,Q>* Decoder_turbo_DB::parameters
 {
 	if (this->type == "TURBO_DB")
 	{
-		if (this->implem == "STD") return new module::Decoder_turbo_DB<B,Q>(this->K, this->N_cw, this->n_ite, itl, siso_n, siso_i);
+		     if (this->implem == "STD" ) return new module::Decoder_turbo_DB     <B,Q>(this->K, this->N_cw, this->n_ite, itl, siso_n, siso_i);
+		else if (this->implem == "FAST") return new module::Decoder_turbo_DB_fast<B,Q>(this->K, this->N_cw, this->n_ite, itl, siso_n, siso_i);
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -48,6 +48,11 @@ void Encoder_LDPC::parameters
 		{"string",
 		 "path to the G matrix (AList formated file, required by the \"LDPC\" encoder)."};
 
+	opt_args[{p+"-g-cache"}] =
+		{"string",
+		 "path to a directory where the G matrices built from H are cached to speed up the next runs (\"LDPC_H\" "
+		 "encoder)."};
+
 	opt_args[{p+"-h-reorder"}] =
 		{"string",
 		 "specify if the check nodes (CNs) from H have to be reordered, 'NONE': do nothing (default), 'ASC': from the "
@@ -62,9 +67,10 @@ void Encoder_LDPC::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-h-path"   })) this->H_path    = vals.at({p+"-h-path"   });
-	if(exist(vals, {p+"-g-path"   })) this->G_path    = vals.at({p+"-g-path"   });
-	if(exist(vals, {p+"-h-reorder"})) this->H_reorder = vals.at({p+"-h-reorder"});
+	if(exist(vals, {p+"-h-path"   })) this->H_path      = vals.at({p+"-h-path"   });
+	if(exist(vals, {p+"-g-path"   })) this->G_path      = vals.at({p+"-g-path"   });
+	if(exist(vals, {p+"-g-cache"  })) this->G_cache_dir = vals.at({p+"-g-cache"  });
+	if(exist(vals, {p+"-h-reorder"})) this->H_reorder   = vals.at({p+"-h-reorder"});
 }
 
 void Encoder_LDPC::parameters
@@ -81,6 +87,8 @@ void Encoder_LDPC::parameters
 		headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 		headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
 	}
+	if (this->type == "LDPC_H" && !this->G_cache_dir.empty())
+		headers[p].push_back(std::make_pair("G matrix cache", this->G_cache_dir));
 }
 
 template <typename B>
@@ -88,7 +96,8 @@ module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 ::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H) const
 {
 	     if (this->type == "LDPC"      ) return new module::Encoder_LDPC        <B>(this->K, this->N_cw, G, this->n_frames);
-	else if (this->type == "LDPC_H"    ) return new module::Encoder_LDPC_from_H <B>(this->K, this->N_cw, H, this->n_frames);
+	else if (this->type == "LDPC_H"    ) return new module::Encoder_LDPC_from_H <B>(this->K, this->N_cw, H, this->n_frames,
+	                                                                                this->G_cache_dir);
 	else if (this->type == "LDPC_QC"   ) return new module::Encoder_LDPC_from_QC<B>(this->K, this->N_cw, H, this->n_frames);
 	else if (this->type == "LDPC_DVBS2") return new module::Encoder_LDPC_DVBS2  <B>(this->K, this->N_cw,    this->n_frames);
 
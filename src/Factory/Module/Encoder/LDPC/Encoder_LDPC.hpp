@@ -23,6 +23,7 @@ struct Encoder_LDPC : public Encoder
 		// optional
 		std::string H_path = "";
 		std::string G_path = "";
+		std::string G_cache_dir = "";
 
 		// optional parameters
 		std::string H_reorder = "NONE";
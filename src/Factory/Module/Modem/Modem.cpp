@@ -5,10 +5,14 @@
 #include "Module/Modem/BPSK/Modem_BPSK.hpp"
 #include "Module/Modem/BPSK/Modem_BPSK_fast.hpp"
 #include "Module/Modem/PAM/Modem_PAM.hpp"
+#include "Module/Modem/PAM/Modem_PAM_fast.hpp"
 #include "Module/Modem/QAM/Modem_QAM.hpp"
+#include "Module/Modem/QAM/Modem_QAM_fast.hpp"
 #include "Module/Modem/PSK/Modem_PSK.hpp"
 #include "Module/Modem/CPM/Modem_CPM.hpp"
+#include "Module/Modem/CPM/Modem_CPM_fast.hpp"
 #include "Module/Modem/SCMA/Modem_SCMA.hpp"
+#include "Module/Modem/SCMA/Modem_SCMA_fast.hpp"
 #include "Module/Modem/User/Modem_user.hpp"
 
 #include "Modem.hpp"
@@ -101,6 +105,12 @@ void Modem::parameters
 		 "select the type of the max operation to use in the demodulator.",
 		 "MAX, MAXL, MAXS, MAXSS"};
 
+	opt_args[{p+"-implem"}] =
+		{"string",
+		 "select the implementation of the demodulator (FAST is a separable max-log demodulator for PAM and QAM, "
+		 "an inter-frame SIMD BCJR for CPM and a SIMD log-domain MPA for SCMA).",
+		 "STD, FAST"};
+
 	opt_args[{p+"-sigma"}] =
 		{"strictly_posive_float",
 		 "noise variance value for the demodulator."};
@@ -188,10 +198,42 @@ void Modem::parameters
 
 	// --------------------------------------------------------------------------------------------------- demodulator
 	if(exist(vals, {p+"-no-sig2"})) this->no_sig2 = true;
-	if(exist(vals, {p+"-sigma"  })) this->sigma   = std::stof(vals.at({p+"-sigma"}));
-	if(exist(vals, {p+"-ite"    })) this->n_ite   = std::stoi(vals.at({p+"-ite"  }));
-	if(exist(vals, {p+"-max"    })) this->max     =           vals.at({p+"-max"  });
-	if(exist(vals, {p+"-psi"    })) this->psi     =           vals.at({p+"-psi"  });
+	if(exist(vals, {p+"-sigma"  })) this->sigma   = std::stof(vals.at({p+"-sigma" }));
+	if(exist(vals, {p+"-ite"    })) this->n_ite   = std::stoi(vals.at({p+"-ite"   }));
+	if(exist(vals, {p+"-max"    })) this->max     =           vals.at({p+"-max"   });
+	if(exist(vals, {p+"-psi"    })) this->psi     =           vals.at({p+"-psi"   });
+	if(exist(vals, {p+"-implem" })) this->implem  =           vals.at({p+"-implem"});
+
+	if (this->implem == "FAST")
+	{
+		// the FAST demodulators: a separable max-log for PAM and QAM, an inter-frame SIMD BCJR for CPM and a SIMD
+		// log-domain MPA for SCMA
+		if (this->type != "PAM" && this->type != "QAM" && this->type != "CPM" && this->type != "SCMA")
+		{
+			std::stringstream message;
+			message << "The FAST implementation of the demodulator is not available for this modem type ('type' = "
+			        << this->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the separable PAM/QAM demodulator is a max-log demodulator: the other max operations are not supported
+		if ((this->type == "PAM" || this->type == "QAM") && this->max != "MAX")
+		{
+			std::stringstream message;
+			message << "The FAST " << this->type << " demodulator requires the 'MAX' max operation ('max' = "
+			        << this->max << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// there is no SIMD version of the safe max-star, the SIMD CPM and SCMA demodulators cannot use it
+		if ((this->type == "CPM" || this->type == "SCMA") && this->max == "MAXSS")
+		{
+			std::stringstream message;
+			message << "The FAST " << this->type << " demodulator does not support the 'MAXSS' max operation, use "
+			        << "'MAXS' instead.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
 }
 
 void Modem::parameters
@@ -223,7 +265,7 @@ void Modem::parameters
 	std::string demod_max  = (this->type == "BPSK"     ) ||
 	                         (this->type == "BPSK_FAST") ||
 	                         (this->type == "OOK"      ) ||
-	                         (this->type == "SCMA"     ) ?
+	                         (this->type == "SCMA" && this->implem != "FAST") ?
 	                         "unused" : this->max;
 	std::string demod_ite  = std::to_string(this->n_ite);
 	std::string demod_psi  = this->psi;
@@ -233,6 +275,8 @@ void Modem::parameters
 	headers[p].push_back(std::make_pair("Sigma square", demod_sig2));
 	if (demod_max != "unused")
 		headers[p].push_back(std::make_pair("Max type", demod_max));
+	if (this->type == "PAM" || this->type == "QAM" || this->type == "CPM" || this->type == "SCMA")
+		headers[p].push_back(std::make_pair("Implementation", this->implem));
 	if (this->type == "SCMA")
 	{
 		headers[p].push_back(std::make_pair("Number of iterations", demod_ite));
@@ -244,6 +288,12 @@ template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
 module::Modem<B,R,Q>* Modem::parameters
 ::_build() const
 {
+	if (this->implem == "FAST")
+	{
+		     if (this->type == "PAM") return new module::Modem_PAM_fast<B,R,Q,MAX>(this->N, this->sigma, this->bps, this->no_sig2, this->n_frames);
+		else if (this->type == "QAM") return new module::Modem_QAM_fast<B,R,Q,MAX>(this->N, this->sigma, this->bps, this->no_sig2, this->n_frames);
+	}
+
 	     if (this->type == "BPSK"     ) return new module::Modem_BPSK     <B,R,Q    >(this->N,                   this->sigma,                                                                                               this->no_sig2, this->n_frames);
 	else if (this->type == "BPSK_FAST") return new module::Modem_BPSK_fast<B,R,Q    >(this->N,                   this->sigma,                                                                                               this->no_sig2, this->n_frames);
 	else if (this->type == "OOK"      ) return new module::Modem_OOK      <B,R,Q    >(this->N,                   this->sigma,                                                                                               this->no_sig2, this->n_frames);
@@ -268,14 +318,45 @@ module::Modem<B,R,Q>* Modem::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename R, typename Q, tools::proto_max_i<Q> MAXI>
+module::Modem<B,R,Q>* Modem::parameters
+::_build_scma_fast() const
+{
+	     if (this->psi == "PSI0") return new module::Modem_SCMA_fast<B,R,Q,tools::log_psi_0_i<Q>,MAXI>(this->N, this->sigma, this->bps, this->no_sig2, this->n_ite, this->n_frames);
+	else if (this->psi == "PSI1") return new module::Modem_SCMA_fast<B,R,Q,tools::log_psi_1_i<Q>,MAXI>(this->N, this->sigma, this->bps, this->no_sig2, this->n_ite, this->n_frames);
+	else if (this->psi == "PSI2") return new module::Modem_SCMA_fast<B,R,Q,tools::log_psi_2_i<Q>,MAXI>(this->N, this->sigma, this->bps, this->no_sig2, this->n_ite, this->n_frames);
+	else if (this->psi == "PSI3") return new module::Modem_SCMA_fast<B,R,Q,tools::log_psi_3_i<Q>,MAXI>(this->N, this->sigma, this->bps, this->no_sig2, this->n_ite, this->n_frames);
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+module::Modem<B,R,Q>* Modem::parameters
+::_build_cpm_fast() const
+{
+	return new module::Modem_CPM_fast<B,R,Q,MAX,MAXI>(this->N, this->sigma, this->bps, this->upf, this->cpm_L, this->cpm_k, this->cpm_p, this->mapping, this->wave_shape, this->no_sig2, this->n_frames);
+}
+
 template <typename B, typename R, typename Q>
 module::Modem<B,R,Q>* Modem::parameters
 ::build() const
 {
-	if (this->type == "SCMA")
+	if (this->type == "SCMA" && this->implem == "FAST")
+	{
+		     if (this->max == "MAX"  ) return _build_scma_fast<B,R,Q,tools::max_i       <Q>>();
+		else if (this->max == "MAXL" ) return _build_scma_fast<B,R,Q,tools::max_linear_i<Q>>();
+		else if (this->max == "MAXS" ) return _build_scma_fast<B,R,Q,tools::max_star_i  <Q>>();
+	}
+	else if (this->type == "SCMA")
 	{
 		return _build_scma<B,R,Q>();
 	}
+	else if (this->type == "CPM" && this->implem == "FAST")
+	{
+		     if (this->max == "MAX"  ) return _build_cpm_fast<B,R,Q,tools::max          <Q>,tools::max_i       <Q>>();
+		else if (this->max == "MAXL" ) return _build_cpm_fast<B,R,Q,tools::max_linear   <Q>,tools::max_linear_i<Q>>();
+		else if (this->max == "MAXS" ) return _build_cpm_fast<B,R,Q,tools::max_star     <Q>,tools::max_star_i  <Q>>();
+	}
 	else
 	{
 		     if (this->max == "MAX"  ) return _build<B,R,Q,tools::max          <Q>>();
@@ -43,6 +43,8 @@ struct Modem : public Factory
 		// ------- demodulator parameters
 		std::string max        = "MAX";     // max to use in the demodulation (MAX = max, MAXL = max_linear, MAXS = max_star)
 		std::string psi        = "PSI0";    // psi function to use in the SCMA demodulation (PSI0, PSI1, PSI2, PSI3)
+		std::string implem     = "STD";     // demodulator implementation (STD, FAST = separable max-log for PAM/QAM
+		                                    // or inter-frame SIMD BCJR for CPM)
 		bool        no_sig2    = false;     // do not divide by (sig^2) / 2 in the demodulation
 		int         n_ite      = 1;         // number of demodulations/decoding sessions to perform in the BFERI simulations
 		int         N_fil      = 0;         // frame size at the output of the filter
@@ -71,6 +73,13 @@ struct Modem : public Factory
 
 		template <typename B = int, typename R = float, typename Q = R>
 		inline module::Modem<B,R,Q>* _build_scma() const;
+
+		template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX,
+		          tools::proto_max_i<Q> MAXI>
+		inline module::Modem<B,R,Q>* _build_cpm_fast() const;
+
+		template <typename B = int, typename R = float, typename Q = R, tools::proto_max_i<Q> MAXI>
+		inline module::Modem<B,R,Q>* _build_scma_fast() const;
 	};
 
 
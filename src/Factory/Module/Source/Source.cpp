@@ -3,6 +3,7 @@
 #include "Module/Source/AZCW/Source_AZCW.hpp"
 #include "Module/Source/Random/Source_random.hpp"
 #include "Module/Source/Random/Source_random_fast.hpp"
+#include "Module/Source/Random/Source_random_philox.hpp"
 #include "Module/Source/User/Source_user.hpp"
 
 #include "Source.hpp"
@@ -46,7 +47,7 @@ void Source::parameters
 	opt_args[{p+"-type"}] =
 		{"string",
 		 "method used to generate the codewords.",
-		 "RAND, RAND_FAST, AZCW, USER"};
+		 "RAND, RAND_FAST, RAND_PHILOX, AZCW, USER"};
 
 	opt_args[{p+"-path"}] =
 		{"string",
@@ -79,7 +80,7 @@ void Source::parameters
 	if (full) headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->n_frames)));
 	if (this->type == "USER")
 		headers[p].push_back(std::make_pair("Path", this->path));
-	if ((this->type == "RAND" || this->type == "RAND_FAST") && full)
+	if ((this->type == "RAND" || this->type == "RAND_FAST" || this->type == "RAND_PHILOX") && full)
 		headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 }
 
@@ -87,10 +88,11 @@ template <typename B>
 module::Source<B>* Source::parameters
 ::build() const
 {
-	     if (this->type == "RAND"     ) return new module::Source_random     <B>(this->K, this->seed, this->n_frames);
-	else if (this->type == "RAND_FAST") return new module::Source_random_fast<B>(this->K, this->seed, this->n_frames);
-	else if (this->type == "AZCW"     ) return new module::Source_AZCW       <B>(this->K,             this->n_frames);
-	else if (this->type == "USER"     ) return new module::Source_user       <B>(this->K, this->path, this->n_frames);
+	     if (this->type == "RAND"       ) return new module::Source_random       <B>(this->K, this->seed, this->n_frames);
+	else if (this->type == "RAND_FAST"  ) return new module::Source_random_fast  <B>(this->K, this->seed, this->n_frames);
+	else if (this->type == "RAND_PHILOX") return new module::Source_random_philox<B>(this->K, this->seed, this->n_frames);
+	else if (this->type == "AZCW"       ) return new module::Source_AZCW         <B>(this->K,             this->n_frames);
+	else if (this->type == "USER"       ) return new module::Source_user         <B>(this->K, this->path, this->n_frames);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -124,11 +124,35 @@ void BFER::parameters
 	opt_args[{p+"-coded"}] =
 		{"",
 		 "enable the coded monitoring (extends the monitored bits to the entire codeword)."};
+
+	opt_args[{p+"-chkpt-path"}] =
+		{"string",
+		 "path to the checkpoint file where the counters of each SNR point are periodically saved."};
+
+	opt_args[{p+"-chkpt-freq"}] =
+		{"strictly_positive_int",
+		 "time in sec between two checkpoints."};
+
+	opt_args[{p+"-resume"}] =
+		{"",
+		 "resume the simulation from the checkpoint: the finished SNR points are skipped and the other ones are "
+		 "continued with new random streams (requires \"--sim-chkpt-path\")."};
+
+	opt_args[{p+"-trace-path"}] =
+		{"string",
+		 "base path of the timelines of the task executions, one Chrome trace event file (JSON) is written per SNR "
+		 "point (\"$path_$snr.json\"), it can be opened in chrome://tracing or in the Perfetto UI."};
+
+	opt_args[{p+"-trace-size"}] =
+		{"strictly_positive_int",
+		 "number of task executions kept per thread in the timelines (the oldest ones are overwritten)."};
 }
 
 void BFER::parameters
 ::store(const arg_val_map &vals)
 {
+	using namespace std::chrono;
+
 #if !defined(SYSTEMC)
 	this->n_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
 #endif
@@ -144,6 +168,18 @@ void BFER::parameters
 	if(exist(vals, {p+"-err-trk"        })) this->err_track_enable    = true;
 	if(exist(vals, {p+"-coset",      "c"})) this->coset               = true;
 	if(exist(vals, {p+"-coded",         })) this->coded_monitoring    = true;
+	if(exist(vals, {p+"-chkpt-path"     })) this->chkpt_path          =           vals.at({p+"-chkpt-path"   });
+	if(exist(vals, {p+"-chkpt-freq"     })) this->chkpt_freq          = seconds(std::stoi(vals.at({p+"-chkpt-freq"   })));
+	if(exist(vals, {p+"-resume"         })) this->resume              = true;
+	if(exist(vals, {p+"-trace-path"     })) this->trace_path          =           vals.at({p+"-trace-path"   });
+	if(exist(vals, {p+"-trace-size"     })) this->trace_size          = std::stoi(vals.at({p+"-trace-size"   }));
+
+	if (this->resume && this->chkpt_path.empty())
+	{
+		std::stringstream message;
+		message << "The resume of the simulation requires a checkpoint path ('--sim-chkpt-path').";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
 	if (this->err_track_revert)
 	{
@@ -178,6 +214,19 @@ void BFER::parameters
 		headers[p].push_back(std::make_pair("Bad frames base path", path));
 	}
 
+	if (!this->chkpt_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Checkpoint path", this->chkpt_path));
+		headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->chkpt_freq.count())));
+		headers[p].push_back(std::make_pair("Resume", this->resume ? "on" : "off"));
+	}
+
+	if (!this->trace_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Trace path", this->trace_path + std::string("_$snr.json")));
+		headers[p].push_back(std::make_pair("Trace size", std::to_string(this->trace_size)));
+	}
+
 	if (this->src != nullptr && this->cdc != nullptr)
 	{
 		const auto bit_rate = (float)this->src->K / (float)this->cdc->N;
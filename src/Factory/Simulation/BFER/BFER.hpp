@@ -27,13 +27,18 @@ struct BFER : Simulation
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
-		std::string snr_type            = "EB";
-		std::string err_track_path      = "error_tracker";
-		int         err_track_threshold = 0;
-		bool        err_track_revert    = false;
-		bool        err_track_enable    = false;
-		bool        coset               = false;
-		bool        coded_monitoring    = false;
+		std::string          snr_type            = "EB";
+		std::string          err_track_path      = "error_tracker";
+		std::string          chkpt_path          = "";
+		std::chrono::seconds chkpt_freq          = std::chrono::seconds(60);
+		std::string          trace_path          = "";
+		int                  trace_size          = 1 << 16;
+		int                  err_track_threshold = 0;
+		bool                 err_track_revert    = false;
+		bool                 err_track_enable    = false;
+		bool                 coset               = false;
+		bool                 coded_monitoring    = false;
+		bool                 resume              = false;
 
 		// module parameters
 		Source       ::parameters *src = nullptr;
@@ -1,3 +1,8 @@
+#include <algorithm>
+
+#include "Tools/general_utils.h"
+#include "Tools/Exception/exception.hpp"
+
 #include "Simulation/BFER/Standard/SystemC/SC_BFER_std.hpp"
 #include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
 
@@ -43,18 +48,96 @@ void BFER_std::parameters
 ::get_description(arg_map &req_args, arg_map &opt_args) const
 {
 	BFER::parameters::get_description(req_args, opt_args);
+
+#if !defined(SYSTEMC)
+	auto p = this->get_prefix();
+
+	opt_args[{p+"-pipeline"}] =
+		{"string",
+		 "enable the pipeline mode and give the number of replicas of each stage, the stages are executed by a work "
+		 "stealing pool of '--sim-threads' threads. 1 stage: the whole chain; 2 stages: source to depuncturer, "
+		 "decoder to monitor; 3 stages: source to depuncturer, decoder, monitor; 4 stages: source to modulator, "
+		 "channel to depuncturer, decoder, monitor (ex: \"1,6,1\")."};
+
+	opt_args[{p+"-pipeline-qsize"}] =
+		{"strictly_positive_int",
+		 "maximal number of frames waiting between two stages in the pipeline mode."};
+
+	opt_args[{p+"-share-buffers"}] =
+		{"",
+		 "share the memory of the output buffers of the tasks which are not alive at the same time (one arena per "
+		 "thread)."};
+
+	opt_args[{p+"-packed"}] =
+		{"",
+		 "pack the frames in 64-bit words from the source to the modulator (the decoded bits are packed after the "
+		 "CRC extraction and the errors are counted with popcounts)."};
+#endif
 }
 
 void BFER_std::parameters
 ::store(const arg_val_map &vals)
 {
 	BFER::parameters::store(vals);
+
+#if !defined(SYSTEMC)
+	auto p = this->get_prefix();
+
+	if(exist(vals, {p+"-pipeline-qsize"})) this->pipeline_queue_size = std::stoi(vals.at({p+"-pipeline-qsize"}));
+	if(exist(vals, {p+"-share-buffers" })) this->share_buffers       = true;
+	if(exist(vals, {p+"-packed"        })) this->packed              = true;
+	if(exist(vals, {p+"-pipeline"}))
+	{
+		this->pipeline_n_threads.clear();
+		for (auto &s : tools::split(vals.at({p+"-pipeline"}), ','))
+			this->pipeline_n_threads.push_back((size_t)std::stoi(s));
+
+		if (this->pipeline_n_threads.size() < 1 || this->pipeline_n_threads.size() > 4 ||
+		    std::find(this->pipeline_n_threads.begin(), this->pipeline_n_threads.end(), (size_t)0) !=
+		    this->pipeline_n_threads.end())
+		{
+			std::stringstream message;
+			message << "'pipeline_n_threads' has to contain 1 to 4 strictly positive values ('sim-pipeline' = "
+			        << vals.at({p+"-pipeline"}) << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the replicas of a stage are executed by the threads of the pool, more replicas than threads are useless
+		const auto max_n = *std::max_element(this->pipeline_n_threads.begin(), this->pipeline_n_threads.end());
+		if (max_n > (size_t)this->n_threads)
+		{
+			std::stringstream message;
+			message << "The number of replicas of a stage has to be smaller or equal to the number of threads "
+			        << "('sim-pipeline' = " << vals.at({p+"-pipeline"}) << ", 'n_threads' = " << this->n_threads
+			        << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+#endif
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (!this->pipeline_n_threads.empty())
+	{
+		std::string stages;
+		for (size_t s = 0; s < this->pipeline_n_threads.size(); s++)
+			stages += std::to_string(this->pipeline_n_threads[s]) + (s < this->pipeline_n_threads.size() -1 ? "," : "");
+
+		headers[p].push_back(std::make_pair("Pipeline replicas per stage", stages));
+		headers[p].push_back(std::make_pair("Pipeline queue size", std::to_string(this->pipeline_queue_size)));
+	}
+
+	if (this->share_buffers)
+		headers[p].push_back(std::make_pair("Shared buffers", "on"));
+
+	if (this->packed)
+		headers[p].push_back(std::make_pair("Packed frames", "on"));
 }
 
 template <typename B, typename R, typename Q>
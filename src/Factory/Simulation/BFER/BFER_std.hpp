@@ -2,6 +2,7 @@
 #define FACTORY_SIMULATION_BFER_STD_HPP_
 
 #include <string>
+#include <vector>
 
 #include "Factory/Module/Codec/Codec_SIHO.hpp"
 
@@ -28,6 +29,12 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::vector<size_t> pipeline_n_threads;      // number of replicas of each stage (empty = pipeline disabled)
+		int                 pipeline_queue_size = 4;
+		bool                share_buffers       = false;
+		bool                packed              = false;
+
 		// module parameters
 		Codec_SIHO::parameters *cdc = nullptr;
 
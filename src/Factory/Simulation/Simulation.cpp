@@ -1,4 +1,6 @@
 #include "Tools/Exception/exception.hpp"
+#include "Tools/general_utils.h"
+#include "Tools/Perf/Perf_counters/Perf_counters.hpp"
 
 #include "Simulation.hpp"
 
@@ -72,6 +74,11 @@ void Simulation::parameters
 		{"",
 		 "display statistics module by module."};
 
+	opt_args[{p+"-stats-hw"}] =
+		{"string",
+		 "enable the statistics and count the given hardware events in each task (Linux only, comma separated list "
+		 "among: CYCLES, INSTRUCTIONS, BRANCH_MISSES, L1D_MISSES, LLC_MISSES, ex: \"CYCLES,INSTRUCTIONS\")."};
+
 	opt_args[{p+"-threads", "t"}] =
 		{"positive_int",
 		 "specify the number of threads used (0 or default is the number of CPU cores)."};
@@ -109,6 +116,20 @@ void Simulation::parameters
 	if(exist(vals, {p+"-stop-time"    })) this->stop_time   = seconds(std::stoi(vals.at({p+"-stop-time"    })));
 	if(exist(vals, {p+"-seed",     "S"})) this->global_seed =         std::stoi(vals.at({p+"-seed",     "S"}));
 	if(exist(vals, {p+"-stats"        })) this->statistics  = true;
+	if(exist(vals, {p+"-stats-hw"}))
+	{
+		this->statistics = true;
+		this->stats_hw_events = tools::split(vals.at({p+"-stats-hw"}), ',');
+
+		for (auto &e : this->stats_hw_events)
+			if (!tools::Perf_counters::is_event(e))
+			{
+				std::stringstream message;
+				message << "Unknown hardware event ('sim-stats-hw' = " << vals.at({p+"-stats-hw"})
+				        << ", 'event' = " << e << ").";
+				throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+	}
 	if(exist(vals, {p+"-debug",    "d"})) this->debug       = true;
 	if(exist(vals, {p+"-debug-limit"}))
 	{
@@ -185,6 +206,13 @@ void Simulation::parameters
 	headers[p].push_back(std::make_pair("SNR step (s)", std::to_string(this->snr_step) + " dB"));
 	headers[p].push_back(std::make_pair("Seed", std::to_string(this->global_seed)));
 	headers[p].push_back(std::make_pair("Statistics", this->statistics ? "on" : "off"));
+	if (!this->stats_hw_events.empty())
+	{
+		std::string events;
+		for (auto &e : this->stats_hw_events)
+			events += (events.empty() ? "" : ", ") + e;
+		headers[p].push_back(std::make_pair("Stats. HW events", events));
+	}
 	headers[p].push_back(std::make_pair("Debug mode", this->debug ? "on" : "off"));
 	if (this->debug)
 	{
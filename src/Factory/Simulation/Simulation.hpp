@@ -6,6 +6,7 @@
 #endif
 #include <chrono>
 #include <string>
+#include <vector>
 #include <sstream>
 
 #include "Tools/Display/bash_tools.h"
@@ -45,6 +46,7 @@ struct Simulation : Launcher
 		int                       global_seed     = 0;
 		int                       debug_limit     = 0;
 		int                       debug_precision = 2;
+		std::vector<std::string>  stats_hw_events;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		virtual ~parameters();
@@ -10,6 +10,7 @@
 #include "Tools/Interleaver/NO/Interleaver_core_NO.hpp"
 #include "Tools/Interleaver/Golden/Interleaver_core_golden.hpp"
 #include "Tools/Interleaver/Random/Interleaver_core_random.hpp"
+#include "Tools/Interleaver/Feistel/Interleaver_core_feistel.hpp"
 #include "Tools/Interleaver/User/Interleaver_core_user.hpp"
 
 #include "Interleaver_core.hpp"
@@ -53,7 +54,7 @@ void Interleaver_core::parameters
 	opt_args[{p+"-type"}] =
 		{"string",
 		 "specify the type of the interleaver.",
-		 "LTE, CCSDS, DVB-RCS1, DVB-RCS2, RANDOM, GOLDEN, USER, RAND_COL, ROW_COL, COL_ROW, NO"};
+		 "LTE, CCSDS, DVB-RCS1, DVB-RCS2, RANDOM, FEISTEL, GOLDEN, USER, RAND_COL, ROW_COL, COL_ROW, NO"};
 
 	opt_args[{p+"-path"}] =
 		{"string",
@@ -98,7 +99,7 @@ void Interleaver_core::parameters
 		headers[p].push_back(std::make_pair("Path", this->path));
 	if (this->type == "RAND_COL" || this->type == "ROW_COL" || this->type == "COL_ROW")
 		headers[p].push_back(std::make_pair("Number of columns", std::to_string(this->n_cols)));
-	if (this->type == "RANDOM" || this->type == "GOLDEN" || this->type == "RAND_COL")
+	if (this->type == "RANDOM" || this->type == "FEISTEL" || this->type == "GOLDEN" || this->type == "RAND_COL")
 	{
 		if (full) headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 		headers[p].push_back(std::make_pair("Uniform", (this->uniform ? "yes" : "no")));
@@ -114,6 +115,7 @@ tools::Interleaver_core<T>* Interleaver_core::parameters
 	else if (this->type == "DVB-RCS1") return new tools::Interleaver_core_ARP_DVB_RCS1 <T>(this->size,                                          this->n_frames);
 	else if (this->type == "DVB-RCS2") return new tools::Interleaver_core_ARP_DVB_RCS2 <T>(this->size,                                          this->n_frames);
 	else if (this->type == "RANDOM"  ) return new tools::Interleaver_core_random       <T>(this->size,               this->seed, this->uniform, this->n_frames);
+	else if (this->type == "FEISTEL" ) return new tools::Interleaver_core_feistel      <T>(this->size,               this->seed, this->uniform, this->n_frames);
 	else if (this->type == "RAND_COL") return new tools::Interleaver_core_random_column<T>(this->size, this->n_cols, this->seed, this->uniform, this->n_frames);
 	else if (this->type == "ROW_COL" ) return new tools::Interleaver_core_row_column   <T>(this->size, this->n_cols,                            this->n_frames);
 	else if (this->type == "COL_ROW" ) return new tools::Interleaver_core_column_row   <T>(this->size, this->n_cols,                            this->n_frames);
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <mipp.h>
 
 #include "Launcher/Simulation/BFER_std.hpp"
 
@@ -48,6 +49,9 @@ void Turbo_DB<L,B,R,Q>
 {
 	params_cdc->store(this->ar.get_args());
 
+	if (params_cdc->dec->sub->simd_strategy == "INTER")
+		this->params.src->n_frames = mipp::N<Q>();
+
 	if (std::is_same<Q,int8_t>())
 	{
 		this->params.qnt->n_bits     = 6;
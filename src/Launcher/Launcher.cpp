@@ -68,13 +68,15 @@ int Launcher::read_arguments()
 	bool miss_arg = !ar.parse_arguments(req_args, opt_args, cmd_warn);
 	bool error    = !ar.check_arguments(cmd_error);
 
+	std::string store_error;
 	try
 	{
 		this->store_args();
 	}
-	catch(std::exception&)
+	catch(std::exception &e)
 	{
 		params_common.display_help = true;
+		store_error = e.what();
 	}
 
 	if (params_common.display_help)
@@ -89,6 +91,10 @@ int Launcher::read_arguments()
 	for (unsigned e = 0; e < cmd_error.size(); e++)
 		std::cerr << tools::format_error(cmd_error[e]) << std::endl;
 
+	// print the error of the parameters which are not compatible with each other
+	if (!store_error.empty())
+		std::cerr << tools::apply_on_each_line(tools::addr2line(store_error), &tools::format_error) << std::endl;
+
 	if (miss_arg)
 		std::cerr << tools::format_error("At least one required argument is missing.") << std::endl;
 
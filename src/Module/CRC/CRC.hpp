@@ -11,8 +11,11 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <cstdint>
+#include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -24,14 +27,16 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { build, extract, check, SIZE };
+			enum list { build, extract, check, build_packed, extract_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace build   { enum list { U_K1, U_K2, SIZE }; }
-			namespace extract { enum list { V_K1, V_K2, SIZE }; }
-			namespace check   { enum list { V_K       , SIZE }; }
+			namespace build          { enum list { U_K1, U_K2, SIZE }; }
+			namespace extract        { enum list { V_K1, V_K2, SIZE }; }
+			namespace check          { enum list { V_K       , SIZE }; }
+			namespace build_packed   { enum list { U_K1, U_K2, SIZE }; }
+			namespace extract_packed { enum list { V_K1, V_K2, SIZE }; }
 		}
 	}
 
@@ -51,6 +56,9 @@ protected:
 	const int K; /*!< Number of information bits (the CRC bits are not included in K) */
 	const int size;
 
+	mipp::vector<B> U_K1_unpacked; // allocated on the first call of the generic '_build_packed'
+	mipp::vector<B> U_K2_unpacked;
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -101,6 +109,33 @@ public:
 		{
 			return this->check(static_cast<B*>(p3s_V_K.get_dataptr())) ? 1 : 0;
 		});
+
+		using Bit_packer = tools::Bit_packer<B>;
+
+		auto &p4 = this->create_task("build_packed");
+		auto &p4s_U_K1 = this->template create_socket_in <B>(p4, "U_K1", Bit_packer::get_packed_size(this->K)
+		                                                                  * this->n_frames);
+		auto &p4s_U_K2 = this->template create_socket_out<B>(p4, "U_K2", Bit_packer::get_packed_size(this->K + this->size)
+		                                                                  * this->n_frames);
+		this->create_codelet(p4, [this, &p4s_U_K1, &p4s_U_K2]() -> int
+		{
+			this->build_packed(static_cast<B*>(p4s_U_K1.get_dataptr()),
+			                   static_cast<B*>(p4s_U_K2.get_dataptr()));
+
+			return 0;
+		});
+
+		auto &p5 = this->create_task("extract_packed");
+		auto &p5s_V_K1 = this->template create_socket_in <B>(p5, "V_K1", (this->K + this->size) * this->n_frames);
+		auto &p5s_V_K2 = this->template create_socket_out<B>(p5, "V_K2", Bit_packer::get_packed_size(this->K)
+		                                                                  * this->n_frames);
+		this->create_codelet(p5, [this, &p5s_V_K1, &p5s_V_K2]() -> int
+		{
+			this->extract_packed(static_cast<B*>(p5s_V_K1.get_dataptr()),
+			                     static_cast<B*>(p5s_V_K2.get_dataptr()));
+
+			return 0;
+		});
 	}
 
 	/*!
@@ -174,6 +209,28 @@ public:
 			             f);
 	}
 
+	/*!
+	 * \brief Same as 'build' but the frames are packed in 64-bit words (see 'tools::Bit_packer::get_packed_size').
+	 *
+	 * \param U_K1: the packed information bits (ceil(K / 64) words per frame).
+	 * \param U_K2: the packed information bits followed by the CRC bits (ceil((K + size) / 64) words per frame).
+	 */
+	virtual void build_packed(const B *U_K1, B *U_K2, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		const auto n_words1 = (this->K              + 63) / 64;
+		const auto n_words2 = (this->K + this->size + 63) / 64;
+		const auto *words1 = reinterpret_cast<const uint64_t*>(U_K1);
+		      auto *words2 = reinterpret_cast<      uint64_t*>(U_K2);
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_build_packed(words1 + f * n_words1,
+			                    words2 + f * n_words2,
+			                    f);
+	}
+
 	template <class A = std::allocator<B>>
 	void extract(const std::vector<B,A>& V_K1, std::vector<B,A>& V_K2, const int frame_id = -1)
 	{
@@ -216,6 +273,26 @@ public:
 			               f);
 	}
 
+	/*!
+	 * \brief Same as 'extract' but the information bits are packed in 64-bit words (the decoded frames are unpacked).
+	 *
+	 * \param V_K1: the decoded information bits followed by the CRC bits.
+	 * \param V_K2: the packed information bits (ceil(K / 64) words per frame).
+	 */
+	virtual void extract_packed(const B *V_K1, B *V_K2, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		const auto n_words = (this->K + 63) / 64;
+		auto *words = reinterpret_cast<uint64_t*>(V_K2);
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_extract_packed(V_K1  + f * (this->K + this->size),
+			                      words + f * n_words,
+			                      f);
+	}
+
 	/*!
 	 * \brief Checks if the CRC is verified or not.
 	 *
@@ -335,6 +412,26 @@ protected:
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
 
+	// the frames are unpacked, built and packed again, the CRCs which work on the words directly override it
+	virtual void _build_packed(const uint64_t *U_K1, uint64_t *U_K2, const int frame_id)
+	{
+		if (this->U_K1_unpacked.empty())
+		{
+			this->U_K1_unpacked.resize(this->K);
+			this->U_K2_unpacked.resize(this->K + this->size);
+		}
+
+		tools::Bit_packer<B>::unpack_words(U_K1, this->U_K1_unpacked.data(), this->K);
+		this->_build(this->U_K1_unpacked.data(), this->U_K2_unpacked.data(), frame_id);
+		tools::Bit_packer<B>::pack_words(this->U_K2_unpacked.data(), U_K2, this->K + this->size);
+	}
+
+	// the CRC bits are at the end of the frame: the information bits are packed directly
+	virtual void _extract_packed(const B *V_K1, uint64_t *V_K2, const int frame_id)
+	{
+		tools::Bit_packer<B>::pack_words(V_K1, V_K2, this->K);
+	}
+
 	virtual bool _check(const B *V_K, const int frame_id)
 	{
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
@@ -1,5 +1,6 @@
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Algo/Bit_packer.hpp"
@@ -16,6 +17,7 @@ CRC_polynomial<B>
 : CRC<B>(K, size ? size : CRC_polynomial<B>::get_size(CRC_polynomial<B>::get_name(poly_key)), n_frames),
   polynomial       (0                                     ),
   polynomial_packed(CRC_polynomial<B>::get_value(poly_key)),
+  polynomial_packed_reflected(0                           ),
   buff_crc         (0                                     )
 {
 	const std::string name = "CRC_polynomial";
@@ -42,6 +44,9 @@ CRC_polynomial<B>
 	for (auto i = 0; i < this->size; i++)
 		polynomial.push_back((polynomial_packed >> ((this->size -1) -i)) & 1);
 
+	for (auto i = 0; i < this->size; i++)
+		polynomial_packed_reflected |= ((polynomial_packed >> i) & 1) << ((this->size -1) -i);
+
 	buff_crc.resize((this->K + this->size) * this->n_frames);
 }
 
@@ -126,6 +131,40 @@ void CRC_polynomial<B>
 		std::copy(buff_crc.begin() + loop_size, buff_crc.begin() + loop_size + this->size, U_out + off_out);
 }
 
+template <typename B>
+void CRC_polynomial<B>
+::_build_packed(const uint64_t *U_K1, uint64_t *U_K2, const int frame_id)
+{
+	// the division is processed on the reflected register: the bits are read in their order from the LSB of the words
+	// and the remainder comes out with the first CRC bit on its LSB (one shift per bit instead of 'size' XORs)
+	unsigned crc = 0;
+	for (auto w = 0; w < (this->K + 63) / 64; w++)
+	{
+		const auto word   = U_K1[w];
+		const auto n_bits = std::min(64, this->K - w * 64);
+		for (auto j = 0; j < n_bits; j++)
+		{
+			crc ^= (unsigned)(word >> j) & 1;
+			crc = (crc >> 1) ^ (-(crc & 1) & this->polynomial_packed_reflected);
+		}
+	}
+
+	this->_store_packed(U_K1, crc, U_K2);
+}
+
+template <typename B>
+void CRC_polynomial<B>
+::_store_packed(const uint64_t *U_K1, const unsigned crc, uint64_t *U_K2)
+{
+	const auto n_words1 = (this->K              + 63) / 64;
+	const auto n_words2 = (this->K + this->size + 63) / 64;
+
+	std::copy(U_K1, U_K1 + n_words1, U_K2);
+	std::fill(U_K2 + n_words1, U_K2 + n_words2, (uint64_t)0);
+	if (this->size)
+		tools::Bit_packer<B>::write_bits(U_K2, this->K, (uint64_t)crc, this->size);
+}
+
 template <typename B>
 void CRC_polynomial<B>
 ::_extract(const B *V_K1, B *V_K2, const int frame_id)
@@ -16,6 +16,7 @@ protected:
 	const static std::map<std::string, std::tuple<unsigned, int>> known_polynomials;
 	std::vector<B> polynomial;
 	unsigned       polynomial_packed;
+	unsigned       polynomial_packed_reflected; // the coefficient of x^(size -1) is the LSB
 	std::vector<B> buff_crc;
 
 public:
@@ -32,6 +33,11 @@ protected:
 	virtual bool _check       (const B *V_K          , const int frame_id);
 	virtual bool _check_packed(const B *V_K          , const int frame_id);
 
+	virtual void _build_packed(const uint64_t *U_K1, uint64_t *U_K2, const int frame_id);
+
+	// U_K2 = the 'K' bits of U_K1 followed by the 'size' bits of 'crc' (the first CRC bit is the LSB of 'crc')
+	void _store_packed(const uint64_t *U_K1, const unsigned crc, uint64_t *U_K2);
+
 	void _generate(const B *U_in,
 	                     B *U_out,
 	               const int off_in, 
@@ -60,6 +60,18 @@ void CRC_polynomial_fast<B>
 		U_K2[this->K +i] = (crc >> i) & 1;
 }
 
+template <typename B>
+void CRC_polynomial_fast<B>
+::_build_packed(const uint64_t *U_K1, uint64_t *U_K2, const int frame_id)
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
+#endif
+	// the words are already in the layout of the bytes packed by the Bit_packer
+	const auto crc = this->compute_crc_v3((const void*)U_K1, this->K);
+	this->_store_packed(U_K1, crc, U_K2);
+}
+
 template <typename B>
 bool CRC_polynomial_fast<B>
 ::_check(const B *V_K, const int frame_id)
@@ -25,6 +25,8 @@ protected:
 	virtual bool _check       (const B *V_K          , const int frame_id);
 	virtual bool _check_packed(const B *V_K          , const int frame_id);
 
+	virtual void _build_packed(const uint64_t *U_K1, uint64_t *U_K2, const int frame_id);
+
 private:
 	inline unsigned compute_crc_v1(const void* data, const int n_bits);
 	inline unsigned compute_crc_v2(const void* data, const int n_bits);
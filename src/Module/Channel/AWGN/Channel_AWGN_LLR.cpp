@@ -53,7 +53,9 @@ void Channel_AWGN_LLR<R>
 			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 		}
 
+		noise_generator->set_position(this->frame_index * this->N);
 		noise_generator->generate(this->noise.data(), this->N, this->sigma);
+		this->frame_index += this->n_frames;
 
 		std::fill(Y_N, Y_N + this->N, (R)0);
 		for (auto f = 0; f < this->n_frames; f++)
@@ -68,10 +70,14 @@ void Channel_AWGN_LLR<R>
 		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
+		// the noise of the frame 'f' starts at the sample (frame_index + f) * N of a counter-based generator
+		noise_generator->set_position((this->frame_index + f_start) * this->N);
 		if (frame_id < 0)
 			noise_generator->generate(this->noise, this->sigma);
 		else
 			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
+		if (f_stop == this->n_frames)
+			this->frame_index += this->n_frames;
 
 		for (auto f = f_start; f < f_stop; f++)
 			for (auto n = 0; n < this->N; n++)
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <sstream>
 #include <algorithm>
 
@@ -53,6 +54,8 @@ protected:
 
 	std::vector<R> noise;
 
+	uint64_t frame_index; /*!< Index (in the whole simulation) of the first frame of the next call */
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -62,7 +65,7 @@ public:
 	 * \param name:     Channel's name.
 	 */
 	Channel(const int N, const R sigma = -1.f, const int n_frames = 1)
-	: Module(n_frames), N(N), sigma(sigma), noise(this->N * this->n_frames, 0)
+	: Module(n_frames), N(N), sigma(sigma), noise(this->N * this->n_frames, 0), frame_index(0)
 	{
 		const std::string name = "Channel";
 		this->set_name(name);
@@ -122,6 +125,19 @@ public:
 		return noise;
 	}
 
+	/*!
+	 * \brief Sets the index (in the whole simulation) of the first frame of the next call.
+	 *
+	 * The counter-based noise generators draw the noise of a frame from its index: a frame is then disturbed by the same
+	 * noise whatever the number of threads and the number of frames per call. The other generators ignore it.
+	 *
+	 * \param frame_index: the index of the first frame of the next call.
+	 */
+	virtual void set_frame_index(const uint64_t frame_index)
+	{
+		this->frame_index = frame_index;
+	}
+
 	virtual void set_sigma(const R sigma)
 	{
 		if (sigma <= 0)
@@ -1,5 +1,6 @@
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -8,25 +9,28 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+// with a counter-based generator, the gains are drawn from the second half of the stream (the noise of the frame 'i'
+// starts at the sample i * N and the gains of the frame 'i' at the sample gains_position + i * 2 * n_blocks)
+static constexpr uint64_t gains_position = (uint64_t)1 << 63;
+
 template <typename R>
 Channel_Rayleigh_LLR<R>
 ::Channel_Rayleigh_LLR(const int N, const bool complex, tools::Noise<R> *noise_generator, const bool add_users,
-                       const R sigma, const int n_frames)
+                       const R sigma, const int n_frames, const int gain_occurrences)
 : Channel<R>(N, sigma, n_frames),
   complex(complex),
   add_users(add_users),
-  gains(complex ? N * n_frames : 2 * N * n_frames),
+  gain_occur(gain_occurrences),
+  n_symbols(complex ? N / 2 : N),
+  n_blocks(gain_occurrences > 0 ? (n_symbols + gain_occurrences -1) / gain_occurrences : 0),
+  gains(2 * n_blocks * n_frames),
+  mod_gains(n_blocks),
   noise_generator(noise_generator)
 {
 	const std::string name = "Channel_Rayleigh_LLR";
 	this->set_name(name);
 
-	if (complex && N % 2)
-	{
-		std::stringstream message;
-		message << "'N' has to be divisible by 2 ('N' = " << N << ").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+	this->check_parameters();
 
 	if (noise_generator == nullptr)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
@@ -35,22 +39,21 @@ Channel_Rayleigh_LLR<R>
 template <typename R>
 Channel_Rayleigh_LLR<R>
 ::Channel_Rayleigh_LLR(const int N, const bool complex, const int seed, const bool add_users, const R sigma,
-                       const int n_frames)
+                       const int n_frames, const int gain_occurrences)
 : Channel<R>(N, sigma, n_frames),
   complex(complex),
   add_users(add_users),
-  gains(complex ? N * n_frames : 2 * N * n_frames),
+  gain_occur(gain_occurrences),
+  n_symbols(complex ? N / 2 : N),
+  n_blocks(gain_occurrences > 0 ? (n_symbols + gain_occurrences -1) / gain_occurrences : 0),
+  gains(2 * n_blocks * n_frames),
+  mod_gains(n_blocks),
   noise_generator(new tools::Noise_std<R>(seed))
 {
 	const std::string name = "Channel_Rayleigh_LLR";
 	this->set_name(name);
 
-	if (complex && N % 2)
-	{
-		std::stringstream message;
-		message << "'N' has to be divisible by 2 ('N' = " << N << ").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+	this->check_parameters();
 }
 
 template <typename R>
@@ -62,100 +65,136 @@ Channel_Rayleigh_LLR<R>
 
 template <typename R>
 void Channel_Rayleigh_LLR<R>
-::add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id)
+::check_parameters() const
 {
-	if (add_users && this->n_frames > 1)
+	if (this->complex && this->N % 2)
 	{
-		if (frame_id != -1)
-		{
-			std::stringstream message;
-			message << "'frame_id' has to be equal to -1 ('frame_id' = " << frame_id << ").";
-			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-		}
+		std::stringstream message;
+		message << "'N' has to be divisible by 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		noise_generator->generate(this->gains, (R)1 / (R)std::sqrt((R)2));
-		noise_generator->generate(this->noise.data(), this->N, this->sigma);
+	if (this->gain_occur <= 0)
+	{
+		std::stringstream message;
+		message << "'gain_occur' has to be greater than 0 ('gain_occur' = " << this->gain_occur << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
 
-		std::fill(Y_N, Y_N + this->N, (R)0);
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::generate_gains(R *H_N, const int f_start, const int f_stop)
+{
+	const auto n_gains = 2 * this->n_blocks;
+	noise_generator->set_position(gains_position + (this->frame_index + f_start) * n_gains);
+	noise_generator->generate(this->gains.data() + f_start * n_gains, (f_stop - f_start) * n_gains,
+	                          (R)1 / (R)std::sqrt((R)2));
+
+	for (auto f = f_start; f < f_stop; f++)
+	{
+		const auto *g_re = this->gains.data() + f * n_gains;
+		const auto *g_im = g_re + this->n_blocks;
+		auto *H = H_N + f * this->N;
 
 		if (this->complex)
 		{
-			for (auto f = 0; f < this->n_frames; f++)
+			for (auto b = 0; b < this->n_blocks; b++)
 			{
-				for (auto i = 0; i < this->N; i += 2)
+				const auto s_stop = std::min(this->n_symbols, (b +1) * this->gain_occur);
+				for (auto s = b * this->gain_occur; s < s_stop; s++)
 				{
-					const auto h_re = H_N[f * this->N +i   ] = this->gains[f * this->N +i   ];
-					const auto h_im = H_N[f * this->N +i +1] = this->gains[f * this->N +i +1];
-
-					Y_N[i   ] += X_N[f * this->N +i   ] * h_re - X_N[f * this->N +i +1] * h_im;
-					Y_N[i +1] += X_N[f * this->N +i +1] * h_re + X_N[f * this->N +i   ] * h_im;
+					H[2*s   ] = g_re[b];
+					H[2*s +1] = g_im[b];
 				}
 			}
 		}
 		else
 		{
-			for (auto f = 0; f < this->n_frames; f++)
+			// only the modulus of the complex gains is used in the real case
+			const auto vec_loop_size = (this->n_blocks / mipp::nElReg<R>()) * mipp::nElReg<R>();
+			for (auto b = 0; b < vec_loop_size; b += mipp::nElReg<R>())
 			{
-				for (auto i = 0; i < this->N; i++)
-				{
-					const auto h_re = this->gains[f * this->N * 2 + 2*i   ];
-					const auto h_im = this->gains[f * this->N * 2 + 2*i +1];
-
-					H_N[f * this->N +i] = std::sqrt(h_re * h_re + h_im * h_im);
-					Y_N[i] += X_N[f * this->N +i] * H_N[f * this->N +i];
-				}
+				mipp::Reg<R> r_re, r_im;
+				r_re.loadu(&g_re[b]);
+				r_im.loadu(&g_im[b]);
+				mipp::sqrt(r_re * r_re + r_im * r_im).store(&this->mod_gains[b]);
 			}
+			for (auto b = vec_loop_size; b < this->n_blocks; b++)
+				this->mod_gains[b] = std::sqrt(g_re[b] * g_re[b] + g_im[b] * g_im[b]);
+
+			for (auto b = 0; b < this->n_blocks; b++)
+				std::fill(H + b * this->gain_occur, H + std::min(this->n_symbols, (b +1) * this->gain_occur),
+				          this->mod_gains[b]);
 		}
-		for (auto i = 0; i < this->N; i++)
-			Y_N[i] += this->noise[i];
 	}
-	else
-	{
-		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
-		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+}
 
-		if (frame_id < 0)
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::apply_gains(const R *X_N, const R *H_N, const R *noise, R *Y_N) const
+{
+	if (this->complex)
+	{
+		for (auto n = 0; n < this->N; n += 2)
 		{
-			noise_generator->generate(this->gains, (R)1 / (R)std::sqrt((R)2));
-			noise_generator->generate(this->noise, this->sigma);
+			const auto y_re = (X_N[n   ] * H_N[n] - X_N[n +1] * H_N[n +1]) + noise[n   ];
+			const auto y_im = (X_N[n +1] * H_N[n] + X_N[n   ] * H_N[n +1]) + noise[n +1];
+			Y_N[n   ] = y_re;
+			Y_N[n +1] = y_im;
 		}
-		else
+	}
+	else
+	{
+		const auto vec_loop_size = (this->N / mipp::nElReg<R>()) * mipp::nElReg<R>();
+		for (auto n = 0; n < vec_loop_size; n += mipp::nElReg<R>())
 		{
-			noise_generator->generate(this->gains.data() + f_start * this->N, this->N, (R)1 / (R)std::sqrt((R)2));
-			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
+			mipp::Reg<R> r_x, r_h, r_n;
+			r_x.loadu(&X_N  [n]);
+			r_h.loadu(&H_N  [n]);
+			r_n.loadu(&noise[n]);
+			(r_x * r_h + r_n).storeu(&Y_N[n]);
 		}
+		for (auto n = vec_loop_size; n < this->N; n++)
+			Y_N[n] = X_N[n] * H_N[n] + noise[n];
+	}
+}
 
-		if (this->complex)
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id)
+{
+	if (add_users && this->n_frames > 1)
+	{
+		if (frame_id != -1)
 		{
-			for (auto f = f_start; f < f_stop; f++)
-			{
-				for (auto n = 0; n < this->N; n += 2)
-				{
-					const auto h_re = H_N[f * this->N + n   ] = this->gains[f * this->N + n   ];
-					const auto h_im = H_N[f * this->N + n +1] = this->gains[f * this->N + n +1];
+			std::stringstream message;
+			message << "'frame_id' has to be equal to -1 ('frame_id' = " << frame_id << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
 
-					const auto n_re = this->noise[f * this->N + n   ];
-					const auto n_im = this->noise[f * this->N + n +1];
+		this->generate_gains(H_N, 0, this->n_frames);
+		noise_generator->set_position(this->frame_index * this->N);
+		noise_generator->generate(Y_N, this->N, this->sigma);
+		this->frame_index += this->n_frames;
 
-					Y_N[f * this->N + n   ] = (X_N[f * this->N + n   ] * h_re - X_N[f * this->N + n +1] * h_im) + n_re;
-					Y_N[f * this->N + n +1] = (X_N[f * this->N + n +1] * h_re + X_N[f * this->N + n   ] * h_im) + n_im;
-				}
-			}
-		}
-		else
-		{
-			for (auto f = f_start; f < f_stop; f++)
-			{
-				for (auto n = 0; n < this->N; n++)
-				{
-					const auto h_re = this->gains[f * this->N + 2*n   ];
-					const auto h_im = this->gains[f * this->N + 2*n +1];
+		// the signals of all the users are added to the noise
+		for (auto f = 0; f < this->n_frames; f++)
+			this->apply_gains(X_N + f * this->N, H_N + f * this->N, Y_N, Y_N);
+	}
+	else
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
-					H_N[f * this->N + n] = std::sqrt(h_re * h_re + h_im * h_im);
-					Y_N[f * this->N + n] = X_N[f * this->N + n] * H_N[f * this->N + n] + this->noise[f * this->N + n];
-				}
-			}
-		}
+		this->generate_gains(H_N, f_start, f_stop);
+		noise_generator->set_position((this->frame_index + f_start) * this->N);
+		noise_generator->generate(this->noise.data() + f_start * this->N, (f_stop - f_start) * this->N, this->sigma);
+		if (f_stop == this->n_frames)
+			this->frame_index += this->n_frames;
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->apply_gains(X_N + f * this->N, H_N + f * this->N, this->noise.data() + f * this->N, Y_N + f * this->N);
 	}
 }
 
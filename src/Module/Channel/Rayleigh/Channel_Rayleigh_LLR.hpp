@@ -2,6 +2,7 @@
 #define CHANNEL_RAYLEIGH_LLR_HPP_
 
 #include <vector>
+#include <mipp.h>
 
 #include "Tools/Algo/Noise/Noise.hpp"
 #include "Tools/Algo/Noise/Standard/Noise_std.hpp"
@@ -12,23 +13,46 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Channel_Rayleigh_LLR
+ *
+ * \brief Flat Rayleigh fading channel.
+ *
+ * The same gain is held on 'gain_occur' consecutive symbols (block fading, 1 is the fast fading): only one complex
+ * gain per block is drawn. The gains are then expanded in H_N and the signal is computed in a single SIMD pass
+ * (Y_N = H_N * X_N + noise).
+ */
 template <typename R = float>
-class Channel_Rayleigh_LLR : public Channel<R> // flat Rayleigh fading channel
+class Channel_Rayleigh_LLR : public Channel<R>
 {
 private:
 	const bool complex;
 	const bool add_users;
-	std::vector<R> gains;
+	const int  gain_occur; // number of consecutive symbols with the same gain
+	const int  n_symbols;  // number of symbols per frame
+	const int  n_blocks;   // number of gains per frame
+	std::vector<R> gains;  // per frame: the 'n_blocks' real parts and then the 'n_blocks' imaginary parts
+	mipp::vector<R> mod_gains;
 	tools::Noise<R> *noise_generator;
 
 public:
 	Channel_Rayleigh_LLR(const int N, const bool complex, tools::Noise<R> *noise_generator = new tools::Noise_std<R>(),
-	                     const bool add_users = false, const R sigma = (R)1, const int n_frames = 1);
+	                     const bool add_users = false, const R sigma = (R)1, const int n_frames = 1,
+	                     const int gain_occurrences = 1);
 	Channel_Rayleigh_LLR(const int N, const bool complex, const int seed, const bool add_users = false,
-	                     const R sigma = (R)1, const int n_frames = 1);
+	                     const R sigma = (R)1, const int n_frames = 1, const int gain_occurrences = 1);
 	virtual ~Channel_Rayleigh_LLR();
 
 	virtual void add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise_wg;
+
+private:
+	void check_parameters() const;
+
+	// draw the gains of the frames [f_start, f_stop) and expand them in H_N
+	void generate_gains(R *H_N, const int f_start, const int f_stop);
+
+	// Y_N = H_N * X_N + noise on one frame ('noise' can be 'Y_N')
+	void apply_gains(const R *X_N, const R *H_N, const R *noise, R *Y_N) const;
 };
 }
 }
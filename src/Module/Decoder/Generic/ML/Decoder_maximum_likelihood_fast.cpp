@@ -0,0 +1,261 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/hard_decision.h"
+#include "Tools/Math/bits.h"
+
+#include "Decoder_maximum_likelihood_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// minimum number of candidates explored by a thread (below, dispatching a range costs more than it saves)
+static constexpr uint64_t min_candidates_per_thread = (uint64_t)1 << 12;
+
+template <typename B, typename R>
+Decoder_maximum_likelihood_fast<B,R>
+::Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming,
+                                  const int n_threads, const int n_frames)
+: Decoder                        (K, N,          n_frames, 1),
+  Decoder_maximum_likelihood<B,R>(K, N, encoder, n_frames   ),
+  hamming(hamming),
+  n_threads(n_threads),
+  n_words((N + 63) / 64),
+  n_bytes((N +  7) /  8),
+  G_rows(K * n_words, 0),
+  packed_Y_N(n_words, 0),
+  metric_tables(n_bytes * 256, 0.f),
+  best_u(0),
+  pool(nullptr)
+{
+	const std::string name = "Decoder_maximum_likelihood_fast";
+	this->set_name(name);
+
+	if (K >= 64)
+	{
+		std::stringstream message;
+		message << "'K' has to be smaller than 64 ('K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads > 1)
+		this->pool.reset(new tools::Work_stealing_pool(n_threads -1));
+
+	// the all-zero sequence has to give the all-zero codeword, otherwise the code is not linear
+	std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+	this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+	if (std::any_of(this->X_N.begin(), this->X_N.begin() + N, [](const B b) { return b != (B)0; }))
+	{
+		std::stringstream message;
+		message << "The encoder has to be linear (the all-zero sequence is not encoded in the all-zero codeword).";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the generator rows: the codeword of each information bit
+	for (auto k = 0; k < K; k++)
+	{
+		std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+		this->U_K[k] = (B)1;
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+
+		auto *row = this->G_rows.data() + k * this->n_words;
+		for (auto n = 0; n < N; n++)
+			if (this->X_N[n])
+				row[n >> 6] |= (uint64_t)1 << (n & 63);
+	}
+}
+
+template <typename B, typename R>
+Decoder_maximum_likelihood_fast<B,R>
+::~Decoder_maximum_likelihood_fast()
+{
+}
+
+template <typename B, typename R>
+template <typename M, class F>
+uint64_t Decoder_maximum_likelihood_fast<B,R>
+::explore(const uint64_t t_first, const uint64_t t_last, F metric, M &min_metric) const
+{
+	// codeword of the first sequence of the range: u = t ^ (t >> 1)
+	std::vector<uint64_t> cw(this->n_words, 0);
+	for (auto u = t_first ^ (t_first >> 1); u; u &= u -1)
+	{
+		const auto *g = this->G_rows.data() + tools::ctz(u) * this->n_words;
+		for (auto w = 0; w < this->n_words; w++)
+			cw[w] ^= g[w];
+	}
+
+	auto best_t = t_first;
+	for (auto t = t_first; t < t_last; t++)
+	{
+		// from the sequence t -1 to the sequence t, only the bit ctz(t) is flipped
+		if (t != t_first)
+		{
+			const auto *g = this->G_rows.data() + tools::ctz(t) * this->n_words;
+			for (auto w = 0; w < this->n_words; w++)
+				cw[w] ^= g[w];
+		}
+
+		const M cur_metric = metric(cw.data());
+		if (cur_metric < min_metric)
+		{
+			min_metric = cur_metric;
+			best_t     = t;
+		}
+	}
+
+	return best_t;
+}
+
+template <typename B, typename R>
+template <typename M, class F>
+void Decoder_maximum_likelihood_fast<B,R>
+::search(F metric)
+{
+	const auto n_candidates = (uint64_t)1 << this->K;
+	const auto n_th = (size_t)std::max((uint64_t)1, std::min((uint64_t)this->n_threads,
+	                                                         n_candidates / min_candidates_per_thread));
+	const auto chunk = (n_candidates + n_th -1) / n_th;
+
+	std::vector<uint64_t> best_t    (n_th, 0);
+	std::vector<M       > min_metric(n_th, std::numeric_limits<M>::max());
+
+	auto job = [&](const size_t th)
+	{
+		const auto t_first = th * chunk;
+		const auto t_last  = std::min(n_candidates, t_first + chunk);
+		if (t_first < t_last)
+			best_t[th] = this->explore<M>(t_first, t_last, metric, min_metric[th]);
+	};
+
+	for (size_t th = 1; th < n_th; th++)
+		this->pool->submit([&job, th]() { job(th); });
+	job(0);
+	if (n_th > 1)
+		this->pool->wait();
+
+	// the ranges are ordered: on a tie, the first candidate of the Gray sequence is kept whatever 'n_threads'
+	size_t best_th = 0;
+	for (size_t th = 1; th < n_th; th++)
+		if (min_metric[th] < min_metric[best_th])
+			best_th = th;
+
+	this->best_u = best_t[best_th] ^ (best_t[best_th] >> 1);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::store_best(B *V_N)
+{
+	std::vector<uint64_t> cw(this->n_words, 0);
+	for (auto u = this->best_u; u; u &= u -1)
+	{
+		const auto *g = this->G_rows.data() + tools::ctz(u) * this->n_words;
+		for (auto w = 0; w < this->n_words; w++)
+			cw[w] ^= g[w];
+	}
+
+	for (auto k = 0; k < this->K; k++)
+		this->best_U_K[k] = (B)((this->best_u >> k) & 1);
+
+	for (auto n = 0; n < this->N; n++)
+		V_N[n] = (B)((cw[n >> 6] >> (n & 63)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_siho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	// compute Hamming distance instead of Euclidean distance
+	if (hamming)
+	{
+		tools::hard_decide(Y_N, this->hard_Y_N.data(), this->N);
+		this->_decode_hiho_cw(this->hard_Y_N.data(), V_N, frame_id);
+	}
+	else
+	{
+		// the Euclidean distance between the LLRs and a codeword is (sum_n 1 + Y_N[n]^2) + 4 * (sum_{n, X_N[n] = 1}
+		// Y_N[n]): only the last sum is computed, with one lookup per byte of the packed codeword
+		for (auto b = 0; b < this->n_bytes; b++)
+		{
+			auto *table = this->metric_tables.data() + b * 256;
+			table[0] = 0.f;
+			for (auto v = 1; v < 256; v++)
+			{
+				const auto n = b * 8 + (int)tools::ctz(v);
+				table[v] = table[v & (v -1)] + ((n < this->N) ? (float)Y_N[n] : 0.f);
+			}
+		}
+
+		const auto n_bytes = this->n_bytes;
+		const auto *tables = this->metric_tables.data();
+		this->template search<float>([n_bytes, tables](const uint64_t *cw) -> float
+		{
+			auto metric = 0.f;
+			for (auto b = 0; b < n_bytes; b++)
+				metric += tables[b * 256 + ((cw[b >> 3] >> ((b & 7) * 8)) & 0xFF)];
+			return metric;
+		});
+
+		this->store_best(V_N);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_hiho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->packed_Y_N.begin(), this->packed_Y_N.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (Y_N[n])
+			this->packed_Y_N[n >> 6] |= (uint64_t)1 << (n & 63);
+
+	const auto n_words = this->n_words;
+	const auto *packed = this->packed_Y_N.data();
+	this->template search<uint32_t>([n_words, packed](const uint64_t *cw) -> uint32_t
+	{
+		uint32_t dist = 0;
+		for (auto w = 0; w < n_words; w++)
+			dist += tools::popcount(cw[w] ^ packed[w]);
+		return dist;
+	});
+
+	this->store_best(V_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
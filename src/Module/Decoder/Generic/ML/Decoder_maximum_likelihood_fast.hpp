@@ -0,0 +1,73 @@
+#ifndef DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+#define DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Threads/Work_stealing_pool.hpp"
+
+#include "Decoder_maximum_likelihood.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_maximum_likelihood_fast
+ *
+ * \brief Exhaustive ML decoder for linear codes which does not call the encoder during the decoding.
+ *
+ * The codeword of each information bit is computed once in the constructor and stored packed in 64-bit words (the
+ * rows of the generator matrix). The information sequences are then walked in Gray-code order: two consecutive
+ * sequences differ from one bit, so the next codeword is the current one XORed with a single generator row.
+ * The Hamming distance is computed with one popcount per 64-bit word and the Euclidean distance with one table lookup
+ * per byte of the packed codeword (the tables are built from the LLRs before the search).
+ * The 2^K candidates can be split in contiguous ranges of the Gray sequence processed by several threads (the threads
+ * are started once in the constructor and reused by all the decodings).
+ */
+template <typename B = int, typename R = float>
+class Decoder_maximum_likelihood_fast : public Decoder_maximum_likelihood<B,R>
+{
+protected:
+	const bool hamming;
+	const int  n_threads;
+	const int  n_words;           // number of 64-bit words of a packed codeword
+	const int  n_bytes;           // number of bytes of a packed codeword which carry bits
+	std::vector<uint64_t> G_rows; // packed codeword of each information bit (K x n_words)
+	std::vector<uint64_t> packed_Y_N;
+	std::vector<float>    metric_tables; // Euclidean metric of each value of each byte (n_bytes x 256)
+	uint64_t best_u;
+
+	// helper threads of the search (the calling thread explores the first range), nullptr if 'n_threads' == 1
+	std::unique_ptr<tools::Work_stealing_pool> pool;
+
+public:
+	Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming = false,
+	                                const int n_threads = 1, const int n_frames = 1);
+	virtual ~Decoder_maximum_likelihood_fast();
+
+protected:
+	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id);
+	void _decode_hiho   (const B *Y_N,  B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N,  B *V_N, const int frame_id);
+
+private:
+	// explore the Gray indexes [t_first, t_last) and return the best one ('min_metric' is updated)
+	template <typename M, class F>
+	uint64_t explore(const uint64_t t_first, const uint64_t t_last, F metric, M &min_metric) const;
+
+	// split the Gray sequence between the threads and keep the best candidate in 'best_u'
+	template <typename M, class F>
+	void search(F metric);
+
+	void store_best(B *V_N);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_ML_fast = Decoder_maximum_likelihood_fast<B,R>;
+}
+}
+
+#endif /* DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_ */
@@ -25,6 +25,7 @@ Decoder_LDPC_BP<B,R>
   Decoder_SISO_SIHO<B,R>(K, N, n_frames, simd_inter_frame_level),
   n_ite                 (n_ite                                 ),
   H                     (H                                     ),
+  Hc                    (H.get_compressed()                    ),
   enable_syndrome       (enable_syndrome                       ),
   syndrome_depth        (syndrome_depth                        ),
   cur_syndrome_depth    (0                                     )
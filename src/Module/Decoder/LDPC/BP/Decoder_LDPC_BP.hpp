@@ -1,6 +1,9 @@
 #ifndef DECODER_LDPC_BP_HPP_
 #define DECODER_LDPC_BP_HPP_
 
+#include <cmath>
+#include <cstdint>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
 #include "../../Decoder_SISO_SIHO.hpp"
@@ -15,6 +18,7 @@ class Decoder_LDPC_BP : public Decoder_SISO_SIHO<B,R>
 protected:
 	const int                   n_ite;
 	const tools::Sparse_matrix &H;
+	const tools::Sparse_matrix::Compressed &Hc; // flat representation of H (owned by H)
 	const bool                  enable_syndrome;
 	const int                   syndrome_depth;
 
@@ -36,24 +40,8 @@ public:
 	{
 		if (this->enable_syndrome)
 		{
-			auto syndrome = false;
-
-			const auto n_CN = (int)this->H.get_n_cols();
-			for (auto i = 0; i < n_CN; i++)
-			{
-				auto sign = 0;
-
-				const auto n_VN = (int)this->H[i].size();
-				for (auto j = 0; j < n_VN; j++)
-				{
-					const auto value = Y_N[this->H[i][j]];
-					const auto tmp_sign = std::signbit((float)value) ? -1 : 0;
-
-					sign ^= tmp_sign;
-				}
-
-				syndrome = syndrome || sign;
-			}
+			const auto syndrome = this->Hc.is_16bit ? this->template _syndrome<T,uint16_t,true>(Y_N, Hc.col_idx_16.data())
+			                                        : this->template _syndrome<T,unsigned,true>(Y_N, Hc.col_idx   .data());
 
 			this->cur_syndrome_depth = (syndrome == 0) ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
 
@@ -68,28 +56,38 @@ public:
 	{
 		if (this->enable_syndrome)
 		{
-			auto syndrome = false;
+			const auto syndrome = this->Hc.is_16bit ? this->template _syndrome<T,uint16_t,false>(V_N, Hc.col_idx_16.data())
+			                                        : this->template _syndrome<T,unsigned,false>(V_N, Hc.col_idx   .data());
 
-			const auto n_CN = (int)this->H.get_n_cols();
-			for (auto i = 0; i < n_CN; i++)
-			{
-				auto sign = 0;
+			this->cur_syndrome_depth = (syndrome == 0) ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
 
-				const auto n_VN = (int)this->H[i].size();
-				for (auto j = 0; j < n_VN; j++)
-				{
-					const auto bit = V_N[this->H[i][j]];
-					const auto tmp_sign = bit ? -1 : 0;
+			return (syndrome == 0) && (this->cur_syndrome_depth == 0);
+		}
 
-					sign ^= tmp_sign;
-				}
+		return false;
+	}
 
-				syndrome = syndrome || sign;
-			}
+private:
+	// return true if at least one parity check is not verified, 'col_idx' gives the VNs of each CN (flat CSC)
+	template <typename T, typename I, bool SOFT>
+	bool _syndrome(const T* X_N, const I* col_idx) const
+	{
+		const auto  n_CN    = (int)this->H.get_n_cols();
+		const auto *col_ptr = this->Hc.col_ptr.data();
+		for (auto i = 0; i < n_CN; i++)
+		{
+			auto sign = 0;
 
-			this->cur_syndrome_depth = (syndrome == 0) ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
+			for (auto j = col_ptr[i]; j < col_ptr[i +1]; j++)
+			{
+				const auto value = X_N[col_idx[j]];
+				const auto tmp_sign = (SOFT ? std::signbit((float)value) : (bool)value) ? -1 : 0;
 
-			return (syndrome == 0) && (this->cur_syndrome_depth == 0);
+				sign ^= tmp_sign;
+			}
+
+			if (sign)
+				return true;
 		}
 
 		return false;
@@ -0,0 +1,84 @@
+#include <limits>
+#include <typeinfo>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_flooding_AMS_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_min_i<R> MIN>
+Decoder_LDPC_BP_flooding_AMS_inter<B,R,MIN>
+::Decoder_LDPC_BP_flooding_AMS_inter(const int K, const int N, const int n_ite,
+                                     const tools::Sparse_matrix &H,
+                                     const std::vector<unsigned> &info_bits_pos,
+                                     const bool enable_syndrome,
+                                     const int syndrome_depth,
+                                     const int n_frames)
+: Decoder(K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_LDPC_BP_flooding_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames)
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_AMS_inter";
+	this->set_name(name);
+
+	if (typeid(R) != typeid(float) && typeid(R) != typeid(double))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "This decoder only supports floating-point LLRs.");
+}
+
+template <typename B, typename R, tools::proto_min_i<R> MIN>
+Decoder_LDPC_BP_flooding_AMS_inter<B,R,MIN>
+::~Decoder_LDPC_BP_flooding_AMS_inter()
+{
+}
+
+// approximate min-star implementation
+template <typename B, typename R, tools::proto_min_i<R> MIN>
+void Decoder_LDPC_BP_flooding_AMS_inter<B,R,MIN>
+::CN_process(const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V)
+{
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+
+	auto transpose_ptr = this->transpose.data();
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto length = this->n_variables_per_parity[i];
+
+		auto sign     = zero_msk;
+		auto min      = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto deltaMin = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+		// accumulate the incoming information in CN
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value  = V_to_C[transpose_ptr[j]];
+			const auto v_abs  = mipp::abs(value);
+			const auto v_temp = min;
+
+			sign    ^= mipp::sign(value);
+			min      = mipp::min(min, v_abs);
+			deltaMin = MIN(deltaMin, mipp::blend(v_temp, v_abs, v_abs == min));
+		}
+
+		auto delta = MIN(deltaMin, min);
+		delta    = mipp::max(zero, delta   );
+		deltaMin = mipp::max(zero, deltaMin);
+
+		// regenerate the CN outcoming values
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value = V_to_C[transpose_ptr[j]];
+			const auto v_abs = mipp::abs(value);
+			const auto v_res = mipp::blend(deltaMin, delta, v_abs == min);
+			const auto v_sig = sign ^ mipp::sign(value);
+
+			C_to_V[transpose_ptr[j]] = mipp::copysign(v_res, v_sig);
+		}
+
+		transpose_ptr += length;
+	}
+}
+}
+}
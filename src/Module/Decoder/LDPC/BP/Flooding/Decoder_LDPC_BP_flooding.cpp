@@ -28,6 +28,7 @@ Decoder_LDPC_BP_flooding<B,R>
   n_branches            ((int)H.get_n_connections()                                  ),
   init_flag             (true                                                        ),
   info_bits_pos         (info_bits_pos                                               ),
+  transpose             (this->Hc.col_to_row                                         ),
   Lp_N                  (N, -1                                                       ), // -1 in order to fail when AZCW
   C_to_V                (n_frames, std::vector<R>(this->n_branches)                  ),
   V_to_C                (n_frames, std::vector<R>(this->n_branches)                  )
@@ -35,46 +36,13 @@ Decoder_LDPC_BP_flooding<B,R>
 	const std::string name = "Decoder_LDPC_BP_flooding";
 	this->set_name(name);
 	
-	transpose.resize(this->n_branches);
-	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
-
-	const auto &CN_to_VN = H.get_col_to_rows();
-	const auto &VN_to_CN = H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
-	{
-		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
-
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
-			{
-				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
-				        << id_V << ", 'connections[id_V]' = " << connections[id_V] << ", 'VN_to_CN[id_V].size()' = "
-				        << VN_to_CN[id_V].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
-
 	n_variables_per_parity.resize(H.get_n_cols());
 	for (auto i = 0; i < (int)H.get_n_cols(); i++)
-		n_variables_per_parity[i] = (unsigned char)CN_to_VN[i].size();
+		n_variables_per_parity[i] = (unsigned char)(this->Hc.col_ptr[i +1] - this->Hc.col_ptr[i]);
 
 	n_parities_per_variable.resize(H.get_n_rows());
 	for (auto i = 0; i < (int)H.get_n_rows(); i++)
-		n_parities_per_variable[i] = (unsigned char)VN_to_CN[i].size();
+		n_parities_per_variable[i] = (unsigned char)(this->Hc.row_ptr[i +1] - this->Hc.row_ptr[i]);
 }
 
 template <typename B, typename R>
@@ -25,9 +25,10 @@ protected:
 
 	const std::vector<unsigned> &info_bits_pos;
 
+	const std::vector<unsigned> &transpose; // VN ordered position of each branch taken in the CN order (from H)
+
 	std::vector<unsigned char> n_variables_per_parity;
 	std::vector<unsigned char> n_parities_per_variable;
-	std::vector<unsigned int > transpose;
 
 	// data structures for iterative decoding
 	            std::vector<R>  Lp_N;   // a posteriori information
@@ -0,0 +1,245 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Decoder_LDPC_BP_flooding_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_inter<B,R>
+::Decoder_LDPC_BP_flooding_inter(const int K, const int N, const int n_ite,
+                                 const tools::Sparse_matrix &H,
+                                 const std::vector<unsigned> &info_bits_pos,
+                                 const bool enable_syndrome,
+                                 const int syndrome_depth,
+                                 const int n_frames)
+: Decoder               (K, N,                                            n_frames, mipp::nElReg<R>()),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, mipp::nElReg<R>()),
+  n_V_nodes             (N                                                                           ),
+  n_C_nodes             ((int)H.get_n_cols()                                                         ),
+  n_branches            ((int)H.get_n_connections()                                                  ),
+  init_flag             (true                                                                        ),
+  info_bits_pos         (info_bits_pos                                                               ),
+  transpose             (this->Hc.col_to_row                                                         ),
+  Y_N_reordered         (N                                                                           ),
+  Lp_N                  (N                                                                           ),
+  C_to_V                (this->n_dec_waves * this->n_branches                                        ),
+  V_to_C                (this->n_branches                                                            ),
+  V_reordered           (N                                                                           )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_inter";
+	this->set_name(name);
+
+	n_variables_per_parity.resize(H.get_n_cols());
+	for (auto i = 0; i < (int)H.get_n_cols(); i++)
+		n_variables_per_parity[i] = (unsigned char)(this->Hc.col_ptr[i +1] - this->Hc.col_ptr[i]);
+
+	n_parities_per_variable.resize(H.get_n_rows());
+	for (auto i = 0; i < (int)H.get_n_rows(); i++)
+		n_parities_per_variable[i] = (unsigned char)(this->Hc.row_ptr[i +1] - this->Hc.row_ptr[i]);
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_inter<B,R>
+::~Decoder_LDPC_BP_flooding_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::reset()
+{
+	this->init_flag = true;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		const auto zero = mipp::Reg<R>((R)0);
+		std::fill(this->C_to_V.begin() + (cur_wave +0) * this->n_branches,
+		          this->C_to_V.begin() + (cur_wave +1) * this->n_branches, zero);
+
+		if (cur_wave == this->n_dec_waves -1) this->init_flag = false;
+	}
+
+	std::vector<const R*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reordered.data(), this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		this->Lp_N[i] -= this->Y_N_reordered[i];
+
+	std::vector<R*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N2 + f * this->N;
+	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply_rev((R*)this->Lp_N.data(), frames, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		this->V_reordered[i] = mipp::cast<R,B>(this->Lp_N[k]) >> (sizeof(B) * 8 - 1);
+	}
+
+	std::vector<B*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)this->V_reordered.data(), frames, this->K);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->N; i++)
+		this->V_reordered[i] = mipp::cast<R,B>(this->Lp_N[i]) >> (sizeof(B) * 8 - 1);
+
+	std::vector<B*> frames(mipp::nElReg<R>());
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_N + f * this->N;
+	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)this->V_reordered.data(), frames, this->N);
+}
+
+// BP algorithm
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::BP_decode(const int frame_id)
+{
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+	auto C_to_V_wave = this->C_to_V.data() + cur_wave * this->n_branches;
+
+	auto cur_syndrome_depth = 0;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		this->VN_process(this->Y_N_reordered.data(), this->V_to_C.data(), C_to_V_wave, ite);
+		this->CN_process(this->V_to_C.data(), C_to_V_wave);
+
+		// stop criterion (all the frames of the wave have to be valid)
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			this->compute_post(this->Y_N_reordered.data(), C_to_V_wave, this->Lp_N.data());
+
+			if (this->check_syndrome())
+			{
+				cur_syndrome_depth++;
+				if (cur_syndrome_depth == this->syndrome_depth)
+					break;
+			}
+			else
+				cur_syndrome_depth = 0;
+		}
+	}
+
+	this->compute_post(this->Y_N_reordered.data(), C_to_V_wave, this->Lp_N.data());
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_flooding_inter<B,R>
+::check_syndrome()
+{
+	const auto zero = mipp::Msk<mipp::N<R>()>(false);
+	auto syndrome = zero;
+
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		auto sign = zero;
+
+		const auto n_VN = (int)this->H[i].size();
+		for (auto j = 0; j < n_VN; j++)
+			sign ^= mipp::sign(this->Lp_N[this->H[i][j]]);
+
+		syndrome |= sign;
+	}
+
+	return mipp::testz(syndrome);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::VN_process(const mipp::Reg<R> *Y_N, mipp::Reg<R> *V_to_C, const mipp::Reg<R> *C_to_V, const int /*ite*/)
+{
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		// VN node accumulate all the incoming messages
+		const auto length = this->n_parities_per_variable[i];
+
+		auto sum_C_to_V = mipp::Reg<R>((R)0);
+		for (auto j = 0; j < length; j++)
+			sum_C_to_V += C_to_V[j];
+
+		// update the intern values
+		const auto temp = Y_N[i] + sum_C_to_V;
+
+		// generate the outcoming messages to the CNs
+		for (auto j = 0; j < length; j++)
+			V_to_C[j] = temp - C_to_V[j];
+
+		C_to_V += length; // jump to the next node
+		V_to_C += length; // jump to the next node
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::compute_post(const mipp::Reg<R> *Y_N, const mipp::Reg<R> *C_to_V, mipp::Reg<R> *Lp_N)
+{
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		const auto length = this->n_parities_per_variable[i];
+
+		auto sum_C_to_V = mipp::Reg<R>((R)0);
+		for (auto j = 0; j < length; j++)
+			sum_C_to_V += C_to_V[j];
+
+		// filling the output
+		Lp_N[i] = Y_N[i] + sum_C_to_V;
+
+		C_to_V += length;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
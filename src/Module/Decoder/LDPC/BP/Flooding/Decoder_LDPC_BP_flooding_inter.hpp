@@ -0,0 +1,80 @@
+#ifndef DECODER_LDPC_BP_FLOODING_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_INTER_HPP_
+
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_inter
+ *
+ * \brief Flooding BP decoder which decodes mipp::nElReg<R>() frames at the same time (inter-frame SIMD).
+ *
+ * The frames are interleaved with the Reorderer: each element of the messages is a SIMD register which contains one
+ * value per frame. The messages of all the waves are stored in a single contiguous buffer.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_inter : public Decoder_LDPC_BP<B,R>
+{
+public:
+	void reset();
+
+protected:
+	const int  n_V_nodes;  // number of variable nodes (= N)
+	const int  n_C_nodes;  // number of check    nodes (= N - K)
+	const int  n_branches; // number of branched in the bi-partite graph (connexions between the V and C nodes)
+
+	// reset so C_to_V structure can be cleared only at the begining of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	const std::vector<unsigned> &transpose; // VN ordered position of each branch taken in the CN order (from H)
+
+	std::vector<unsigned char> n_variables_per_parity;
+	std::vector<unsigned char> n_parities_per_variable;
+
+	// data structures for iterative decoding
+	mipp::vector<mipp::Reg<R>> Y_N_reordered; // channel information of the current wave
+	mipp::vector<mipp::Reg<R>> Lp_N;          // a posteriori information
+	mipp::vector<mipp::Reg<R>> C_to_V;        // check    nodes to variable nodes messages (n_dec_waves * n_branches)
+	mipp::vector<mipp::Reg<R>> V_to_C;        // variable nodes to check    nodes messages (current wave)
+	mipp::vector<mipp::Reg<B>> V_reordered;
+
+	Decoder_LDPC_BP_flooding_inter(const int K, const int N, const int n_ite,
+	                               const tools::Sparse_matrix &H,
+	                               const std::vector<unsigned> &info_bits_pos,
+	                               const bool enable_syndrome = true,
+	                               const int syndrome_depth = 1,
+	                               const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_inter();
+
+	void _load          (const R *Y_N,           const int frame_id);
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const int frame_id);
+
+	bool check_syndrome();
+
+	// variable nodes update (sum of the incoming messages by default)
+	virtual void VN_process(const mipp::Reg<R> *Y_N, mipp::Reg<R> *V_to_C, const mipp::Reg<R> *C_to_V, const int ite);
+
+	// check nodes update (specific to the selected implementation)
+	virtual void CN_process(const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V) = 0;
+
+	// a posteriori information (sum of the incoming messages by default)
+	virtual void compute_post(const mipp::Reg<R> *Y_N, const mipp::Reg<R> *C_to_V, mipp::Reg<R> *Lp_N);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_INTER_HPP_ */
@@ -22,43 +22,11 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
   HY_N                  (N                                                           ),
   V_N                   (N                                                           ),
   C_to_V_messages       (H.get_n_connections(), 0                                    ),
-  V_to_C_messages       (H.get_n_connections(), 0                                    )
+  V_to_C_messages       (H.get_n_connections(), 0                                    ),
+  transpose             (this->Hc.col_to_row                                         )
 {
 	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A";
 	this->set_name(name);
-	
-	transpose.resize(H.get_n_connections());
-	std::vector<unsigned char> connections(H.get_n_rows(), 0);
-
-	const auto &CN_to_VN = H.get_col_to_rows();
-	const auto &VN_to_CN = H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
-	{
-		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
-
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
-			{
-				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' "
-				        << "('id_V' = " << id_V << ", 'connections[id_V]' = " << connections[id_V]
-				        << ", 'VN_to_CN[id_V].size()' = " << VN_to_CN[id_V].size() << ")'.";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
 }
 
 template <typename B, typename R>
@@ -71,6 +39,9 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode(const B *Y_N)
 {
+	const auto &row_ptr = this->Hc.row_ptr;
+	const auto &col_ptr = this->Hc.col_ptr;
+
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
 		auto C_to_V_mess_ptr = C_to_V_messages.data();
@@ -79,7 +50,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		// V -> C (for each variable nodes)
 		for (auto i = 0; i < (int)this->H.get_n_rows(); i++)
 		{
-			const auto node_degree = (int)this->H.get_row_to_cols()[i].size();
+			const auto node_degree = (int)(row_ptr[i +1] - row_ptr[i]);
 
 			for (auto j = 0; j < node_degree; j++)
 			{
@@ -105,7 +76,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		auto transpose_ptr = this->transpose.data();
 		for (auto i = 0; i < (int)this->H.get_n_cols(); i++)
 		{
-			const auto node_degree = (int)this->H.get_col_to_rows()[i].size();
+			const auto node_degree = (int)(col_ptr[i +1] - col_ptr[i]);
 
 			// accumulate the incoming information in CN
 			auto acc = 0;
@@ -125,7 +96,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 			// for the K variable nodes (make a majority vote with the entering messages)
 			for (auto i = 0; i < this->N; i++)
 			{
-				const auto node_degree = (int)this->H.get_row_to_cols()[i].size();
+				const auto node_degree = (int)(row_ptr[i +1] - row_ptr[i]);
 				auto count = 0;
 
 				for (auto j = 0; j < node_degree; j++)
@@ -149,7 +120,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	// for the K variable nodes (make a majority vote with the entering messages)
 	for (auto i = 0; i < this->N; i++)
 	{
-		const auto node_degree = (int)this->H.get_row_to_cols()[i].size();
+		const auto node_degree = (int)(row_ptr[i +1] - row_ptr[i]);
 		auto count = 0;
 
 		for (auto j = 0; j < node_degree; j++)
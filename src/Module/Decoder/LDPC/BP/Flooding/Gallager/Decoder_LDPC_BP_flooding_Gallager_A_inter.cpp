@@ -0,0 +1,124 @@
+#include "Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite,
+                                            const tools::Sparse_matrix &H,
+                                            const std::vector<unsigned> &info_bits_pos,
+                                            const bool enable_syndrome,
+                                            const int syndrome_depth,
+                                            const int n_frames)
+: Decoder(K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_LDPC_BP_flooding_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames)
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::~Decoder_LDPC_BP_flooding_Gallager_A_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::VN_process(const mipp::Reg<R> *Y_N, mipp::Reg<R> *V_to_C, const mipp::Reg<R> *C_to_V, const int ite)
+{
+	const auto zero      = mipp::Reg<R>((R) 0);
+	const auto one       = mipp::Reg<R>((R) 1);
+	const auto minus_one = mipp::Reg<R>((R)-1);
+
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		const auto length    = this->n_parities_per_variable[i];
+		const auto cur_state = mipp::blend(minus_one, one, Y_N[i] < zero); // hard decision on the channel
+
+		if (ite > 0)
+		{
+			// count the CN messages which disagree with the channel
+			auto count = zero;
+			for (auto j = 0; j < length; j++)
+				count += mipp::blend(one, zero, C_to_V[j] != cur_state);
+
+			// flip the channel bit if all the other CN messages disagree with it
+			const auto n_others = mipp::Reg<R>((R)(length -1));
+			for (auto j = 0; j < length; j++)
+			{
+				const auto others = count - mipp::blend(one, zero, C_to_V[j] != cur_state);
+				V_to_C[j] = mipp::blend(zero - cur_state, cur_state, others == n_others);
+			}
+		}
+		else
+			for (auto j = 0; j < length; j++)
+				V_to_C[j] = cur_state;
+
+		C_to_V += length; // jump to the next node
+		V_to_C += length; // jump to the next node
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::CN_process(const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V)
+{
+	const auto one = mipp::Reg<R>((R)1);
+
+	auto transpose_ptr = this->transpose.data();
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto length = this->n_variables_per_parity[i];
+
+		// accumulate the incoming information in CN (the product of +1/-1 values is a XOR on the bits)
+		auto acc = one;
+		for (auto j = 0; j < length; j++)
+			acc *= V_to_C[transpose_ptr[j]];
+
+		// regenerate the CN outcoming values
+		for (auto j = 0; j < length; j++)
+			C_to_V[transpose_ptr[j]] = acc * V_to_C[transpose_ptr[j]];
+
+		transpose_ptr += length; // jump to the next node
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::compute_post(const mipp::Reg<R> *Y_N, const mipp::Reg<R> *C_to_V, mipp::Reg<R> *Lp_N)
+{
+	const auto zero      = mipp::Reg<R>((R) 0);
+	const auto one       = mipp::Reg<R>((R) 1);
+	const auto minus_one = mipp::Reg<R>((R)-1);
+
+	// make a majority vote with the entering messages (a negative vote gives a bit 1)
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		const auto length = this->n_parities_per_variable[i];
+
+		auto vote = zero;
+		for (auto j = 0; j < length; j++)
+			vote += C_to_V[j];
+
+		if (length % 2 == 0)
+			vote += mipp::blend(minus_one, one, Y_N[i] < zero);
+
+		Lp_N[i] = vote;
+
+		C_to_V += length;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,41 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+
+#include "../Decoder_LDPC_BP_flooding_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_Gallager_A_inter
+ *
+ * \brief Gallager A decoder (inter-frame SIMD), the hard messages are stored as +1 (bit 0) or -1 (bit 1).
+ *
+ * Like the sequential Gallager A decoder, it is a hard decision decoder: it is only built as a SIHO decoder.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_A_inter : public Decoder_LDPC_BP_flooding_inter<B,R>
+{
+public:
+	Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite,
+	                                          const tools::Sparse_matrix &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_A_inter();
+
+protected:
+	virtual void VN_process  (const mipp::Reg<R> *Y_N, mipp::Reg<R> *V_to_C, const mipp::Reg<R> *C_to_V,
+	                          const int ite);
+	virtual void CN_process  (const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V);
+	virtual void compute_post(const mipp::Reg<R> *Y_N, const mipp::Reg<R> *C_to_V, mipp::Reg<R> *Lp_N);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALA_inter = Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_ */
@@ -0,0 +1,94 @@
+#include <limits>
+#include <typeinfo>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_flooding_LSPA_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_LSPA_inter<B,R>
+::Decoder_LDPC_BP_flooding_LSPA_inter(const int K, const int N, const int n_ite,
+                                      const tools::Sparse_matrix &H,
+                                      const std::vector<unsigned> &info_bits_pos,
+                                      const bool enable_syndrome,
+                                      const int syndrome_depth,
+                                      const int n_frames)
+: Decoder(K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_LDPC_BP_flooding_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames),
+  values(H.get_cols_max_degree())
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_LSPA_inter";
+	this->set_name(name);
+
+	if (typeid(R) != typeid(float) && typeid(R) != typeid(double))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "This decoder only supports floating-point LLRs.");
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_LSPA_inter<B,R>
+::~Decoder_LDPC_BP_flooding_LSPA_inter()
+{
+}
+
+// log sum-product implementation
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_LSPA_inter<B,R>
+::CN_process(const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V)
+{
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+	const auto one      = mipp::Reg<R>((R)1);
+	const auto r_min    = mipp::Reg<R>(std::numeric_limits<R>::min());
+	const auto one_eps  = mipp::Reg<R>((R)1 - std::numeric_limits<R>::epsilon());
+
+	auto transpose_ptr = this->transpose.data();
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto length = this->n_variables_per_parity[i];
+
+		auto sign = zero_msk;
+		auto sum  = zero;
+
+		// accumulate the incoming information in CN
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value     = V_to_C[transpose_ptr[j]];
+			const auto e         = mipp::exp(zero - mipp::abs(value));
+			const auto tan_v_abs = (one - e) / (one + e); // tanh(|value| / 2)
+			const auto res       = mipp::blend(mipp::log(tan_v_abs), r_min, tan_v_abs != zero);
+
+			sign ^= mipp::sign(value);
+			sum  += res;
+			values[j] = res;
+		}
+
+		// regenerate the CN outcoming values
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value = V_to_C[transpose_ptr[j]];
+			const auto v_sig = sign ^ mipp::sign(value);
+			const auto diff  = sum - values[j];
+			const auto exp   = mipp::blend(mipp::exp(diff), one_eps, diff != zero);
+			const auto v_res = mipp::log((one + exp) / (one - exp)); // 2 * atanh(exp)
+
+			C_to_V[transpose_ptr[j]] = mipp::copysign(v_res, v_sig);
+		}
+
+		transpose_ptr += length;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_LSPA_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_LSPA_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_LSPA_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_LSPA_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_LSPA_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
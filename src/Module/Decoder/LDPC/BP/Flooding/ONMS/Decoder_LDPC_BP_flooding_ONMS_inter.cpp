@@ -0,0 +1,166 @@
+#include <limits>
+#include <sstream>
+#include <typeinfo>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_flooding_ONMS_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+//                                                                                                        normalization
+template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
+{
+	return val * mipp::Reg<R>((R)factor);
+}
+template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
+template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
+template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
+template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
+template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
+template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
+template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
+template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::Decoder_LDPC_BP_flooding_ONMS_inter(const int K, const int N, const int n_ite,
+                                      const tools::Sparse_matrix &H,
+                                      const std::vector<unsigned> &info_bits_pos,
+                                      const float normalize_factor,
+                                      const R offset,
+                                      const bool enable_syndrome,
+                                      const int syndrome_depth,
+                                      const int n_frames)
+: Decoder(K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_LDPC_BP_flooding_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames),
+  normalize_factor(normalize_factor), offset(offset), normalize_id(0)
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_ONMS_inter";
+	this->set_name(name);
+
+	if (typeid(R) == typeid(signed char))
+	{
+		std::stringstream message;
+		message << "This decoder does not work in 8-bit fixed-point (try in 16-bit).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (typeid(R) == typeid(short))
+	{
+		     if (normalize_factor == 0.125f) normalize_id = 1;
+		else if (normalize_factor == 0.250f) normalize_id = 2;
+		else if (normalize_factor == 0.375f) normalize_id = 3;
+		else if (normalize_factor == 0.500f) normalize_id = 4;
+		else if (normalize_factor == 0.625f) normalize_id = 5;
+		else if (normalize_factor == 0.750f) normalize_id = 6;
+		else if (normalize_factor == 0.875f) normalize_id = 7;
+		else if (normalize_factor == 1.000f) normalize_id = 8;
+		else
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else if (normalize_factor == 1.000f) // float or double
+		normalize_id = 8;
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::~Decoder_LDPC_BP_flooding_ONMS_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::CN_process(const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V)
+{
+	switch (normalize_id)
+	{
+		case 1: this->template _CN_process<1>(V_to_C, C_to_V); break;
+		case 2: this->template _CN_process<2>(V_to_C, C_to_V); break;
+		case 3: this->template _CN_process<3>(V_to_C, C_to_V); break;
+		case 4: this->template _CN_process<4>(V_to_C, C_to_V); break;
+		case 5: this->template _CN_process<5>(V_to_C, C_to_V); break;
+		case 6: this->template _CN_process<6>(V_to_C, C_to_V); break;
+		case 7: this->template _CN_process<7>(V_to_C, C_to_V); break;
+		case 8: this->template _CN_process<8>(V_to_C, C_to_V); break;
+		default: this->template _CN_process<0>(V_to_C, C_to_V); break;
+	}
+}
+
+// normalized offest min-sum implementation
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_CN_process(const mipp::Reg<R> *V_to_C, mipp::Reg<R> *C_to_V)
+{
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+	const auto r_offset = mipp::Reg<R>(offset);
+
+	auto transpose_ptr = this->transpose.data();
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto length = this->n_variables_per_parity[i];
+
+		auto sign = zero_msk;
+		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+		// accumulate the incoming information in CN
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value  = V_to_C[transpose_ptr[j]];
+			const auto v_abs  = mipp::abs (value);
+			const auto c_sign = mipp::sign(value);
+			const auto v_temp = min1;
+
+			sign ^= c_sign;
+			min1  = mipp::min(min1,           v_abs         ); // 1st min
+			min2  = mipp::min(min2, mipp::max(v_abs, v_temp)); // 2nd min
+		}
+
+		auto cste1 = simd_normalize<R,F>(min2 - r_offset, normalize_factor);
+		auto cste2 = simd_normalize<R,F>(min1 - r_offset, normalize_factor);
+		cste1 = mipp::blend(zero, cste1, zero > cste1);
+		cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+		// regenerate the CN outcoming values
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value = V_to_C[transpose_ptr[j]];
+			const auto v_abs = mipp::abs(value);
+			const auto v_res = mipp::blend(cste1, cste2, v_abs == min1);
+			const auto v_sig = sign ^ mipp::sign(value);
+
+			C_to_V[transpose_ptr[j]] = mipp::copysign(v_res, v_sig);
+		}
+
+		transpose_ptr += length;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -39,6 +39,17 @@ Decoder_LDPC_BP_layered_log_sum_product<B,R>
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_log_sum_product<B,R>
 ::BP_process(std::vector<R> &var_nodes, std::vector<R> &branches)
+{
+	if (this->Hc.is_16bit)
+		this->_BP_process(this->Hc.col_idx_16.data(), var_nodes, branches);
+	else
+		this->_BP_process(this->Hc.col_idx   .data(), var_nodes, branches);
+}
+
+template <typename B, typename R>
+template <typename I>
+void Decoder_LDPC_BP_layered_log_sum_product<B,R>
+::_BP_process(const I *col_idx, std::vector<R> &var_nodes, std::vector<R> &branches)
 {
 	auto kr = 0;
 	auto kw = 0;
@@ -47,10 +58,11 @@ void Decoder_LDPC_BP_layered_log_sum_product<B,R>
 		auto sign =    0;
 		auto sum  = (R)0;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto  n_VN  = (int)(this->Hc.col_ptr[i +1] - this->Hc.col_ptr[i]);
+		const auto *VN_id = col_idx + this->Hc.col_ptr[i];
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]     = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]     = var_nodes[VN_id[j]] - branches[kr++];
 			const auto v_abs     = (R)std::abs(contributions[j]);
 			const auto tan_v_abs = std::tanh(v_abs * (R)0.5);
 			const auto res       = (tan_v_abs != 0) ? (R)std::log(tan_v_abs) : std::numeric_limits<R>::min();
@@ -71,7 +83,7 @@ void Decoder_LDPC_BP_layered_log_sum_product<B,R>
 			const auto v_res = (R)std::copysign(v_tan, v_sig);
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[VN_id[j]] = contributions[j] + v_res;
 		}
 	}
 }
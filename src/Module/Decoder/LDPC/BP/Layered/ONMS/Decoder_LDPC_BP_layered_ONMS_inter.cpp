@@ -276,10 +276,11 @@ bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	{
 		auto sign = zero;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto  n_VN  = (int)(this->Hc.col_ptr[i +1] - this->Hc.col_ptr[i]);
+		const auto *VN_id = this->Hc.col_idx.data() + this->Hc.col_ptr[i];
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto value = this->var_nodes[cur_wave][this->H[i][j]];// - this->branches[cur_wave][k++];
+			const auto value = this->var_nodes[cur_wave][VN_id[j]];// - this->branches[cur_wave][k++];
 			sign ^= mipp::sign(value);
 		}
 
@@ -340,10 +341,11 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
 		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto  n_VN  = (int)(this->Hc.col_ptr[i +1] - this->Hc.col_ptr[i]);
+		const auto *VN_id = this->Hc.col_idx.data() + this->Hc.col_ptr[i];
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = var_nodes[VN_id[j]] - branches[kr++];
 			const auto v_abs  = mipp::abs (contributions[j]);
 			const auto c_sign = mipp::sign(contributions[j]);
 			const auto v_temp = min1;
@@ -368,7 +370,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			           v_res = mipp::copysign(v_res, v_sig);
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[VN_id[j]] = contributions[j] + v_res;
 		}
 	}
 }
@@ -78,6 +78,17 @@ Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
 ::BP_process(std::vector<R> &var_nodes, std::vector<R> &branches)
+{
+	if (this->Hc.is_16bit)
+		this->_BP_process(this->Hc.col_idx_16.data(), var_nodes, branches);
+	else
+		this->_BP_process(this->Hc.col_idx   .data(), var_nodes, branches);
+}
+
+template <typename B, typename R>
+template <typename I>
+void Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
+::_BP_process(const I *col_idx, std::vector<R> &var_nodes, std::vector<R> &branches)
 {
 	auto kr = 0;
 	auto kw = 0;
@@ -87,10 +98,11 @@ void Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
 		auto min1 = std::numeric_limits<R>::max();
 		auto min2 = std::numeric_limits<R>::max();
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto  n_VN  = (int)(this->Hc.col_ptr[i +1] - this->Hc.col_ptr[i]);
+		const auto *VN_id = col_idx + this->Hc.col_ptr[i];
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = var_nodes[VN_id[j]] - branches[kr++];
 			const auto v_abs  = (R)std::abs(contributions[j]);
 			const auto c_sign = std::signbit((float)contributions[j]) ? -1 : 0;
 			const auto v_temp = min1;
@@ -114,7 +126,7 @@ void Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
 			           v_res = (R)std::copysign(v_res, v_sig);               // magnitude of v_res, sign of v_sig
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[VN_id[j]] = contributions[j] + v_res;
 		}
 	}
 }
@@ -25,6 +25,10 @@ public:
 
 protected:
 	void BP_process(std::vector<R> &var_nodes, std::vector<R> &branches);
+
+	// 'col_idx' gives the VNs connected to each CN (flat CSC representation of H with 16-bit or 32-bit indexes)
+	template <typename I>
+	void _BP_process(const I *col_idx, std::vector<R> &var_nodes, std::vector<R> &branches);
 };
 
 template <typename B = int, typename R = float>
@@ -0,0 +1,91 @@
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_HPP_
+#define DECODER_POLAR_SCAN_FAST_SYS_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+#include "Module/CRC/CRC.hpp"
+
+#include "../../Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCAN_fast_sys
+ *
+ * \brief Soft CANcellation (SCAN) decoder of systematic polar codes working on the pruned tree of the
+ *        Pattern_polar_parser.
+ *
+ * The L (left to right) and B (right to left) messages of a node are stored at the node positions of the layer
+ * 'rev_depth' (like in the Decoder_polar_SCAN_naive) and the updates of the standard nodes are made with the f and g0
+ * functions of the API_polar (seq, intra or inter-frame SIMD):
+ *     L_left  = f (L_a,    g0(L_b,    B_right)),  L_right = g0(L_b,    f(B_left, L_a)),
+ *     B_a     = f (B_left, g0(B_right, L_b   )),  B_b     = g0(B_right, f(B_left, L_a)).
+ * The B messages of the rate 0 (+inf) and rate 1 (0) nodes are constant, the B messages of the repetition (sum of the
+ * other L) and SPC (min-sum of the other L) nodes are computed directly. The decoding stops before 'max_iter' if the
+ * CRC is verified (when a CRC is given) or if the hard decisions did not change since the previous iteration (when
+ * 'conv_stop' is true), in all the frames decoded at once.
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_seq<B,R>>
+class Decoder_polar_SCAN_fast_sys : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	static constexpr int n_fra = API_polar::get_n_frames(); // number of frames decoded at once
+
+	const int                         m;        // graph depth
+	const int                         max_iter;
+	const std::vector<bool>&          frozen_bits;
+	      tools::Pattern_polar_parser polar_patterns;
+	      CRC<B>                     *crc;      // early termination when the CRC is verified (if not nullptr)
+	const bool                        conv_stop; // early termination when the hard decisions do not change
+
+	std::vector<mipp::vector<R>> soft_graph;     // the L messages of each layer (interleaved frames)
+	std::vector<mipp::vector<R>> feedback_graph; // the B messages of each layer (interleaved frames)
+	mipp::vector<R>              l_tmp;
+	mipp::vector<B>              s;              // hard decisions on the codewords
+	mipp::vector<B>              s_prev;         // hard decisions of the previous iteration
+	mipp::vector<B>              U_test;         // information bits to be checked by the CRC
+
+public:
+	Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+	                            CRC<B> *crc = nullptr, const bool conv_stop = false, const int n_frames = 1);
+
+	Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+	                            const std::vector<tools::Pattern_polar_i*> &polar_patterns,
+	                            const int idx_r0, const int idx_r1,
+	                            CRC<B> *crc = nullptr, const bool conv_stop = false, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCAN_fast_sys();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load          (const R *Y_N                                         );
+	        void _decode        (                                                     );
+	        void _decode_siso   (const R *sys, const R *par, R *ext, const int frame_id);
+	        void _decode_siso   (const R *Y_N1, R *Y_N2,             const int frame_id);
+	        void _decode_siho   (const R *Y_N,  B *V_K,              const int frame_id);
+	        void _decode_siho_cw(const R *Y_N,  B *V_N,              const int frame_id);
+	        void _store         (B *V_KN, const bool coded = false                   ) const;
+
+	void init_feedback_graph();
+	bool is_done            ();
+
+private:
+	void recursive_init_feedback(const int off, const int rev_depth, int &node_id);
+	void recursive_decode       (const int off, const int rev_depth, int &node_id);
+	void update_rep             (const int off, const int rev_depth              );
+	void update_spc             (const int off, const int rev_depth              );
+	void compute_hard_decisions (                                                );
+};
+}
+}
+
+#include "Decoder_polar_SCAN_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_HPP_ */
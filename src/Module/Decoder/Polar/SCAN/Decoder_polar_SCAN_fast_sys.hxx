@@ -0,0 +1,442 @@
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+                              CRC<B> *crc, const bool conv_stop, const int n_frames)
+: Decoder_polar_SCAN_fast_sys<B,R,API_polar>(K, N, max_iter, frozen_bits,
+                                             {new tools::Pattern_polar_std,
+                                              new tools::Pattern_polar_r0_left,
+                                              new tools::Pattern_polar_r0,
+                                              new tools::Pattern_polar_r1,
+                                              new tools::Pattern_polar_rep_left,
+                                              new tools::Pattern_polar_rep,
+                                              new tools::Pattern_polar_spc},
+                                             2,
+                                             3,
+                                             crc,
+                                             conv_stop,
+                                             n_frames)
+{
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+                              const std::vector<tools::Pattern_polar_i*> &polar_patterns,
+                              const int idx_r0, const int idx_r1,
+                              CRC<B> *crc, const bool conv_stop, const int n_frames)
+: Decoder               (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                     ((int)std::log2(N)),
+  max_iter              (max_iter),
+  frozen_bits           (frozen_bits),
+  polar_patterns        (N, frozen_bits, polar_patterns, idx_r0, idx_r1),
+  crc                   (crc),
+  conv_stop             (conv_stop),
+  soft_graph            (m +1, mipp::vector<R>(N * n_fra)),
+  feedback_graph        (m +1, mipp::vector<R>(N * n_fra)),
+  l_tmp                 (N * n_fra),
+  s                     (N * n_fra),
+  s_prev                (N * n_fra),
+  U_test                (K)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (crc != nullptr && crc->get_size() > K)
+	{
+		std::stringstream message;
+		message << "'crc->get_size()' has to be equal or smaller than 'K' ('crc->get_size()' = " << crc->get_size()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::~Decoder_polar_SCAN_fast_sys()
+{
+	polar_patterns.release_patterns();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	if (n_fra == 1)
+		std::copy(Y_N, Y_N + this->N, soft_graph[m].begin());
+	else
+	{
+		std::vector<const R*> frames(n_fra);
+		for (auto f = 0; f < n_fra; f++)
+			frames[f] = Y_N + f * this->N;
+		tools::Reorderer_static<R,n_fra>::apply(frames, soft_graph[m].data(), this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::init_feedback_graph()
+{
+	for (auto d = 0; d <= m; d++)
+		std::fill(feedback_graph[d].begin(), feedback_graph[d].end(), tools::init_LLR<R>());
+
+	int first_node_id = 0;
+	recursive_init_feedback(0, m, first_node_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::recursive_init_feedback(const int off, const int rev_depth, int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (node_type == tools::polar_node_t::RATE_0)
+		std::fill(feedback_graph[rev_depth].begin() + (off          ) * n_fra,
+		          feedback_graph[rev_depth].begin() + (off + n_elmts) * n_fra,
+		          tools::sat_val<R>());
+	else if (!is_terminal_pattern && rev_depth)
+	{
+		recursive_init_feedback(off,           rev_depth -1, ++node_id); // recursive call left
+		recursive_init_feedback(off + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode()
+{
+	this->init_feedback_graph();
+
+	for (auto ite = 0; ite < max_iter; ite++)
+	{
+		int first_node_id = 0;
+		recursive_decode(0, m, first_node_id);
+
+		if (ite < max_iter -1 && (crc != nullptr || conv_stop))
+		{
+			this->compute_hard_decisions();
+
+			auto converged = false;
+			if (conv_stop)
+			{
+				converged = ite > 0 && std::equal(s.begin(), s.end(), s_prev.begin());
+				std::copy(s.begin(), s.end(), s_prev.begin());
+			}
+
+			if (converged || this->is_done())
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::recursive_decode(const int off, const int rev_depth, int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && rev_depth)
+	{
+		const auto l_a = soft_graph    [rev_depth   ].data() + off * n_fra, l_b = l_a + n_elm_2 * n_fra;
+		const auto l_l = soft_graph    [rev_depth -1].data() + off * n_fra, l_r = l_l + n_elm_2 * n_fra;
+		const auto b_l = feedback_graph[rev_depth -1].data() + off * n_fra, b_r = b_l + n_elm_2 * n_fra;
+		const auto b_a = feedback_graph[rev_depth   ].data() + off * n_fra, b_b = b_a + n_elm_2 * n_fra;
+		const auto tmp = l_tmp.data();
+
+		if (node_type == tools::RATE_0_LEFT)
+		{
+			// the B messages of the left node are +inf: f(+inf, x) = x
+			recursive_decode(off, rev_depth -1, ++node_id); // recursive call left
+
+			API_polar::g0(l_a, l_b, l_r, n_elm_2);
+
+			recursive_decode(off + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+			API_polar::g0(b_r, l_b, b_a, n_elm_2);
+			API_polar::g0(b_r, l_a, b_b, n_elm_2);
+		}
+		else
+		{
+			// the B messages of the right node come from the previous iteration
+			API_polar::g0(l_b, b_r, tmp, n_elm_2);
+			API_polar::f (l_a, tmp, l_l, n_elm_2);
+
+			recursive_decode(off, rev_depth -1, ++node_id); // recursive call left
+
+			API_polar::f (b_l, l_a, tmp, n_elm_2);
+			API_polar::g0(l_b, tmp, l_r, n_elm_2);
+
+			recursive_decode(off + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+			API_polar::g0(b_r, l_b, tmp, n_elm_2);
+			API_polar::f (b_l, tmp, b_a, n_elm_2);
+			API_polar::f (b_l, l_a, tmp, n_elm_2);
+			API_polar::g0(b_r, tmp, b_b, n_elm_2);
+		}
+	}
+	else // leaf node (the B messages of the rate 0 and rate 1 nodes are constant)
+	{
+		switch (node_type)
+		{
+			case tools::REP: update_rep(off, rev_depth); break;
+			case tools::SPC: update_spc(off, rev_depth); break;
+			default:
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::update_rep(const int off, const int rev_depth)
+{
+	using W = typename std::conditional<std::is_floating_point<R>::value, R, int>::type;
+
+	const int n_elmts = 1 << rev_depth;
+	const auto l = soft_graph    [rev_depth].data() + off * n_fra;
+	const auto b = feedback_graph[rev_depth].data() + off * n_fra;
+
+	// the B message of a bit is the sum of the L messages of the other bits
+	W sum[n_fra];
+	std::fill(sum, sum + n_fra, (W)0);
+	for (auto i = 0; i < n_elmts; i++)
+		for (auto f = 0; f < n_fra; f++)
+			sum[f] += (W)l[i * n_fra + f];
+
+	for (auto i = 0; i < n_elmts; i++)
+		for (auto f = 0; f < n_fra; f++)
+			b[i * n_fra + f] = (R)tools::saturate<W>(sum[f] - (W)l[i * n_fra + f],
+			                                         -(W)tools::sat_val<R>(), (W)tools::sat_val<R>());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::update_spc(const int off, const int rev_depth)
+{
+	const int n_elmts = 1 << rev_depth;
+	const auto l = soft_graph    [rev_depth].data() + off * n_fra;
+	const auto b = feedback_graph[rev_depth].data() + off * n_fra;
+
+	// the B message of a bit is the min-sum of the L messages of the other bits
+	bool sign[n_fra];
+	R    min1[n_fra], min2[n_fra];
+	int  pos [n_fra];
+	std::fill(sign, sign + n_fra, false);
+	std::fill(min1, min1 + n_fra, std::numeric_limits<R>::max());
+	std::fill(min2, min2 + n_fra, std::numeric_limits<R>::max());
+	std::fill(pos,  pos  + n_fra, 0);
+
+	for (auto i = 0; i < n_elmts; i++)
+		for (auto f = 0; f < n_fra; f++)
+		{
+			const auto v = l[i * n_fra + f];
+			const auto a = (R)std::abs(v);
+
+			sign[f] ^= (v < 0);
+			if (a < min1[f])
+			{
+				min2[f] = min1[f];
+				min1[f] = a;
+				pos [f] = i;
+			}
+			else if (a < min2[f])
+				min2[f] = a;
+		}
+
+	for (auto i = 0; i < n_elmts; i++)
+		for (auto f = 0; f < n_fra; f++)
+		{
+			const auto a = (i == pos[f]) ? min2[f] : min1[f];
+			b[i * n_fra + f] = (sign[f] ^ (l[i * n_fra + f] < 0)) ? -a : a;
+		}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::compute_hard_decisions()
+{
+	const auto &l = soft_graph    [m];
+	const auto &b = feedback_graph[m];
+	for (auto i = 0; i < this->N * n_fra; i++)
+		s[i] = tools::h_LLR<B,R>(tools::g0_LLR<R>(l[i], b[i]));
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::is_done()
+{
+	if (crc == nullptr)
+		return false;
+
+	// the information bits are the systematic bits, the CRC has to be verified in all the frames
+	for (auto f = 0; f < n_fra; f++)
+	{
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i])
+				U_test[k++] = s[i * n_fra + f];
+
+		if (!crc->check(U_test, 1))
+			return false;
+	}
+
+	return true;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_N, true);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	this->_load(Y_N1);
+	this->_decode();
+
+	if (n_fra == 1)
+		std::copy(feedback_graph[m].begin(), feedback_graph[m].begin() + this->N, Y_N2);
+	else
+	{
+		std::vector<R*> frames(n_fra);
+		for (auto f = 0; f < n_fra; f++)
+			frames[f] = Y_N2 + f * this->N;
+		tools::Reorderer_static<R,n_fra>::apply_rev(feedback_graph[m].data(), frames, this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	const auto n_par = this->N - this->K;
+
+	// the systematic bits are on the information bits and the parity bits on the frozen bits
+	for (auto f = 0; f < n_fra; f++)
+	{
+		auto sys_idx = 0, par_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			soft_graph[m][i * n_fra + f] = frozen_bits[i] ? par[f * n_par   + par_idx++]
+			                                              : sys[f * this->K + sys_idx++];
+	}
+
+	this->_decode();
+
+	for (auto f = 0; f < n_fra; f++)
+	{
+		auto sys_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i])
+				ext[f * this->K + sys_idx++] = feedback_graph[m][i * n_fra + f];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_store(B *V_KN, const bool coded) const
+{
+	const auto &l = soft_graph    [m];
+	const auto &b = feedback_graph[m];
+
+	const auto size = coded ? this->N : this->K;
+	for (auto f = 0; f < n_fra; f++)
+	{
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (coded || !frozen_bits[i])
+				V_KN[f * size + k++] = tools::h_LLR<B,R>(tools::g0_LLR<R>(l[i * n_fra + f], b[i * n_fra + f]));
+	}
+}
+}
+}
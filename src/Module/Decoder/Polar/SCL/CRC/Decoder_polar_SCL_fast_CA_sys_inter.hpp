@@ -0,0 +1,55 @@
+#ifndef DECODER_POLAR_SCL_FAST_CA_SYS_INTER
+#define DECODER_POLAR_SCL_FAST_CA_SYS_INTER
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Module/CRC/CRC.hpp"
+
+#include "../Decoder_polar_SCL_fast_sys_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCL_fast_CA_sys_inter
+ *
+ * \brief CRC aided version of the Decoder_polar_SCL_fast_sys_inter: in each frame, the best path which verifies the
+ *        CRC is selected (the best path if none of them verifies the CRC).
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_inter<B,R>>
+class Decoder_polar_SCL_fast_CA_sys_inter : public Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+{
+private:
+	std::vector<bool> fast_store; // true if the CRC is verified (one per frame)
+
+protected:
+	CRC<B>& crc;
+	mipp::vector<B> U_test;       // the information bits of the selected path of each frame
+	std::vector<int> paths;
+
+public:
+	Decoder_polar_SCL_fast_CA_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                    CRC<B>& crc, const int n_frames = 1);
+
+	Decoder_polar_SCL_fast_CA_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                    const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+	                                    const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_fast_CA_sys_inter(){};
+
+protected:
+	        bool crc_check       (const int slot, const int f);
+	virtual void select_best_path(                           );
+
+	virtual void init_buffers();
+	virtual void _store(B *V_K);
+};
+}
+}
+
+#include "Decoder_polar_SCL_fast_CA_sys_inter.hxx"
+
+#endif /* DECODER_POLAR_SCL_FAST_CA_SYS_INTER */
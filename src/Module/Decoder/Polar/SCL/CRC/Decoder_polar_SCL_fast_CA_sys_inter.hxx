@@ -0,0 +1,112 @@
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_fast_CA_sys_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_CA_sys_inter<B,R,API_polar>
+::Decoder_polar_SCL_fast_CA_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                      CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>(K, N, L, frozen_bits, n_frames),
+  fast_store(API_polar::get_n_frames(), false), crc(crc), U_test(K * API_polar::get_n_frames()), paths(L)
+{
+	const std::string name = "Decoder_polar_SCL_fast_CA_sys_inter";
+	this->set_name(name);
+
+	if (crc.get_size() > K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_CA_sys_inter<B,R,API_polar>
+::Decoder_polar_SCL_fast_CA_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                      const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                                      const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>(K, N, L, frozen_bits, polar_patterns, idx_r0, idx_r1, n_frames),
+  fast_store(API_polar::get_n_frames(), false), crc(crc), U_test(K * API_polar::get_n_frames()), paths(L)
+{
+	const std::string name = "Decoder_polar_SCL_fast_CA_sys_inter";
+	this->set_name(name);
+
+	if (crc.get_size() > K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCL_fast_CA_sys_inter<B,R,API_polar>
+::crc_check(const int slot, const int f)
+{
+	this->extract_path(slot, f, this->s_tmp.data());
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s_tmp.data(), U_test.data() + f * this->K);
+
+	// check the CRC
+	return crc.check(U_test.data() + f * this->K, 1);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys_inter<B,R,API_polar>
+::select_best_path()
+{
+	constexpr int n_fra = API_polar::get_n_frames();
+
+	for (auto f = 0; f < n_fra; f++)
+	{
+		std::iota(paths.begin(), paths.begin() + this->n_active_paths, 0);
+		std::sort(paths.begin(), paths.begin() + this->n_active_paths,
+			[this, f](int x, int y){
+				return this->metrics[x * n_fra + f] < this->metrics[y * n_fra + f];
+			});
+
+		auto i = 0;
+		while (i < this->n_active_paths && !crc_check(paths[i], f)) i++;
+
+		this->best_path[f] = (i == this->n_active_paths) ? paths[0] : paths[i];
+		fast_store[f] = i != this->n_active_paths;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys_inter<B,R,API_polar>
+::init_buffers()
+{
+	Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>::init_buffers();
+	std::fill(fast_store.begin(), fast_store.end(), false);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys_inter<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_fra = API_polar::get_n_frames();
+
+	for (auto f = 0; f < n_fra; f++)
+		if (fast_store[f])
+			std::copy(U_test.begin() + f * this->K, U_test.begin() + (f +1) * this->K, V_K + f * this->K);
+		else
+		{
+			this->extract_path(this->best_path[f], f, this->s_tmp.data());
+			tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s_tmp.data(), V_K + f * this->K);
+		}
+}
+}
+}
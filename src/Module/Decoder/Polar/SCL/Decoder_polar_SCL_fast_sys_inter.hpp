@@ -0,0 +1,109 @@
+#ifndef DECODER_POLAR_SCL_FAST_SYS_INTER
+#define DECODER_POLAR_SCL_FAST_SYS_INTER
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Tools/Algo/Sort/LC_sorter_simd.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCL_fast_sys_inter
+ *
+ * \brief Same algorithm as the Decoder_polar_SCL_fast_sys but on API_polar::get_n_frames() frames at once: the frames
+ *        are interleaved and each SIMD lane carries the L paths of one frame.
+ *
+ * The number of active paths only depends on the polar tree, it is the same for all the frames: the path 'p' of each
+ * frame is stored in the slot 'p' and the LLRs/partial sums are computed for all the frames with the inter-frame
+ * API_polar. The path selection is made frame by frame (with the LC_sorter_simd), then the surviving paths are moved to
+ * their new slots with masked copies (only the frames where the slot changes are written).
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_inter<B,R>>
+class Decoder_polar_SCL_fast_sys_inter : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	static constexpr int n_fra = API_polar::get_n_frames(); // number of frames decoded at once
+
+	const int                         m;              // graph depth
+	const int                         L;              // maximum paths number
+	const std::vector<bool>&          frozen_bits;
+	      tools::Pattern_polar_parser polar_patterns;
+
+	      mipp::vector<R>             Y_N;            // the interleaved frames
+	std::vector<mipp::vector<R>>      l;              // llrs of each slot (interleaved)
+	std::vector<mipp::vector<B>>      s;              // partial sums of each slot (interleaved)
+	      mipp::vector<R>             metrics;        // path metrics (slot * n_fra + frame)
+	      mipp::vector<R>             cand_metrics;   // metrics of the candidates of the current leaf
+	      mipp::vector<B>             cand_bits;      // bits of the REP candidates of each slot (slot * n_fra + frame)
+
+	std::vector<R>                    metrics_vec;    // list of candidate metrics of a frame to be sorted
+	std::vector<int>                  bit_flips;      // index of the bits to be flipped (frame * 4 * L + slot * 4 + j)
+	std::vector<bool>                 is_even;        // parity of a spc node (frame * L + slot)
+	std::vector<int>                  src_slot;       // slot of the parent path (frame * L + slot)
+	std::vector<int>                  src_cand;       // candidate selected from the parent path (frame * L + slot)
+	std::vector<int>                  dup_count;      // number of children of a path
+	std::vector<int>                  best_path;      // best path of each frame
+	int                               n_active_paths; // same for all the frames
+
+	std::vector<int>                  in_left;        // true if the current node is in the left subtree of 'rev_depth'
+	std::vector<int>                  l_offset;       // offset of the llrs of the current node at 'rev_depth'
+
+	tools::LC_sorter_simd<R>          sorter_simd;
+	std::vector<int>                  best_idx;
+	mipp::vector<R>                   l_tmp;
+	mipp::vector<B>                   s_tmp;
+
+public:
+	Decoder_polar_SCL_fast_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 const int n_frames = 1);
+
+	Decoder_polar_SCL_fast_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+	                                 const int idx_r0, const int idx_r1, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_fast_sys_inter();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	virtual void _load          (const R *Y_N                            );
+	virtual void _decode        (                                        );
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	virtual void _store         (              B *V_K                    );
+	virtual void _store_cw      (              B *V_N                    );
+
+	inline void recursive_decode(const int off_l, const int off_s, const int rev_depth, int &node_id);
+
+	inline void update_paths_r0 (                     const int off_l, const int off_s, const int n_elmts);
+	inline void update_paths_r1 (const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	inline void update_paths_rep(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	inline void update_paths_spc(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+
+	virtual void init_buffers    (     );
+	virtual void select_best_path(     );
+	        void extract_path    (const int slot, const int f, B *V_N) const; // deinterleave a path of a frame
+
+private:
+	inline void select_paths     (const int n_cands, const int rev_depth, const int off_s, const int n_elmts);
+	inline void copy_slot        (const int src, const int dst, const bool f_mask[], const int rev_depth,
+	                              const int off_s, const int n_elmts);
+	inline void flip_bits_r1     (const int f, const int slot, const int off_s);
+	inline void flip_bits_spc    (const int f, const int slot, const int off_s);
+	inline void normalize_metrics(                                            );
+};
+}
+}
+
+#include "Decoder_polar_SCL_fast_sys_inter.hxx"
+
+#endif /* DECODER_POLAR_SCL_FAST_SYS_INTER */
@@ -0,0 +1,778 @@
+#include <algorithm>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <typeinfo>
+#include <type_traits>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Transpose/transpose_selector.h"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_fast_sys.hpp"
+#include "Decoder_polar_SCL_fast_sys_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R> inline mipp::Reg<R> sat_m_i(const mipp::Reg<R> m) { return m; }
+template <> inline mipp::Reg<signed char> sat_m_i(const mipp::Reg<signed char> m)
+{
+	return mipp::sat<signed char>(m, -128, 63);
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::Decoder_polar_SCL_fast_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                   const int n_frames)
+: Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>(K, N, L, frozen_bits,
+                                                  {new tools::Pattern_polar_std,
+                                                   new tools::Pattern_polar_r0,
+                                                   new tools::Pattern_polar_r1,
+                                                   new tools::Pattern_polar_r0_left,
+                                                   new tools::Pattern_polar_rep_left,
+                                                   new tools::Pattern_polar_rep,
+                                                   new tools::Pattern_polar_spc(2,2)},
+                                                  1,
+                                                  2,
+                                                  n_frames)
+{
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::Decoder_polar_SCL_fast_sys_inter(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                   const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                                   const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (N, frozen_bits, polar_patterns, idx_r0, idx_r1),
+  Y_N              (N * n_fra),
+  l                (L, mipp::vector<R>(N * n_fra)),
+  s                (L, mipp::vector<B>(N * n_fra)),
+  metrics          (L * n_fra),
+  cand_metrics     (8 * L * n_fra),
+  cand_bits        (L * n_fra),
+  metrics_vec      (8 * L),
+  bit_flips        (4 * L * n_fra),
+  is_even          (L * n_fra),
+  src_slot         (L * n_fra),
+  src_cand         (L * n_fra),
+  dup_count        (L, 0),
+  best_path        (n_fra, 0),
+  n_active_paths   (1),
+  in_left          (m +1, 0),
+  l_offset         (m +1, 0),
+  sorter_simd      (std::max(N, 8 * L)),
+  best_idx         (std::max(L, 4)),
+  l_tmp            (N),
+  s_tmp            (N)
+{
+	const std::string name = "Decoder_polar_SCL_fast_sys_inter";
+	this->set_name(name);
+
+	static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+	static_assert(API_polar::get_n_frames() == mipp::nElReg<R>(), "The API_polar has to be an inter-frame one.");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->L <= 0 || !tools::is_power_of_2(this->L))
+	{
+		std::stringstream message;
+		message << "'L' has to be a positive power of 2 ('L' = " << L << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N < mipp::nElReg<R>() * 2)
+	{
+		std::stringstream message;
+		message << "'N' has to be equal or greater than 'mipp::nElReg<R>()' * 2 ('N' = " << N
+		        << ", 'mipp::nElReg<R>()' = " << mipp::nElReg<R>() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::~Decoder_polar_SCL_fast_sys_inter()
+{
+	polar_patterns.release_patterns();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::init_buffers()
+{
+	std::fill(metrics.begin(), metrics.begin() + n_fra, std::numeric_limits<R>::min());
+	n_active_paths = 1;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	bool fast_interleave = false;
+	if (typeid(R) == typeid(signed char))
+		fast_interleave = tools::char_transpose((signed char*)Y_N, (signed char*)this->Y_N.data(), (int)this->N);
+
+	if (!fast_interleave)
+	{
+		std::vector<const R*> frames(n_fra);
+		for (auto f = 0; f < n_fra; f++)
+			frames[f] = Y_N + f * this->N;
+		tools::Reorderer_static<R,n_fra>::apply(frames, this->Y_N.data(), this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::_decode()
+{
+	int first_node_id = 0, off_l = 0, off_s = 0;
+	recursive_decode(off_l, off_s, m, first_node_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->init_buffers();
+	this->_decode();
+	this->select_best_path();
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->init_buffers();
+	this->_decode();
+	this->select_best_path();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int rev_depth, int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	// root node: the LLRs come from the channel and are shared by all the paths
+	if (rev_depth == m)
+	{
+		const auto Y = Y_N.data();
+
+		// f
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				API_polar::f(Y, Y + n_elm_2 * n_fra, l[0].data(), n_elm_2);
+				break;
+			default:
+				break;
+		}
+
+		in_left[rev_depth] = 1;
+		recursive_decode(off_l, off_s, rev_depth -1, ++node_id); // recursive call left
+		in_left[rev_depth] = 0;
+
+		// g
+		switch (node_type)
+		{
+			case tools::STANDARD:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::g (Y, Y + n_elm_2 * n_fra, s[p].data() + off_s * n_fra, l[p].data(), n_elm_2);
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::g0(Y, Y + n_elm_2 * n_fra,                               l[p].data(), n_elm_2);
+				break;
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::gr(Y, Y + n_elm_2 * n_fra, s[p].data() + off_s * n_fra, l[p].data(), n_elm_2);
+				break;
+			default:
+				break;
+		}
+
+		recursive_decode(off_l, off_s + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::xo (s[p], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::xo0(s[p],        off_s + n_elm_2, off_s, n_elm_2);
+				break;
+			default:
+				break;
+		}
+	}
+	else if (!is_terminal_pattern && rev_depth) // other node (not root or leaf)
+	{
+		const auto parent = off_l * n_fra;
+		const auto child  = (off_l + n_elmts) * n_fra;
+
+		// f
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::f(l[p].data() + parent, l[p].data() + parent + n_elm_2 * n_fra, l[p].data() + child,
+					             n_elm_2);
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths && n_active_paths > 1; p++)
+					API_polar::f(l[p].data() + parent, l[p].data() + parent + n_elm_2 * n_fra, l[p].data() + child,
+					             n_elm_2);
+				break;
+			default:
+				break;
+		}
+
+		// the LLRs of this node are needed by the paths which could be created in the left subtree
+		l_offset[rev_depth] = off_l;
+		in_left [rev_depth] = 1;
+		recursive_decode(off_l + n_elmts, off_s, rev_depth -1, ++node_id); // recursive call left
+		in_left [rev_depth] = 0;
+
+		// g
+		switch (node_type)
+		{
+			case tools::STANDARD:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::g (l[p].data() + parent, l[p].data() + parent + n_elm_2 * n_fra,
+					              s[p].data() + off_s * n_fra, l[p].data() + child, n_elm_2);
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::g0(l[p].data() + parent, l[p].data() + parent + n_elm_2 * n_fra,
+					                                             l[p].data() + child, n_elm_2);
+				break;
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::gr(l[p].data() + parent, l[p].data() + parent + n_elm_2 * n_fra,
+					              s[p].data() + off_s * n_fra, l[p].data() + child, n_elm_2);
+				break;
+			default:
+				break;
+		}
+
+		recursive_decode(off_l + n_elmts, off_s + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::xo (s[p], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::xo0(s[p],        off_s + n_elm_2, off_s, n_elm_2);
+				break;
+			default:
+				break;
+		}
+	}
+	else // leaf node
+	{
+		// h
+		switch (node_type)
+		{
+			case tools::RATE_0: update_paths_r0 (           off_l, off_s, n_elmts); break;
+			case tools::REP:    update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
+			case tools::RATE_1: update_paths_r1 (rev_depth, off_l, off_s, n_elmts); break;
+			case tools::SPC:    update_paths_spc(rev_depth, off_l, off_s, n_elmts); break;
+			default:
+				break;
+		}
+
+		normalize_metrics();
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::_store(B *V_K)
+{
+	for (auto f = 0; f < n_fra; f++)
+	{
+		extract_path(best_path[f], f, s_tmp.data());
+		tools::fb_extract(polar_patterns.get_leaves_pattern_types(), s_tmp.data(), V_K + f * this->K);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	for (auto f = 0; f < n_fra; f++)
+		extract_path(best_path[f], f, V_N + f * this->N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::extract_path(const int slot, const int f, B *V_N) const
+{
+	for (auto i = 0; i < this->N; i++)
+		V_N[i] = s[slot][i * n_fra + f];
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::update_paths_r0(const int off_l, const int off_s, const int n_elmts)
+{
+	if (n_active_paths > 1)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			auto r_pen = r_zero;
+			for (auto j = 0; j < n_elmts; j++)
+			{
+				const auto r_l = mipp::Reg<R>(&l[p][(off_l +j) * n_fra]);
+				r_pen = sat_m_i<R>(r_pen + sat_m_i<R>(r_zero - mipp::min(r_l, r_zero)));
+			}
+
+			// add a penalty to the current path metric of each frame
+			const auto r_metric = mipp::Reg<R>(&metrics[p * n_fra]);
+			sat_m_i<R>(r_metric + r_pen).store(&metrics[p * n_fra]);
+		}
+	}
+
+	for (auto p = 0; p < n_active_paths; p++)
+		API_polar::h0(s[p], off_s, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::update_paths_r1(const int r_d, const int off_l, const int off_s, const int n_elmts)
+{
+	if (r_d == 0)
+	{
+		update_paths_rep(r_d, off_l, off_s, n_elmts);
+		return;
+	}
+
+	// generate the candidates of each frame with the Chase-II algorithm
+	for (auto p = 0; p < n_active_paths; p++)
+		for (auto f = 0; f < n_fra; f++)
+		{
+			auto flips = &bit_flips[(f * L + p) * 4];
+			if (n_elmts == 2)
+			{
+				flips[0] = 0;
+				flips[1] = 1;
+			}
+			else
+			{
+				for (auto j = 0; j < n_elmts; j++) l_tmp[j] = l[p][(off_l +j) * n_fra + f];
+				sorter_simd.partial_sort_abs(l_tmp.data(), best_idx, n_elmts, 2);
+
+				flips[0] = best_idx[0];
+				flips[1] = best_idx[1];
+			}
+
+			const auto pen0 = sat_m<R>(std::abs(l[p][(off_l + flips[0]) * n_fra + f]));
+			const auto pen1 = sat_m<R>(std::abs(l[p][(off_l + flips[1]) * n_fra + f]));
+
+			const auto metric = metrics[p * n_fra + f];
+			auto cands = &cand_metrics[p * 4 * n_fra + f];
+			cands[0 * n_fra] =          metric;
+			cands[1 * n_fra] = sat_m<R>(metric + pen0);
+			cands[2 * n_fra] = sat_m<R>(metric + pen1);
+			cands[3 * n_fra] = sat_m<R>(cands[1 * n_fra] + pen1);
+		}
+
+	for (auto p = 0; p < n_active_paths; p++)
+		API_polar::h(s[p], l[p], off_l, off_s, n_elmts);
+
+	select_paths(4, r_d, off_s, n_elmts);
+
+	for (auto p = 0; p < n_active_paths; p++)
+		for (auto f = 0; f < n_fra; f++)
+			flip_bits_r1(f, p, off_s);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::flip_bits_r1(const int f, const int slot, const int off_s)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	const auto flips = &bit_flips[(f * L + src_slot[f * L + slot]) * 4];
+	auto flip = [&](const int j)
+	{
+		auto &bit = s[slot][(off_s + flips[j]) * n_fra + f];
+		bit = !bit ? b : 0;
+	};
+
+	switch (src_cand[f * L + slot])
+	{
+	case 0:
+		// nothing to do
+		break;
+	case 1:
+		flip(0);
+		break;
+	case 2:
+		flip(1);
+		break;
+	case 3:
+		flip(0);
+		flip(1);
+		break;
+	default:
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "Flip bits error on rate 1 node.");
+		break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::update_paths_rep(const int r_d, const int off_l, const int off_s, const int n_elmts)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	// generate the two possible candidates of each frame
+	const auto r_zero = mipp::Reg<R>((R)0);
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		auto r_pen0 = r_zero;
+		auto r_pen1 = r_zero;
+		for (auto j = 0; j < n_elmts; j++)
+		{
+			const auto r_l = mipp::Reg<R>(&l[p][(off_l +j) * n_fra]);
+			r_pen0 = sat_m_i<R>(r_pen0 + sat_m_i<R>(r_zero - mipp::min(r_l, r_zero)));
+			r_pen1 = sat_m_i<R>(r_pen1 + sat_m_i<R>(         mipp::max(r_l, r_zero)));
+		}
+
+		const auto r_metric = mipp::Reg<R>(&metrics[p * n_fra]);
+		sat_m_i<R>(r_metric + r_pen0).store(&cand_metrics[(p * 2 +0) * n_fra]);
+		sat_m_i<R>(r_metric + r_pen1).store(&cand_metrics[(p * 2 +1) * n_fra]);
+	}
+
+	const auto r_b      = mipp::Reg<B>(b);
+	const auto r_zero_b = mipp::Reg<B>((B)0);
+	if (n_active_paths <= L / 2)
+	{
+		// all the paths are duplicated: the same in all the frames
+		bool all_frames[n_fra];
+		std::fill(all_frames, all_frames + n_fra, true);
+
+		const auto n_active_paths_cpy = n_active_paths;
+		for (auto p = 0; p < n_active_paths_cpy; p++)
+		{
+			const auto new_p = n_active_paths++;
+			copy_slot(p, new_p, all_frames, r_d, off_s, n_elmts);
+
+			for (auto j = 0; j < n_elmts; j++)
+			{
+				r_zero_b.store(&s[    p][(off_s +j) * n_fra]);
+				r_b     .store(&s[new_p][(off_s +j) * n_fra]);
+			}
+
+			std::copy(&cand_metrics[(p * 2 +0) * n_fra], &cand_metrics[(p * 2 +1) * n_fra], &metrics[    p * n_fra]);
+			std::copy(&cand_metrics[(p * 2 +1) * n_fra], &cand_metrics[(p * 2 +2) * n_fra], &metrics[new_p * n_fra]);
+		}
+	}
+	else
+	{
+		select_paths(2, r_d, off_s, n_elmts);
+
+		// the bits of a path depend on the candidate selected in each frame
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			for (auto f = 0; f < n_fra; f++)
+				cand_bits[p * n_fra + f] = src_cand[f * L + p] ? b : 0;
+
+			const auto r_bits = mipp::Reg<B>(&cand_bits[p * n_fra]);
+			for (auto j = 0; j < n_elmts; j++)
+				r_bits.store(&s[p][(off_s +j) * n_fra]);
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::update_paths_spc(const int r_d, const int off_l, const int off_s, const int n_elmts)
+{
+	// the number of candidates to generate per list
+	const auto n_cands = L <= 2 ? 4 : 8;
+
+	// generate the candidates of each frame with the Chase-II algorithm
+	for (auto p = 0; p < n_active_paths; p++)
+		for (auto f = 0; f < n_fra; f++)
+		{
+			auto flips = &bit_flips[(f * L + p) * 4];
+			if (n_elmts == 4)
+			{
+				for (auto j = 0; j < 4; j++)
+					flips[j] = j;
+			}
+			else
+			{
+				for (auto j = 0; j < n_elmts; j++) l_tmp[j] = l[p][(off_l +j) * n_fra + f];
+				sorter_simd.partial_sort_abs(l_tmp.data(), best_idx, n_elmts, 4);
+
+				for (auto j = 0; j < 4; j++)
+					flips[j] = best_idx[j];
+			}
+
+			auto sum = 0;
+			for (auto j = 0; j < n_elmts; j++)
+				sum ^= (l[p][(off_l +j) * n_fra + f] < 0);
+			const bool even = (sum == 0);
+			is_even[f * L + p] = even;
+
+			const auto pen0 = sat_m<R>(std::abs(l[p][(off_l + flips[0]) * n_fra + f]));
+			const auto pen1 = sat_m<R>(std::abs(l[p][(off_l + flips[1]) * n_fra + f]));
+			const auto pen2 = sat_m<R>(std::abs(l[p][(off_l + flips[2]) * n_fra + f]));
+			const auto pen3 = sat_m<R>(std::abs(l[p][(off_l + flips[3]) * n_fra + f]));
+
+			const auto metric = metrics[p * n_fra + f];
+			auto cands = &cand_metrics[p * n_cands * n_fra + f];
+			cands[0 * n_fra] =          sat_m<R>(metric + (!even ? pen0 : 0));
+			cands[1 * n_fra] = sat_m<R>(sat_m<R>(metric + ( even ? pen0 : 0)) + pen1);
+			cands[2 * n_fra] = sat_m<R>(sat_m<R>(metric + ( even ? pen0 : 0)) + pen2);
+			cands[3 * n_fra] = sat_m<R>(sat_m<R>(metric + ( even ? pen0 : 0)) + pen3);
+
+			if (L > 2)
+			{
+				cands[4 * n_fra] = sat_m<R>(sat_m<R>(cands[0 * n_fra] + pen1) + pen2);
+				cands[5 * n_fra] = sat_m<R>(sat_m<R>(cands[0 * n_fra] + pen1) + pen3);
+				cands[6 * n_fra] = sat_m<R>(sat_m<R>(cands[0 * n_fra] + pen2) + pen3);
+				cands[7 * n_fra] = sat_m<R>(sat_m<R>(cands[1 * n_fra] + pen2) + pen3);
+			}
+		}
+
+	for (auto p = 0; p < n_active_paths; p++)
+		API_polar::h(s[p], l[p], off_l, off_s, n_elmts);
+
+	select_paths(n_cands, r_d, off_s, n_elmts);
+
+	for (auto p = 0; p < n_active_paths; p++)
+		for (auto f = 0; f < n_fra; f++)
+			flip_bits_spc(f, p, off_s);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::flip_bits_spc(const int f, const int slot, const int off_s)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	const auto src   = src_slot[f * L + slot];
+	const auto flips = &bit_flips[(f * L + src) * 4];
+	const bool even  = is_even[f * L + src];
+	auto flip = [&](const int j)
+	{
+		auto &bit = s[slot][(off_s + flips[j]) * n_fra + f];
+		bit = bit ? 0 : b;
+	};
+
+	switch (src_cand[f * L + slot])
+	{
+	case 0: if (!even) flip(0);                            break;
+	case 1: if ( even) flip(0); flip(1);                   break;
+	case 2: if ( even) flip(0); flip(2);                   break;
+	case 3: if ( even) flip(0); flip(3);                   break;
+	case 4: if (!even) flip(0); flip(1); flip(2);          break;
+	case 5: if (!even) flip(0); flip(1); flip(3);          break;
+	case 6: if (!even) flip(0); flip(2); flip(3);          break;
+	case 7: if ( even) flip(0); flip(1); flip(2); flip(3); break;
+	default:
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "Flip bits error on SPC node.");
+		break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::select_paths(const int n_cands, const int r_d, const int off_s, const int n_elmts)
+{
+	// L first of the lists are the L best paths
+	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
+
+	for (auto f = 0; f < n_fra; f++)
+	{
+		for (auto p = 0; p < n_active_paths; p++)
+			for (auto c = 0; c < n_cands; c++)
+				metrics_vec[p * n_cands + c] = cand_metrics[(p * n_cands + c) * n_fra + f];
+		std::fill(metrics_vec.begin() + n_active_paths * n_cands, metrics_vec.begin() + L * n_cands,
+		          std::numeric_limits<R>::max());
+
+		sorter_simd.partial_sort(metrics_vec.data(), best_idx, L * n_cands, n_list);
+
+		// count the number of duplications per path
+		std::fill(dup_count.begin(), dup_count.end(), 0);
+		for (auto i = 0; i < n_list; i++)
+			dup_count[best_idx[i] / n_cands]++;
+
+		// the first child of a path keeps its slot, the others take the free slots (in increasing order, they all are
+		// lower than 'n_list')
+		auto free_slot = 0;
+		for (auto i = 0; i < n_list; i++)
+		{
+			const auto path = best_idx[i] / n_cands;
+			auto slot = path;
+			if (dup_count[path] < 0)
+			{
+				while (dup_count[free_slot] != 0) free_slot++;
+				slot = free_slot++;
+			}
+			dup_count[path] = -1;
+
+			src_slot[f * L + slot] = path;
+			src_cand[f * L + slot] = best_idx[i] % n_cands;
+			metrics[slot * n_fra + f] = metrics_vec[best_idx[i]];
+		}
+	}
+
+	// move the surviving paths to their new slots, only in the frames where the slot changes
+	bool f_mask[n_fra];
+	for (auto dst = 0; dst < n_list; dst++)
+		for (auto src = 0; src < n_active_paths; src++)
+		{
+			if (src == dst) continue;
+
+			auto any = false;
+			for (auto f = 0; f < n_fra; f++)
+				any |= f_mask[f] = (src_slot[f * L + dst] == src);
+
+			if (any)
+				copy_slot(src, dst, f_mask, r_d, off_s, n_elmts);
+		}
+
+	n_active_paths = n_list;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::copy_slot(const int src, const int dst, const bool f_mask[], const int r_d, const int off_s, const int n_elmts)
+{
+	const auto msk = mipp::Msk<mipp::N<R>()>(f_mask);
+
+	// the partial sums of the path
+	const auto s_end = (off_s + n_elmts) * n_fra;
+	for (auto i = 0; i < s_end; i += n_fra)
+	{
+		const auto r_src = mipp::Reg<B>(&s[src][i]);
+		const auto r_dst = mipp::Reg<B>(&s[dst][i]);
+		mipp::blend(r_src, r_dst, msk).store(&s[dst][i]);
+	}
+
+	// the LLRs of the ancestors which are still needed (the right subtrees of the nodes whose left subtree contains the
+	// current leaf, the LLRs of the root are the channel ones)
+	for (auto d = r_d +1; d < m; d++)
+		if (in_left[d])
+		{
+			const auto l_beg = (l_offset[d]             ) * n_fra;
+			const auto l_end = (l_offset[d] + (1 << d)) * n_fra;
+			for (auto i = l_beg; i < l_end; i += n_fra)
+			{
+				const auto r_src = mipp::Reg<R>(&l[src][i]);
+				const auto r_dst = mipp::Reg<R>(&l[dst][i]);
+				mipp::blend(r_src, r_dst, msk).store(&l[dst][i]);
+			}
+		}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::normalize_metrics()
+{
+	// only the fixed-point metrics are normalized
+	if (std::is_floating_point<R>::value)
+		return;
+
+	for (auto f = 0; f < n_fra; f++)
+	{
+		auto min = metrics[f];
+		for (auto p = 1; p < n_active_paths; p++)
+			min = std::min(min, metrics[p * n_fra + f]);
+
+		const auto norm = (R)(std::numeric_limits<R>::min() - min);
+		for (auto p = 0; p < n_active_paths; p++)
+			metrics[p * n_fra + f] += norm;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys_inter<B,R,API_polar>
+::select_best_path()
+{
+	for (auto f = 0; f < n_fra; f++)
+	{
+		best_path[f] = 0;
+		for (auto p = 1; p < n_active_paths; p++)
+			if (metrics[p * n_fra + f] < metrics[best_path[f] * n_fra + f])
+				best_path[f] = p;
+	}
+}
+}
+}
@@ -0,0 +1,48 @@
+#ifndef DECODER_RSC_BCJR_INTER_RADIX4_HPP_
+#define DECODER_RSC_BCJR_INTER_RADIX4_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_BCJR_inter_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_inter_radix4
+ *
+ * \brief Radix-4 version of the Decoder_RSC_BCJR_inter_fast (LTE trellis): two trellis sections are merged in the
+ *        forward and backward recursions.
+ *
+ * Each node metric of the recursion is the MAX of the four paths coming from the node metrics two sections before
+ * (the two branch metrics of a path are summed once per couple of sections), this halves the length of the critical
+ * path. The node metrics of the odd sections are computed from the even ones with a radix-2 step out of the
+ * recursion, so the extrinsic values are computed as in the radix-2 decoder and are identical with the max-log-MAP
+ * algorithm (up to the rounding of the floating-point additions).
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_inter_radix4 : public Decoder_RSC_BCJR_inter_fast<B,R,MAX>
+{
+public:
+	Decoder_RSC_BCJR_inter_radix4(const int &K,
+	                              const std::vector<std::vector<int>> &trellis,
+	                              const bool buffered_encoding = true,
+	                              const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_inter_radix4();
+
+protected:
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_alpha();
+	void compute_beta ();
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_inter_radix4.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTER_RADIX4_HPP_ */
@@ -0,0 +1,242 @@
+#include <sstream>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_RSC_BCJR_inter_radix4.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_radix4<B,R,MAX>
+::Decoder_RSC_BCJR_inter_radix4(const int &K,
+                                const std::vector<std::vector<int>> &trellis,
+                                const bool buffered_encoding,
+                                const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, mipp::N<R>()),
+  Decoder_RSC_BCJR_inter_fast<B,R,MAX>(K, trellis, buffered_encoding, n_frames)
+{
+	const std::string name = "Decoder_RSC_BCJR_inter_radix4";
+	this->set_name(name);
+
+	if (K % 2)
+	{
+		std::stringstream message;
+		message << "'K' has to be divisible by 2 ('K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_radix4<B,R,MAX>
+::~Decoder_RSC_BCJR_inter_radix4()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_radix4<B,R,MAX>
+::compute_alpha()
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	// compute alpha values [trellis forward traversal ->], two sections at a time
+	for (auto i = 0; i < (this->K +2) * stride; i += 2 * stride)
+	{
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][i         ]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][i         ]);
+		const auto r_h0 = mipp::Reg<R>(&this->gamma[0][i + stride]);
+		const auto r_h1 = mipp::Reg<R>(&this->gamma[1][i + stride]);
+
+		// branch metrics of the paths over the two sections
+		const auto r_g0ph0 = r_g0 + r_h0, r_g0mh0 = r_g0 - r_h0;
+		const auto r_g0ph1 = r_g0 + r_h1, r_g0mh1 = r_g0 - r_h1;
+		const auto r_g1ph0 = r_g1 + r_h0, r_g1mh0 = r_g1 - r_h0;
+		const auto r_g1ph1 = r_g1 + r_h1, r_g1mh1 = r_g1 - r_h1;
+
+		const auto r_a0_prev = mipp::Reg<R>(&this->alpha[0][i]);
+		const auto r_a1_prev = mipp::Reg<R>(&this->alpha[1][i]);
+		const auto r_a2_prev = mipp::Reg<R>(&this->alpha[2][i]);
+		const auto r_a3_prev = mipp::Reg<R>(&this->alpha[3][i]);
+		const auto r_a4_prev = mipp::Reg<R>(&this->alpha[4][i]);
+		const auto r_a5_prev = mipp::Reg<R>(&this->alpha[5][i]);
+		const auto r_a6_prev = mipp::Reg<R>(&this->alpha[6][i]);
+		const auto r_a7_prev = mipp::Reg<R>(&this->alpha[7][i]);
+
+		// radix-4 recursion: section i+2 from section i
+		auto r_a0 = MAX(MAX(r_a0_prev + r_g0ph0, r_a1_prev - r_g0mh0), MAX(r_a3_prev + r_g1mh0, r_a2_prev - r_g1ph0));
+		auto r_a1 = MAX(MAX(r_a7_prev + r_g0ph1, r_a6_prev - r_g0mh1), MAX(r_a4_prev + r_g1mh1, r_a5_prev - r_g1ph1));
+		auto r_a2 = MAX(MAX(r_a1_prev + r_g0ph1, r_a0_prev - r_g0mh1), MAX(r_a2_prev + r_g1mh1, r_a3_prev - r_g1ph1));
+		auto r_a3 = MAX(MAX(r_a6_prev + r_g0ph0, r_a7_prev - r_g0mh0), MAX(r_a5_prev + r_g1mh0, r_a4_prev - r_g1ph0));
+		auto r_a4 = MAX(MAX(r_a3_prev + r_g1ph0, r_a2_prev - r_g1mh0), MAX(r_a0_prev + r_g0mh0, r_a1_prev - r_g0ph0));
+		auto r_a5 = MAX(MAX(r_a4_prev + r_g1ph1, r_a5_prev - r_g1mh1), MAX(r_a7_prev + r_g0mh1, r_a6_prev - r_g0ph1));
+		auto r_a6 = MAX(MAX(r_a2_prev + r_g1ph1, r_a3_prev - r_g1mh1), MAX(r_a1_prev + r_g0mh1, r_a0_prev - r_g0ph1));
+		auto r_a7 = MAX(MAX(r_a5_prev + r_g1ph0, r_a4_prev - r_g1mh0), MAX(r_a6_prev + r_g0mh0, r_a7_prev - r_g0ph0));
+
+		RSC_BCJR_inter_fast_normalize<R>::apply(r_a0, r_a1, r_a2, r_a3, r_a4, r_a5, r_a6, r_a7, i + 2 * stride);
+
+		r_a0.store(&this->alpha[0][i + 2 * stride]);
+		r_a1.store(&this->alpha[1][i + 2 * stride]);
+		r_a2.store(&this->alpha[2][i + 2 * stride]);
+		r_a3.store(&this->alpha[3][i + 2 * stride]);
+		r_a4.store(&this->alpha[4][i + 2 * stride]);
+		r_a5.store(&this->alpha[5][i + 2 * stride]);
+		r_a6.store(&this->alpha[6][i + 2 * stride]);
+		r_a7.store(&this->alpha[7][i + 2 * stride]);
+
+		// radix-2 step out of the recursion: section i+1 (only required by the extrinsic values)
+		auto r_a0_odd = MAX(r_a0_prev + r_g0, r_a1_prev - r_g0);
+		auto r_a1_odd = MAX(r_a3_prev + r_g1, r_a2_prev - r_g1);
+		auto r_a2_odd = MAX(r_a4_prev + r_g1, r_a5_prev - r_g1);
+		auto r_a3_odd = MAX(r_a7_prev + r_g0, r_a6_prev - r_g0);
+		auto r_a4_odd = MAX(r_a1_prev + r_g0, r_a0_prev - r_g0);
+		auto r_a5_odd = MAX(r_a2_prev + r_g1, r_a3_prev - r_g1);
+		auto r_a6_odd = MAX(r_a5_prev + r_g1, r_a4_prev - r_g1);
+		auto r_a7_odd = MAX(r_a6_prev + r_g0, r_a7_prev - r_g0);
+
+		RSC_BCJR_inter_fast_normalize<R>::apply(r_a0_odd, r_a1_odd, r_a2_odd, r_a3_odd,
+		                                        r_a4_odd, r_a5_odd, r_a6_odd, r_a7_odd, i + stride);
+
+		r_a0_odd.store(&this->alpha[0][i + stride]);
+		r_a1_odd.store(&this->alpha[1][i + stride]);
+		r_a2_odd.store(&this->alpha[2][i + stride]);
+		r_a3_odd.store(&this->alpha[3][i + stride]);
+		r_a4_odd.store(&this->alpha[4][i + stride]);
+		r_a5_odd.store(&this->alpha[5][i + stride]);
+		r_a6_odd.store(&this->alpha[6][i + stride]);
+		r_a7_odd.store(&this->alpha[7][i + stride]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_radix4<B,R,MAX>
+::compute_beta()
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	// the number of sections is odd (K + 3): the last section is processed with a radix-2 step
+	{
+		const auto i = (this->K +2) * stride;
+
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][i]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][i]);
+
+		const auto r_b0_prev = mipp::Reg<R>(&this->beta[0][i +stride]);
+		const auto r_b1_prev = mipp::Reg<R>(&this->beta[1][i +stride]);
+		const auto r_b2_prev = mipp::Reg<R>(&this->beta[2][i +stride]);
+		const auto r_b3_prev = mipp::Reg<R>(&this->beta[3][i +stride]);
+		const auto r_b4_prev = mipp::Reg<R>(&this->beta[4][i +stride]);
+		const auto r_b5_prev = mipp::Reg<R>(&this->beta[5][i +stride]);
+		const auto r_b6_prev = mipp::Reg<R>(&this->beta[6][i +stride]);
+		const auto r_b7_prev = mipp::Reg<R>(&this->beta[7][i +stride]);
+
+		auto r_b0 = MAX(r_b0_prev + r_g0, r_b4_prev - r_g0);
+		auto r_b1 = MAX(r_b4_prev + r_g0, r_b0_prev - r_g0);
+		auto r_b2 = MAX(r_b5_prev + r_g1, r_b1_prev - r_g1);
+		auto r_b3 = MAX(r_b1_prev + r_g1, r_b5_prev - r_g1);
+		auto r_b4 = MAX(r_b2_prev + r_g1, r_b6_prev - r_g1);
+		auto r_b5 = MAX(r_b6_prev + r_g1, r_b2_prev - r_g1);
+		auto r_b6 = MAX(r_b7_prev + r_g0, r_b3_prev - r_g0);
+		auto r_b7 = MAX(r_b3_prev + r_g0, r_b7_prev - r_g0);
+
+		RSC_BCJR_inter_fast_normalize<R>::apply(r_b0, r_b1, r_b2, r_b3, r_b4, r_b5, r_b6, r_b7, i);
+
+		r_b0.store(&this->beta[0][i]);
+		r_b1.store(&this->beta[1][i]);
+		r_b2.store(&this->beta[2][i]);
+		r_b3.store(&this->beta[3][i]);
+		r_b4.store(&this->beta[4][i]);
+		r_b5.store(&this->beta[5][i]);
+		r_b6.store(&this->beta[6][i]);
+		r_b7.store(&this->beta[7][i]);
+	}
+
+	// compute beta values [trellis backward traversal <-], two sections at a time
+	for (auto i = this->K * stride; i >= 0; i -= 2 * stride)
+	{
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][i         ]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][i         ]);
+		const auto r_h0 = mipp::Reg<R>(&this->gamma[0][i + stride]);
+		const auto r_h1 = mipp::Reg<R>(&this->gamma[1][i + stride]);
+
+		// branch metrics of the paths over the two sections
+		const auto r_g0ph0 = r_g0 + r_h0, r_g0mh0 = r_g0 - r_h0;
+		const auto r_g0ph1 = r_g0 + r_h1, r_g0mh1 = r_g0 - r_h1;
+		const auto r_g1ph0 = r_g1 + r_h0, r_g1mh0 = r_g1 - r_h0;
+		const auto r_g1ph1 = r_g1 + r_h1, r_g1mh1 = r_g1 - r_h1;
+
+		const auto r_b0_prev = mipp::Reg<R>(&this->beta[0][i + 2 * stride]);
+		const auto r_b1_prev = mipp::Reg<R>(&this->beta[1][i + 2 * stride]);
+		const auto r_b2_prev = mipp::Reg<R>(&this->beta[2][i + 2 * stride]);
+		const auto r_b3_prev = mipp::Reg<R>(&this->beta[3][i + 2 * stride]);
+		const auto r_b4_prev = mipp::Reg<R>(&this->beta[4][i + 2 * stride]);
+		const auto r_b5_prev = mipp::Reg<R>(&this->beta[5][i + 2 * stride]);
+		const auto r_b6_prev = mipp::Reg<R>(&this->beta[6][i + 2 * stride]);
+		const auto r_b7_prev = mipp::Reg<R>(&this->beta[7][i + 2 * stride]);
+
+		// radix-4 recursion: section i from section i+2
+		auto r_b0 = MAX(MAX(r_b0_prev + r_g0ph0, r_b4_prev + r_g0mh0), MAX(r_b2_prev - r_g0mh1, r_b6_prev - r_g0ph1));
+		auto r_b1 = MAX(MAX(r_b2_prev + r_g0ph1, r_b6_prev + r_g0mh1), MAX(r_b0_prev - r_g0mh0, r_b4_prev - r_g0ph0));
+		auto r_b2 = MAX(MAX(r_b6_prev + r_g1ph1, r_b2_prev + r_g1mh1), MAX(r_b4_prev - r_g1mh0, r_b0_prev - r_g1ph0));
+		auto r_b3 = MAX(MAX(r_b4_prev + r_g1ph0, r_b0_prev + r_g1mh0), MAX(r_b6_prev - r_g1mh1, r_b2_prev - r_g1ph1));
+		auto r_b4 = MAX(MAX(r_b5_prev + r_g1ph1, r_b1_prev + r_g1mh1), MAX(r_b7_prev - r_g1mh0, r_b3_prev - r_g1ph0));
+		auto r_b5 = MAX(MAX(r_b7_prev + r_g1ph0, r_b3_prev + r_g1mh0), MAX(r_b5_prev - r_g1mh1, r_b1_prev - r_g1ph1));
+		auto r_b6 = MAX(MAX(r_b3_prev + r_g0ph0, r_b7_prev + r_g0mh0), MAX(r_b1_prev - r_g0mh1, r_b5_prev - r_g0ph1));
+		auto r_b7 = MAX(MAX(r_b1_prev + r_g0ph1, r_b5_prev + r_g0mh1), MAX(r_b3_prev - r_g0mh0, r_b7_prev - r_g0ph0));
+
+		RSC_BCJR_inter_fast_normalize<R>::apply(r_b0, r_b1, r_b2, r_b3, r_b4, r_b5, r_b6, r_b7, i);
+
+		r_b0.store(&this->beta[0][i]);
+		r_b1.store(&this->beta[1][i]);
+		r_b2.store(&this->beta[2][i]);
+		r_b3.store(&this->beta[3][i]);
+		r_b4.store(&this->beta[4][i]);
+		r_b5.store(&this->beta[5][i]);
+		r_b6.store(&this->beta[6][i]);
+		r_b7.store(&this->beta[7][i]);
+
+		// radix-2 step out of the recursion: section i+1 (only required by the extrinsic values)
+		auto r_b0_odd = MAX(r_b0_prev + r_h0, r_b4_prev - r_h0);
+		auto r_b1_odd = MAX(r_b4_prev + r_h0, r_b0_prev - r_h0);
+		auto r_b2_odd = MAX(r_b5_prev + r_h1, r_b1_prev - r_h1);
+		auto r_b3_odd = MAX(r_b1_prev + r_h1, r_b5_prev - r_h1);
+		auto r_b4_odd = MAX(r_b2_prev + r_h1, r_b6_prev - r_h1);
+		auto r_b5_odd = MAX(r_b6_prev + r_h1, r_b2_prev - r_h1);
+		auto r_b6_odd = MAX(r_b7_prev + r_h0, r_b3_prev - r_h0);
+		auto r_b7_odd = MAX(r_b3_prev + r_h0, r_b7_prev - r_h0);
+
+		RSC_BCJR_inter_fast_normalize<R>::apply(r_b0_odd, r_b1_odd, r_b2_odd, r_b3_odd,
+		                                        r_b4_odd, r_b5_odd, r_b6_odd, r_b7_odd, i + stride);
+
+		r_b0_odd.store(&this->beta[0][i + stride]);
+		r_b1_odd.store(&this->beta[1][i + stride]);
+		r_b2_odd.store(&this->beta[2][i + stride]);
+		r_b3_odd.store(&this->beta[3][i + stride]);
+		r_b4_odd.store(&this->beta[4][i + stride]);
+		r_b5_odd.store(&this->beta[5][i + stride]);
+		r_b6_odd.store(&this->beta[6][i + stride]);
+		r_b7_odd.store(&this->beta[7][i + stride]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_radix4<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	if (!mipp::isAligned(sys))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'sys' is misaligned memory.");
+
+	if (!mipp::isAligned(par))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'par' is misaligned memory.");
+
+	if (!mipp::isAligned(ext))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'ext' is misaligned memory.");
+
+	this->compute_gamma(sys, par);
+	this->compute_alpha(        );
+	this->compute_beta (        );
+	this->compute_ext  (sys, ext);
+}
+}
+}
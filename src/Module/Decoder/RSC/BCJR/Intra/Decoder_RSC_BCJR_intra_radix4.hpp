@@ -0,0 +1,48 @@
+#ifndef DECODER_RSC_BCJR_INTRA_RADIX4_HPP_
+#define DECODER_RSC_BCJR_INTRA_RADIX4_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_BCJR_intra_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_intra_radix4
+ *
+ * \brief Radix-4 version of the Decoder_RSC_BCJR_intra_fast (LTE trellis, 8 states in a SIMD register): two trellis
+ *        sections are merged in the forward and backward recursions.
+ *
+ * The node metrics of the odd sections are computed out of the recursions (radix-2 step from the even sections), so
+ * the extrinsic values are computed as in the radix-2 decoder.
+ *
+ * The factory only builds it when a SIMD register holds exactly the 8 states (mipp::nElReg<R>() == 8, e.g. 16-bit
+ * fixed-point with SSE or NEON, 32-bit floating-point with AVX). In fixed-point, the extrinsic values are
+ * bit-identical to the ones of the Decoder_RSC_BCJR_intra_fast. In floating-point, they can differ by the rounding of
+ * the additions (the two branch metrics of a path are summed before being added to the node metric).
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_intra_radix4 : public Decoder_RSC_BCJR_intra_fast<B,R,MAX>
+{
+public:
+	Decoder_RSC_BCJR_intra_radix4(const int &K,
+	                              const std::vector<std::vector<int>> &trellis,
+	                              const bool buffered_encoding = true,
+	                              const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_intra_radix4();
+
+protected:
+	void compute_alpha   (                    );
+	void compute_beta_ext(const R *sys, R *ext);
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_intra_radix4.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTRA_RADIX4_HPP_ */
@@ -0,0 +1,73 @@
+#ifndef DECODER_RSC_BCJR_WINDOW_HPP_
+#define DECODER_RSC_BCJR_WINDOW_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_window
+ *
+ * \brief Parallel-window BCJR decoder for any trellis: the frame is cut into windows of 'win_size' trellis sections
+ *        and the SIMD lanes decode 'mipp::nElReg<R>()' windows at once.
+ *
+ * The forward and backward recursions are made on the windows of a batch only, so the node metrics that are stored
+ * (alpha) do not depend on the frame size. The boundary metrics of the windows are initialized with the metrics
+ * computed by the neighbour windows during the previous call to 'decode_siso' (Next Iteration Initialization, NII).
+ * They are uniform at the first iteration, 'reset' has to be called before the decoding of a new frame.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_window : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	const int n_steps;   // number of trellis sections (K + n_ff)
+	const int win_size;  // number of trellis sections in a window
+	const int n_windows; // number of windows (padded to a multiple of the SIMD lanes)
+
+	std::vector<int> alpha_idx[2]; // previous states of a state   (trellis[0] and trellis[3])
+	std::vector<int> alpha_sgn[2]; // sign of the branch metrics   (trellis[1] and trellis[4])
+	std::vector<int> alpha_gam[2]; // branch metric of the edges   (trellis[2] and trellis[5])
+	std::vector<int> beta_idx [2]; // next states of a state       (trellis[6] and trellis[8])
+	std::vector<int> beta_gam [2]; // branch metric of the edges   (trellis[7] and trellis[9])
+
+	mipp::vector<R> alpha;     // node metrics of the windows of the current batch (left to right)
+	mipp::vector<R> beta_prev; // node metrics of the windows of the current batch (right to left)
+	mipp::vector<R> beta_cur;
+	mipp::vector<R> gamma[2];  // edge metrics of the windows of the current batch
+	mipp::vector<R> post;      // a posteriori LLRs of the windows of the current batch
+
+	mipp::vector<R> alpha_nii; // alpha metrics at the beginning of each window (NII)
+	mipp::vector<R> beta_nii;  // beta  metrics at the end       of each window (NII)
+
+public:
+	Decoder_RSC_BCJR_window(const int &K,
+	                        const std::vector<std::vector<int>> &trellis,
+	                        const int win_size,
+	                        const bool buffered_encoding = true,
+	                        const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_window();
+
+	virtual void reset();
+
+protected:
+	void _load       (const R *Y_N                                          );
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_gamma   (const R *sys, const R *par, const int batch);
+	void compute_alpha   (                            const int batch);
+	void compute_beta_ext(                            const int batch);
+	void store_ext       (const R *sys,       R *ext, const int batch);
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_window.hxx"
+
+#endif /* DECODER_RSC_BCJR_WINDOW_HPP_ */
@@ -0,0 +1,322 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "../Inter/Decoder_RSC_BCJR_inter.hpp"
+
+#include "Decoder_RSC_BCJR_window.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_window_init
+{
+	static R minus_inf() { return -std::numeric_limits<R>::max(); }
+};
+
+template <>
+struct RSC_BCJR_window_init <short>
+{
+	static short minus_inf() { return -(1 << (sizeof(short) * 8 -2)); }
+};
+
+template <>
+struct RSC_BCJR_window_init <signed char>
+{
+	static signed char minus_inf() { return -63; }
+};
+
+template <typename R>
+struct RSC_BCJR_window_normalize
+{
+	static mipp::Reg<R> apply(const mipp::Reg<R> &r_metric, const mipp::Reg<R> &r_norm)
+	{
+		return r_metric - r_norm;
+	}
+};
+
+template <>
+struct RSC_BCJR_window_normalize <signed char>
+{
+	static mipp::Reg<signed char> apply(const mipp::Reg<signed char> &r_metric, const mipp::Reg<signed char> &r_norm)
+	{
+		return (r_metric - r_norm).sat(-63, 63);
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_window<B,R,MAX>
+::Decoder_RSC_BCJR_window(const int &K,
+                          const std::vector<std::vector<int>> &trellis,
+                          const int win_size,
+                          const bool buffered_encoding,
+                          const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, 1),
+  n_steps(K + this->n_ff),
+  win_size(win_size),
+  n_windows(win_size > 0 ? ((((K + this->n_ff) + win_size -1) / win_size + mipp::nElReg<R>() -1) / mipp::nElReg<R>())
+                           * mipp::nElReg<R>() : 0)
+{
+	const std::string name = "Decoder_RSC_BCJR_window";
+	this->set_name(name);
+
+	if (win_size <= 0)
+	{
+		std::stringstream message;
+		message << "'win_size' has to be greater than 0 ('win_size' = " << win_size << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (trellis.size() < 10)
+	{
+		std::stringstream message;
+		message << "'trellis.size()' has to be equal or greater than 10 ('trellis.size()' = " << trellis.size() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto e = 0; e < 2; e++)
+	{
+		alpha_idx[e] = trellis[e * 3 + 0];
+		alpha_sgn[e] = trellis[e * 3 + 1];
+		alpha_gam[e] = trellis[e * 3 + 2];
+		beta_idx [e] = trellis[e * 2 + 6];
+		beta_gam [e] = trellis[e * 2 + 7];
+	}
+
+	constexpr auto n_lanes = mipp::nElReg<R>();
+
+	alpha    .resize((win_size +1) * this->n_states * n_lanes);
+	beta_prev.resize(              this->n_states * n_lanes);
+	beta_cur .resize(              this->n_states * n_lanes);
+	gamma[0] .resize( win_size                    * n_lanes);
+	gamma[1] .resize( win_size                    * n_lanes);
+	post     .resize( win_size                    * n_lanes);
+	alpha_nii.resize(n_windows * this->n_states);
+	beta_nii .resize(n_windows * this->n_states);
+
+	this->reset();
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_window<B,R,MAX>
+::~Decoder_RSC_BCJR_window()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::reset()
+{
+	// uniform boundary metrics for the first iteration
+	std::fill(alpha_nii.begin(), alpha_nii.end(), (R)0);
+	std::fill(beta_nii .begin(), beta_nii .end(), (R)0);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::_load(const R *Y_N)
+{
+	this->reset();
+	Decoder_RSC_BCJR<B,R>::_load(Y_N);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::compute_gamma(const R *sys, const R *par, const int batch)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+
+	// gather the windows of the batch (one window per SIMD lane), the sections after the end of the trellis are null
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		const auto off = (batch * n_lanes + w) * win_size;
+		for (auto t = 0; t < win_size; t++)
+		{
+			const auto i = off + t;
+			gamma[0][t * n_lanes + w] = i < n_steps ? sys[i] : (R)0;
+			gamma[1][t * n_lanes + w] = i < n_steps ? par[i] : (R)0;
+		}
+	}
+
+	for (auto t = 0; t < win_size * n_lanes; t += n_lanes)
+	{
+		const auto r_sys = mipp::Reg<R>(&gamma[0][t]);
+		const auto r_par = mipp::Reg<R>(&gamma[1][t]);
+
+		// there is a big loss of precision here in fixed point
+		RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par).store(&gamma[0][t]);
+		RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par).store(&gamma[1][t]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::compute_alpha(const int batch)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+	const auto n_states = this->n_states;
+
+	// init alpha values: known initial state for the first window, NII for the others
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		const auto k = batch * n_lanes + w;
+		for (auto j = 0; j < n_states; j++)
+			alpha[j * n_lanes + w] = (k == 0) ? (j == 0 ? (R)0 : RSC_BCJR_window_init<R>::minus_inf())
+			                                  : alpha_nii[k * n_states + j];
+	}
+
+	// compute alpha values [trellis forward traversal ->]
+	for (auto t = 0; t < win_size; t++)
+	{
+		const auto alpha_t  = alpha.data() + (t    ) * n_states * n_lanes;
+		      auto alpha_t1 = alpha.data() + (t +1) * n_states * n_lanes;
+
+		for (auto j = 0; j < n_states; j++)
+		{
+			const auto r_a1 = mipp::Reg<R>(&alpha_t[alpha_idx[0][j] * n_lanes]);
+			const auto r_a2 = mipp::Reg<R>(&alpha_t[alpha_idx[1][j] * n_lanes]);
+			const auto r_g1 = mipp::Reg<R>(&gamma[alpha_gam[0][j]][t * n_lanes]);
+			const auto r_g2 = mipp::Reg<R>(&gamma[alpha_gam[1][j]][t * n_lanes]);
+
+			const auto r_m1 = alpha_sgn[0][j] > 0 ? r_a1 + r_g1 : r_a1 - r_g1;
+			const auto r_m2 = alpha_sgn[1][j] > 0 ? r_a2 + r_g2 : r_a2 - r_g2;
+
+			MAX(r_m1, r_m2).store(&alpha_t1[j * n_lanes]);
+		}
+
+		const auto r_norm = mipp::Reg<R>(&alpha_t1[0]);
+		for (auto j = 0; j < n_states; j++)
+			RSC_BCJR_window_normalize<R>::apply(mipp::Reg<R>(&alpha_t1[j * n_lanes]), r_norm)
+			                             .store(&alpha_t1[j * n_lanes]);
+	}
+
+	// save the last alpha values of each window for the initialization of the next window
+	const auto alpha_last = alpha.data() + win_size * n_states * n_lanes;
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		const auto k = batch * n_lanes + w;
+		if (k +1 < n_windows)
+			for (auto j = 0; j < n_states; j++)
+				alpha_nii[(k +1) * n_states + j] = alpha_last[j * n_lanes + w];
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::compute_beta_ext(const int batch)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+	const auto n_states = this->n_states;
+
+	// the window containing the end of the trellis and the position of the end in this window
+	const auto k_end = (n_steps -1) / win_size;
+	const auto t_end = n_steps - k_end * win_size;
+	const auto w_end = k_end - batch * n_lanes;
+
+	auto init_end = [&](R *beta, const int w)
+	{
+		for (auto j = 0; j < n_states; j++)
+			beta[j * n_lanes + w] = j == 0 ? (R)0 : RSC_BCJR_window_init<R>::minus_inf();
+	};
+
+	// init beta values: known final state for the last window, NII for the others
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		const auto k = batch * n_lanes + w;
+		for (auto j = 0; j < n_states; j++)
+			beta_prev[j * n_lanes + w] = beta_nii[k * n_states + j];
+	}
+	if (w_end >= 0 && w_end < n_lanes && t_end == win_size)
+		init_end(beta_prev.data(), w_end);
+
+	// compute beta values [trellis backward traversal <-] + compute the a posteriori values
+	for (auto t = win_size -1; t >= 0; t--)
+	{
+		if (w_end >= 0 && w_end < n_lanes && t +1 == t_end && t_end < win_size)
+			init_end(beta_prev.data(), w_end);
+
+		const auto alpha_t = alpha.data() + t * n_states * n_lanes;
+
+		auto r_max0 = mipp::Reg<R>(&alpha_t  [                0      ]) +
+		              mipp::Reg<R>(&beta_prev[beta_idx[0][0] * n_lanes]) +
+		              mipp::Reg<R>(&gamma[beta_gam[0][0]][t * n_lanes]);
+		auto r_max1 = mipp::Reg<R>(&alpha_t  [                0      ]) +
+		              mipp::Reg<R>(&beta_prev[beta_idx[1][0] * n_lanes]) -
+		              mipp::Reg<R>(&gamma[beta_gam[1][0]][t * n_lanes]);
+		for (auto j = 1; j < n_states; j++)
+		{
+			const auto r_a = mipp::Reg<R>(&alpha_t[j * n_lanes]);
+
+			r_max0 = MAX(r_max0, r_a + mipp::Reg<R>(&beta_prev[beta_idx[0][j] * n_lanes])
+			                         + mipp::Reg<R>(&gamma[beta_gam[0][j]][t * n_lanes]));
+			r_max1 = MAX(r_max1, r_a + mipp::Reg<R>(&beta_prev[beta_idx[1][j] * n_lanes])
+			                         - mipp::Reg<R>(&gamma[beta_gam[1][j]][t * n_lanes]));
+		}
+
+		RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1).store(&post[t * n_lanes]);
+
+		for (auto j = 0; j < n_states; j++)
+		{
+			const auto r_b1 = mipp::Reg<R>(&beta_prev[beta_idx[0][j] * n_lanes]);
+			const auto r_b2 = mipp::Reg<R>(&beta_prev[beta_idx[1][j] * n_lanes]);
+			const auto r_g1 = mipp::Reg<R>(&gamma[beta_gam[0][j]][t * n_lanes]);
+			const auto r_g2 = mipp::Reg<R>(&gamma[beta_gam[1][j]][t * n_lanes]);
+
+			MAX(r_b1 + r_g1, r_b2 - r_g2).store(&beta_cur[j * n_lanes]);
+		}
+
+		const auto r_norm = mipp::Reg<R>(&beta_cur[0]);
+		for (auto j = 0; j < n_states; j++)
+			RSC_BCJR_window_normalize<R>::apply(mipp::Reg<R>(&beta_cur[j * n_lanes]), r_norm)
+			                             .store(&beta_cur[j * n_lanes]);
+
+		std::swap(beta_prev, beta_cur);
+	}
+
+	// save the first beta values of each window for the initialization of the previous window
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		const auto k = batch * n_lanes + w;
+		if (k > 0)
+			for (auto j = 0; j < n_states; j++)
+				beta_nii[(k -1) * n_states + j] = beta_prev[j * n_lanes + w];
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::store_ext(const R *sys, R *ext, const int batch)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+
+	// scatter the windows of the batch
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		const auto off = (batch * n_lanes + w) * win_size;
+		const auto n   = std::min(win_size, this->K - off);
+		for (auto t = 0; t < n; t++)
+			ext[off + t] = post[t * n_lanes + w] - sys[off + t];
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	const auto n_batches = n_windows / mipp::nElReg<R>();
+	for (auto b = 0; b < n_batches; b++)
+	{
+		this->compute_gamma   (sys, par, b);
+		this->compute_alpha   (          b);
+		this->compute_beta_ext(          b);
+		this->store_ext       (sys, ext, b);
+	}
+}
+}
+}
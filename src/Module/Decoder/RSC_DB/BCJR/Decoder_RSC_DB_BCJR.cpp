@@ -16,22 +16,23 @@ Decoder_RSC_DB_BCJR<B,R>
 ::Decoder_RSC_DB_BCJR(const int K,
                       const std::vector<std::vector<int>> &trellis,
                       const bool buffered_encoding,
-                      const int n_frames)
-: Decoder               (K, 2 * K, n_frames, 1                   ),
-  Decoder_SISO_SIHO<B,R>(K, 2 * K, n_frames, 1                   ),
-  n_states              ((int)trellis[0].size()/4                ),
-  n_ff                  ((int)std::log2(n_states)                ),
-  buffered_encoding     (buffered_encoding                       ),
-  trellis               (trellis                                 ),
-  sys                   (2*K                                     ),
-  par                   (  K                                     ),
-  ext                   (2*K                                     ),
-  s                     (  K                                     ),
-  alpha_mp              (n_states                                ),
-  beta_mp               (n_states                                ),
-  alpha                 (K/2 + 1, std::vector<R>(n_states    , 0)),
-  beta                  (K/2 + 1, std::vector<R>(n_states    , 0)),
-  gamma                 (K/2    , std::vector<R>(n_states * 4, 0))
+                      const int n_frames,
+                      const int simd_inter_frame_level)
+: Decoder               (K, 2 * K, n_frames, simd_inter_frame_level                        ),
+  Decoder_SISO_SIHO<B,R>(K, 2 * K, n_frames, simd_inter_frame_level                        ),
+  n_states              ((int)trellis[0].size()/4                                          ),
+  n_ff                  ((int)std::log2(n_states)                                          ),
+  buffered_encoding     (buffered_encoding                                                 ),
+  trellis               (trellis                                                           ),
+  sys                   (2*K      * simd_inter_frame_level                                 ),
+  par                   (  K      * simd_inter_frame_level                                 ),
+  ext                   (2*K      * simd_inter_frame_level                                 ),
+  s                     (  K      * simd_inter_frame_level                                 ),
+  alpha_mp              (n_states * simd_inter_frame_level                                 ),
+  beta_mp               (n_states * simd_inter_frame_level                                 ),
+  alpha                 (K/2 + 1, mipp::vector<R>(n_states     * simd_inter_frame_level, 0)),
+  beta                  (K/2 + 1, mipp::vector<R>(n_states     * simd_inter_frame_level, 0)),
+  gamma                 (K/2    , mipp::vector<R>(n_states * 4 * simd_inter_frame_level, 0))
 {
 	const std::string name = "Decoder_RSC_DB_BCJR";
 	this->set_name(name);
@@ -81,8 +82,8 @@ void Decoder_RSC_DB_BCJR<B,R>
 			sys[4*i + 2] = -a + b;
 			sys[4*i + 3] = -a - b;
 
-			par[2*i  ] = Y_N[4*i + 2];
-			par[2*i+2] = Y_N[4*i + 3];
+			par[2*i  ] = tools::div2(Y_N[4*i + 2]);
+			par[2*i+1] = tools::div2(Y_N[4*i + 3]);
 		}
 	}
 }
@@ -138,7 +139,7 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::__init_alpha_beta()
 {
-	for (auto s = 0; s<n_states; s++)
+	for (auto s = 0; s < n_states * this->get_simd_inter_frame_level(); s++)
 	{
 		alpha[           0][s] = alpha_mp[s];
 		beta[beta.size()-1][s] =  beta_mp[s];
@@ -149,7 +150,7 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::__save_alpha_beta()
 {
-	for (auto s = 0; s < n_states; s++)
+	for (auto s = 0; s < n_states * this->get_simd_inter_frame_level(); s++)
 	{
 		alpha_mp[s] = alpha[alpha.size()-1][s];
 		 beta_mp[s] = beta[0][s];
@@ -160,7 +161,7 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::notify_new_frame()
 {
-	for (auto s = 0; s < n_states; s++)
+	for (auto s = 0; s < n_states * this->get_simd_inter_frame_level(); s++)
 	{
 		alpha_mp[s] = (R)0;
 		beta_mp [s] = (R)0;
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <mipp.h>
 
 #include "../../Decoder_SISO_SIHO.hpp"
 
@@ -20,17 +21,18 @@ protected:
 
 	const std::vector<std::vector<int>> &trellis;
 
-	std::vector<R> sys, par;          // input LLR from the channel
-	std::vector<R> ext;               // extrinsic LLRs
-	std::vector<B> s;                 // hard decision
-	std::vector<R> alpha_mp, beta_mp; // message passing
-	std::vector<std::vector<R>> alpha, beta, gamma;
+	mipp::vector<R> sys, par;          // input LLR from the channel
+	mipp::vector<R> ext;               // extrinsic LLRs
+	mipp::vector<B> s;                 // hard decision
+	mipp::vector<R> alpha_mp, beta_mp; // message passing
+	std::vector<mipp::vector<R>> alpha, beta, gamma;
 
 public:
 	Decoder_RSC_DB_BCJR(const int K,
 	                    const std::vector<std::vector<int>> &trellis,
 	                    const bool buffered_encoding = true,
-	                    const int n_frames = 1);
+	                    const int n_frames = 1,
+	                    const int simd_inter_frame_level = 1);
 	virtual ~Decoder_RSC_DB_BCJR();
 
 	void notify_new_frame();
@@ -0,0 +1,54 @@
+#ifndef DECODER_RSC_DB_BCJR_INTER_HPP_
+#define DECODER_RSC_DB_BCJR_INTER_HPP_
+
+#include <vector>
+#include <string>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_DB_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_DB_BCJR_inter
+ *
+ * \brief Double-binary BCJR on mipp::nElReg<R>() frames at once (one frame per SIMD lane), for any trellis.
+ *
+ * The data of the frames are interleaved: the element 'i' of the frame 'f' is stored at 'i * n_frames + f' (in
+ * 'sys', 'par', 'ext' and 's' but also in the node metrics 'alpha' and 'beta'). The 16 branch metrics of a double-binary
+ * symbol (4 systematic couples x 4 parity couples) are computed once and indexed by the transitions of the trellis.
+ * The max-log-MAP and the Log-MAP algorithms are obtained with the 'MAX' function (tools::max_i or tools::max_star_i).
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_DB_BCJR_inter : public Decoder_RSC_DB_BCJR<B,R>
+{
+protected:
+	mipp::vector<R>  Y_N_inter;  // the interleaved frames
+	std::vector<int> next_state; // state reached from 'state' with the symbol 'j' (state * 4 + j)
+	std::vector<int> prev_state; // state leading to 'state' with the symbol 'j' (state * 4 + j)
+	std::vector<int> gamma_idx;  // branch metric of the transition from 'state' with the symbol 'j' (state * 4 + j)
+
+public:
+	Decoder_RSC_DB_BCJR_inter(const int K,
+	                          const std::vector<std::vector<int>> &trellis,
+	                          const bool buffered_encoding = true,
+	                          const int n_frames = 1);
+	virtual ~Decoder_RSC_DB_BCJR_inter();
+
+protected:
+	void _load          (const R *Y_N                                          );
+	void _store         (              B *V_K                                  ) const;
+	void _decode_siho   (const R *Y_N, B *V_K,               const int frame_id);
+	void __fwd_recursion(const R *sys, const R *par                            );
+	void __bwd_recursion(const R *sys, const R *par, R* ext                    );
+};
+}
+}
+
+#include "Decoder_RSC_DB_BCJR_inter.hxx"
+
+#endif /* DECODER_RSC_DB_BCJR_INTER_HPP_ */
@@ -0,0 +1,213 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Decoder_RSC_DB_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::Decoder_RSC_DB_BCJR_inter(const int K,
+                            const std::vector<std::vector<int>> &trellis,
+                            const bool buffered_encoding,
+                            const int n_frames)
+: Decoder(K, 2 * K, n_frames, mipp::nElReg<R>()),
+  Decoder_RSC_DB_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::nElReg<R>()),
+  Y_N_inter (2 * K * mipp::nElReg<R>()),
+  next_state(this->n_states * 4),
+  prev_state(this->n_states * 4),
+  gamma_idx (this->n_states * 4)
+{
+	const std::string name = "Decoder_RSC_DB_BCJR_inter";
+	this->set_name(name);
+
+	// the 16 branch metrics are stored in the 'gamma' buffer of the base class (n_states * 4 per symbol)
+	if (this->n_states < 4)
+	{
+		std::stringstream message;
+		message << "'n_states' has to be equal or greater than 4 ('n_states' = " << this->n_states << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto i = 0; i < this->n_states * 4; i++)
+	{
+		const auto j = i % 4;
+		next_state[i] = trellis[0][i];
+		prev_state[i] = trellis[1][i];
+		gamma_idx [i] = 4 * j + 2 * (trellis[2][i] < 0) + (trellis[3][i] < 0);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::~Decoder_RSC_DB_BCJR_inter()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::_load(const R *Y_N)
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	this->notify_new_frame();
+
+	std::vector<const R*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,n_frames>::apply(frames, Y_N_inter.data(), this->N);
+
+	const auto Y = Y_N_inter.data();
+	for (auto i = 0; i < this->K / 2; i++)
+	{
+		const auto idx_a = this->buffered_encoding ? 2*i   : 4*i;
+		const auto idx_b = this->buffered_encoding ? 2*i+1 : 4*i+1;
+
+		const auto r_a = mipp::div2(mipp::Reg<R>(&Y[idx_a * n_frames]));
+		const auto r_b = mipp::div2(mipp::Reg<R>(&Y[idx_b * n_frames]));
+
+		( r_a + r_b).store(&this->sys[(4*i + 0) * n_frames]);
+		( r_a - r_b).store(&this->sys[(4*i + 1) * n_frames]);
+		(-r_a + r_b).store(&this->sys[(4*i + 2) * n_frames]);
+		(-r_a - r_b).store(&this->sys[(4*i + 3) * n_frames]);
+	}
+
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto idx_p = this->buffered_encoding ? this->K + i : 4*(i/2) + 2 + (i%2);
+		mipp::div2(mipp::Reg<R>(&Y[idx_p * n_frames])).store(&this->par[i * n_frames]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	this->_load(Y_N);
+	this->_decode_siso(this->sys.data(), this->par.data(), this->ext.data(), frame_id);
+
+	const auto sys = this->sys.data();
+	const auto ext = this->ext.data();
+	for (auto i = 0; i < this->K; i += 2)
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto a0 = ext[(2*i+0) * n_frames +f] + sys[(2*i+0) * n_frames +f];
+			const auto a1 = ext[(2*i+1) * n_frames +f] + sys[(2*i+1) * n_frames +f];
+			const auto a2 = ext[(2*i+2) * n_frames +f] + sys[(2*i+2) * n_frames +f];
+			const auto a3 = ext[(2*i+3) * n_frames +f] + sys[(2*i+3) * n_frames +f];
+
+			this->s[(i+0) * n_frames +f] = (std::max(a2, a3) - std::max(a0, a1)) > 0;
+			this->s[(i+1) * n_frames +f] = (std::max(a1, a3) - std::max(a0, a2)) > 0;
+		}
+
+	this->_store(V_K);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::_store(B *V_K) const
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	std::vector<B*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->K);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__fwd_recursion(const R *sys, const R *par)
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	for (auto k = 0; k < this->K/2; k++)
+	{
+		const auto r_y = mipp::Reg<R>(&par[(2*k  ) * n_frames]);
+		const auto r_w = mipp::Reg<R>(&par[(2*k+1) * n_frames]);
+
+		// the 16 branch metrics: 4 systematic couples x 4 parity couples
+		auto gamma = this->gamma[k].data();
+		for (auto j = 0; j < 4; j++)
+		{
+			const auto r_sys = mipp::Reg<R>(&sys[(4*k + j) * n_frames]);
+
+			(r_sys + r_y + r_w).store(&gamma[(4*j + 0) * n_frames]);
+			(r_sys + r_y - r_w).store(&gamma[(4*j + 1) * n_frames]);
+			(r_sys - r_y + r_w).store(&gamma[(4*j + 2) * n_frames]);
+			(r_sys - r_y - r_w).store(&gamma[(4*j + 3) * n_frames]);
+		}
+
+		const auto alpha_k  = this->alpha[k   ].data();
+		      auto alpha_k1 = this->alpha[k +1].data();
+		for (auto s = 0; s < this->n_states; s++)
+		{
+			const auto s0 = prev_state[4*s + 0], s1 = prev_state[4*s + 1];
+			const auto s2 = prev_state[4*s + 2], s3 = prev_state[4*s + 3];
+
+			const auto r_a0 = mipp::Reg<R>(&alpha_k[s0 * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s0 + 0] * n_frames]);
+			const auto r_a1 = mipp::Reg<R>(&alpha_k[s1 * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s1 + 1] * n_frames]);
+			const auto r_a2 = mipp::Reg<R>(&alpha_k[s2 * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s2 + 2] * n_frames]);
+			const auto r_a3 = mipp::Reg<R>(&alpha_k[s3 * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s3 + 3] * n_frames]);
+
+			MAX(MAX(r_a0, r_a1), MAX(r_a2, r_a3)).store(&alpha_k1[s * n_frames]);
+		}
+
+		const auto r_norm = mipp::Reg<R>(&alpha_k1[0]);
+		for (auto s = 0; s < this->n_states; s++)
+			(mipp::Reg<R>(&alpha_k1[s * n_frames]) - r_norm).store(&alpha_k1[s * n_frames]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__bwd_recursion(const R *sys, const R * /*par*/, R* ext)
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	for (auto k = this->K/2 - 1; k >= 0; k--)
+	{
+		const auto gamma    = this->gamma[k   ].data();
+		const auto alpha_k  = this->alpha[k   ].data();
+		      auto beta_k   = this->beta [k   ].data();
+		const auto beta_k1  = this->beta [k +1].data();
+
+		for (auto s = 0; s < this->n_states; s++)
+		{
+			const auto r_b0 = mipp::Reg<R>(&beta_k1[next_state[4*s + 0] * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s + 0] * n_frames]);
+			const auto r_b1 = mipp::Reg<R>(&beta_k1[next_state[4*s + 1] * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s + 1] * n_frames]);
+			const auto r_b2 = mipp::Reg<R>(&beta_k1[next_state[4*s + 2] * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s + 2] * n_frames]);
+			const auto r_b3 = mipp::Reg<R>(&beta_k1[next_state[4*s + 3] * n_frames]) + mipp::Reg<R>(&gamma[gamma_idx[4*s + 3] * n_frames]);
+
+			MAX(MAX(r_b0, r_b1), MAX(r_b2, r_b3)).store(&beta_k[s * n_frames]);
+		}
+
+		const auto r_norm = mipp::Reg<R>(&beta_k[0]);
+		for (auto s = 0; s < this->n_states; s++)
+			(mipp::Reg<R>(&beta_k[s * n_frames]) - r_norm).store(&beta_k[s * n_frames]);
+
+		for (auto j = 0; j < 4; j++)
+		{
+			auto r_post = mipp::Reg<R>(&alpha_k[0])
+			            + mipp::Reg<R>(&gamma  [gamma_idx [j] * n_frames])
+			            + mipp::Reg<R>(&beta_k1[next_state[j] * n_frames]);
+
+			for (auto s = 1; s < this->n_states; s++)
+				r_post = MAX(r_post, mipp::Reg<R>(&alpha_k[s * n_frames])
+				                   + mipp::Reg<R>(&gamma  [gamma_idx [4*s + j] * n_frames])
+				                   + mipp::Reg<R>(&beta_k1[next_state[4*s + j] * n_frames]));
+
+			(r_post - mipp::Reg<R>(&sys[(4*k + j) * n_frames])).store(&ext[(4*k + j) * n_frames]);
+		}
+	}
+}
+}
+}
@@ -136,6 +136,10 @@ template <typename B, typename R>
 void Decoder_turbo<B,R>
 ::_load(const R *Y_N, const int frame_id)
 {
+	// the SISO decoders can keep some metrics from an iteration to another (NII), a new frame starts here
+	siso_n.reset();
+	siso_i.reset();
+
 	if (buffered_encoding)
 		this->buffered_load(Y_N, frame_id);
 	else
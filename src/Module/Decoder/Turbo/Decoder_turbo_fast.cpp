@@ -91,6 +91,9 @@ void Decoder_turbo_fast<B,R>
 		}
 
 		std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
+
+		this->siso_n.reset();
+		this->siso_i.reset();
 	}
 	else
 		Decoder_turbo<B,R>::_load(Y_N, frame_id);
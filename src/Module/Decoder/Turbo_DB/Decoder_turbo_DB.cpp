@@ -24,18 +24,18 @@ Decoder_turbo_DB<B,R>
   pi               (pi),
   siso_n           (siso_n),
   siso_i           (siso_i),
-  l_cpy            (2 * K),
-  l_sn             (2 * K),
-  l_si             (2 * K),
-  l_sen            (2 * K),
-  l_sei            (2 * K),
-  l_pn             (    K),
-  l_pi             (    K),
-  l_e1n            (2 * K),
-  l_e2n            (2 * K),
-  l_e1i            (2 * K),
-  l_e2i            (2 * K),
-  s                (    K)
+  l_cpy            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sn             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_si             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sen            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sei            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_pn             (    K * siso_n.get_simd_inter_frame_level()),
+  l_pi             (    K * siso_n.get_simd_inter_frame_level()),
+  l_e1n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e1i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  s                (    K * siso_n.get_simd_inter_frame_level())
 {
 	const std::string name = "Decoder_turbo_DB";
 	this->set_name(name);
@@ -86,11 +86,13 @@ Decoder_turbo_DB<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (siso_n.get_simd_inter_frame_level() != 1)
+	// the SIMD inter frame level is set by the most derived class (1 here, the SISO one in Decoder_turbo_DB_fast)
+	if (siso_n.get_simd_inter_frame_level() != this->get_simd_inter_frame_level())
 	{
 		std::stringstream message;
-		message << "'siso_n.get_simd_inter_frame_level()' has to be equal to 1 "
-		        << "('siso_n.get_simd_inter_frame_level()' = " << siso_n.get_simd_inter_frame_level() << ").";
+		message << "'siso_n.get_simd_inter_frame_level()' has to be equal to 'get_simd_inter_frame_level()' "
+		        << "('siso_n.get_simd_inter_frame_level()' = " << siso_n.get_simd_inter_frame_level()
+		        << ", 'get_simd_inter_frame_level()' = " << this->get_simd_inter_frame_level() << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
@@ -0,0 +1,255 @@
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Decoder_turbo_DB_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_turbo_DB_fast<B,R>
+::Decoder_turbo_DB_fast(const int& K,
+                        const int& N,
+                        const int& n_ite,
+                        const Interleaver<R> &pi,
+                        Decoder_RSC_DB_BCJR<B,R> &siso_n,
+                        Decoder_RSC_DB_BCJR<B,R> &siso_i)
+: Decoder(K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
+  Decoder_turbo_DB<B,R>(K, N, n_ite, pi, siso_n, siso_i),
+  Y_N_inter(siso_n.get_simd_inter_frame_level() > 1 ? N * siso_n.get_simd_inter_frame_level() : 0)
+{
+	const std::string name = "Decoder_turbo_DB_fast";
+	this->set_name(name);
+
+	if (siso_n.get_simd_inter_frame_level() != 1 && siso_n.get_simd_inter_frame_level() != mipp::nElReg<R>())
+	{
+		std::stringstream message;
+		message << "'siso_n.get_simd_inter_frame_level()' has to be equal to 1 or to 'mipp::nElReg<R>()' "
+		        << "('siso_n.get_simd_inter_frame_level()' = " << siso_n.get_simd_inter_frame_level()
+		        << ", 'mipp::nElReg<R>()' = " << mipp::nElReg<R>() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+Decoder_turbo_DB_fast<B,R>
+::~Decoder_turbo_DB_fast()
+{
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB_fast<B,R>
+::interleave(const mipp::vector<R> &nat, mipp::vector<R> &itl) const
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	// 1) inversion of the symbols of the even couples, 2) permutation of the couples
+	const auto &lut_inv = this->pi.get_core().get_lut_inv();
+	for (auto i = 0; i < this->K / 2; i++)
+	{
+		const auto l = (int)lut_inv[i];
+		const auto swap = (l % 2) == 0;
+
+		const auto r_s0 = mipp::Reg<R>(&nat[(4*l + 0) * n_frames]);
+		const auto r_s1 = mipp::Reg<R>(&nat[(4*l + 1) * n_frames]);
+		const auto r_s2 = mipp::Reg<R>(&nat[(4*l + 2) * n_frames]);
+		const auto r_s3 = mipp::Reg<R>(&nat[(4*l + 3) * n_frames]);
+
+		r_s0                .store(&itl[(4*i + 0) * n_frames]);
+		(swap ? r_s2 : r_s1).store(&itl[(4*i + 1) * n_frames]);
+		(swap ? r_s1 : r_s2).store(&itl[(4*i + 2) * n_frames]);
+		r_s3                .store(&itl[(4*i + 3) * n_frames]);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB_fast<B,R>
+::deinterleave(const mipp::vector<R> &itl, mipp::vector<R> &nat) const
+{
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	// 1) inverse permutation of the couples, 2) inversion of the symbols of the even couples
+	const auto &lut = this->pi.get_core().get_lut();
+	for (auto i = 0; i < this->K / 2; i++)
+	{
+		const auto l = (int)lut[i];
+		const auto swap = (i % 2) == 0;
+
+		const auto r_s0 = mipp::Reg<R>(&itl[(4*l + 0) * n_frames]);
+		const auto r_s1 = mipp::Reg<R>(&itl[(4*l + 1) * n_frames]);
+		const auto r_s2 = mipp::Reg<R>(&itl[(4*l + 2) * n_frames]);
+		const auto r_s3 = mipp::Reg<R>(&itl[(4*l + 3) * n_frames]);
+
+		r_s0                .store(&nat[(4*i + 0) * n_frames]);
+		(swap ? r_s2 : r_s1).store(&nat[(4*i + 1) * n_frames]);
+		(swap ? r_s1 : r_s2).store(&nat[(4*i + 2) * n_frames]);
+		r_s3                .store(&nat[(4*i + 3) * n_frames]);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB_fast<B,R>
+::_load(const R *Y_N)
+{
+	if (this->get_simd_inter_frame_level() == 1)
+	{
+		Decoder_turbo_DB<B,R>::_load(Y_N);
+		return;
+	}
+
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	this->siso_n.notify_new_frame();
+	this->siso_i.notify_new_frame();
+
+	std::vector<const R*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,n_frames>::apply(frames, Y_N_inter.data(), this->N);
+
+	auto j = 0;
+	for (auto i = 0; i < this->K/2; i++)
+	{
+		const auto r_a = mipp::div2(mipp::Reg<R>(&Y_N_inter[(j++) * n_frames]));
+		const auto r_b = mipp::div2(mipp::Reg<R>(&Y_N_inter[(j++) * n_frames]));
+
+		( r_a + r_b).store(&this->l_sn[(4*i + 0) * n_frames]);
+		( r_a - r_b).store(&this->l_sn[(4*i + 1) * n_frames]);
+		(-r_a + r_b).store(&this->l_sn[(4*i + 2) * n_frames]);
+		(-r_a - r_b).store(&this->l_sn[(4*i + 3) * n_frames]);
+	}
+
+	for (auto i = 0; i < this->K; i+=2)
+	{
+		mipp::div2(mipp::Reg<R>(&Y_N_inter[(j++) * n_frames])).store(&this->l_pn[i * n_frames]);
+		mipp::div2(mipp::Reg<R>(&Y_N_inter[(j++) * n_frames])).store(&this->l_pi[i * n_frames]);
+	}
+
+	for (auto i = 1; i < this->K; i+=2)
+	{
+		mipp::div2(mipp::Reg<R>(&Y_N_inter[(j++) * n_frames])).store(&this->l_pn[i * n_frames]);
+		mipp::div2(mipp::Reg<R>(&Y_N_inter[(j++) * n_frames])).store(&this->l_pi[i * n_frames]);
+	}
+
+	this->interleave(this->l_sn, this->l_si);
+
+	std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	if (this->get_simd_inter_frame_level() == 1)
+	{
+		Decoder_turbo_DB<B,R>::_decode_siho(Y_N, V_K, frame_id);
+		return;
+	}
+
+	this->_load(Y_N);
+
+	constexpr auto n_frames = mipp::nElReg<R>();
+	const auto size = 2 * this->K * n_frames;
+
+	// iterative turbo decoding process
+	bool stop = false;
+	auto ite  = 1;
+	do
+	{
+		// sys + ext
+		for (auto i = 0; i < size; i += n_frames)
+			(mipp::Reg<R>(&this->l_sn[i]) + mipp::Reg<R>(&this->l_e1n[i])).store(&this->l_sen[i]);
+
+		// SISO in the natural domain
+		this->siso_n.decode_siso(this->l_sen.data(), this->l_pn.data(), this->l_e2n.data(), n_frames);
+
+		for (auto cb : this->callbacks_siso_n)
+		{
+			stop = cb(ite, this->l_sen, this->l_e2n, this->s);
+			if (stop) break;
+		}
+
+		if (!stop)
+		{
+			// make the interleaving
+			this->interleave(this->l_e2n, this->l_e1i);
+
+			// sys + ext
+			for (auto i = 0; i < size; i += n_frames)
+				(mipp::Reg<R>(&this->l_si[i]) + mipp::Reg<R>(&this->l_e1i[i])).store(&this->l_sei[i]);
+
+			// SISO in the interleaved domain
+			this->siso_i.decode_siso(this->l_sei.data(), this->l_pi.data(), this->l_e2i.data(), n_frames);
+
+			for (auto cb : this->callbacks_siso_i)
+			{
+				stop = cb(ite, this->l_sei, this->l_e2i);
+				if (stop) break;
+			}
+
+			if (ite == this->n_ite || stop)
+				// add the systematic information to the extrinsic information, gives the a posteriori information
+				for (auto i = 0; i < size; i += n_frames)
+					(mipp::Reg<R>(&this->l_e2i[i]) + mipp::Reg<R>(&this->l_sei[i])).store(&this->l_e2i[i]);
+
+			// make the deinterleaving
+			this->deinterleave(this->l_e2i, this->l_e1n);
+
+			// compute the hard decision only if we are in the last iteration
+			if (ite == this->n_ite || stop)
+			{
+				const auto l_e1n = this->l_e1n.data();
+				for (auto i = 0; i < this->K; i += 2)
+					for (auto f = 0; f < n_frames; f++)
+					{
+						const auto a0 = l_e1n[(2*i+0) * n_frames +f], a1 = l_e1n[(2*i+1) * n_frames +f];
+						const auto a2 = l_e1n[(2*i+2) * n_frames +f], a3 = l_e1n[(2*i+3) * n_frames +f];
+
+						this->s[(i+0) * n_frames +f] = (std::max(a2, a3) - std::max(a0, a1)) > 0;
+						this->s[(i+1) * n_frames +f] = (std::max(a1, a3) - std::max(a0, a2)) > 0;
+					}
+			}
+		}
+		ite++; // increment the number of iteration
+	}
+	while ((ite <= this->n_ite) && !stop);
+
+	for (auto cb : this->callbacks_end)
+		cb(ite -1);
+
+	this->_store(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB_fast<B,R>
+::_store(B *V_K) const
+{
+	if (this->get_simd_inter_frame_level() == 1)
+	{
+		Decoder_turbo_DB<B,R>::_store(V_K);
+		return;
+	}
+
+	constexpr auto n_frames = mipp::nElReg<R>();
+
+	std::vector<B*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->K);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_turbo_DB_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_turbo_DB_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_turbo_DB_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_turbo_DB_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_turbo_DB_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
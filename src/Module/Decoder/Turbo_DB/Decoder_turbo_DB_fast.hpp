@@ -0,0 +1,44 @@
+#ifndef DECODER_TURBO_DB_FAST_HPP
+#define DECODER_TURBO_DB_FAST_HPP
+
+#include "Decoder_turbo_DB.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_turbo_DB_fast
+ *
+ * \brief Same as the Decoder_turbo_DB but the SISO decoders can decode several frames at once (SIMD inter-frame, see
+ *        the Decoder_RSC_DB_BCJR_inter): the frames are interleaved, the extrinsic exchanges are made with SIMD
+ *        registers and the (de)interleaving moves the 4 symbol metrics of a couple for all the frames at once.
+ */
+template <typename B = int, typename R = float>
+class Decoder_turbo_DB_fast : public Decoder_turbo_DB<B,R>
+{
+protected:
+	mipp::vector<R> Y_N_inter; // the interleaved frames
+
+public:
+	Decoder_turbo_DB_fast(const int& K,
+	                      const int& N,
+	                      const int& n_ite,
+	                      const Interleaver<R> &pi,
+	                      Decoder_RSC_DB_BCJR<B,R> &siso_n,
+	                      Decoder_RSC_DB_BCJR<B,R> &siso_i);
+	virtual ~Decoder_turbo_DB_fast();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _load       (const R *Y_N                            );
+	void _store      (              B *V_K                    ) const;
+
+private:
+	void interleave  (const mipp::vector<R> &nat, mipp::vector<R> &itl) const;
+	void deinterleave(const mipp::vector<R> &itl, mipp::vector<R> &nat) const;
+};
+}
+}
+
+#endif /* DECODER_TURBO_DB_FAST_HPP */
@@ -11,10 +11,13 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <cstdint>
 #include <numeric>
 #include <algorithm>
+#include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -26,12 +29,13 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { encode, SIZE };
+			enum list { encode, encode_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace encode { enum list { U_K, X_N, SIZE }; }
+			namespace encode        { enum list { U_K, X_N, SIZE }; }
+			namespace encode_packed { enum list { U_K, X_N, SIZE }; }
 		}
 	}
 
@@ -58,6 +62,9 @@ protected:
 	std::vector<std::vector<B>> U_K_mem;
 	std::vector<std::vector<B>> X_N_mem;
 
+	mipp::vector<B> U_K_unpacked; // allocated on the first call of the generic '_encode_packed'
+	mipp::vector<B> X_N_unpacked;
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -113,6 +120,19 @@ public:
 			return 0;
 		});
 
+		auto &p2 = this->create_task("encode_packed");
+		auto &p2s_U_K = this->template create_socket_in <B>(p2, "U_K", tools::Bit_packer<B>::get_packed_size(this->K)
+		                                                                * this->n_frames);
+		auto &p2s_X_N = this->template create_socket_out<B>(p2, "X_N", tools::Bit_packer<B>::get_packed_size(this->N)
+		                                                                * this->n_frames);
+		this->create_codelet(p2, [this, &p2s_U_K, &p2s_X_N]() -> int
+		{
+			this->encode_packed(static_cast<B*>(p2s_U_K.get_dataptr()),
+			                    static_cast<B*>(p2s_X_N.get_dataptr()));
+
+			return 0;
+		});
+
 		std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
 	}
 
@@ -238,6 +258,36 @@ public:
 				          X_N_mem[f].begin());
 	}
 
+	/*!
+	 * \brief Same as 'encode' but the frames are packed in 64-bit words (see 'tools::Bit_packer::get_packed_size').
+	 *
+	 * \param U_K: the packed information bits (ceil(K / 64) words per frame).
+	 * \param X_N: the packed encoded frames (ceil(N / 64) words per frame).
+	 */
+	virtual void encode_packed(const B *U_K, B *X_N, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		const auto n_words_K = (this->K + 63) / 64;
+		const auto n_words_N = (this->N + 63) / 64;
+		const auto *words_K = reinterpret_cast<const uint64_t*>(U_K);
+		      auto *words_N = reinterpret_cast<      uint64_t*>(X_N);
+
+		if (this->is_memorizing())
+			for (auto f = f_start; f < f_stop; f++)
+				tools::Bit_packer<B>::unpack_words(words_K + f * n_words_K, U_K_mem[f].data(), this->K);
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_encode_packed(words_K + f * n_words_K,
+			                     words_N + f * n_words_N,
+			                     f);
+
+		if (this->is_memorizing())
+			for (auto f = f_start; f < f_stop; f++)
+				tools::Bit_packer<B>::unpack_words(words_N + f * n_words_N, X_N_mem[f].data(), this->N);
+	}
+
 	template <class A = std::allocator<B>>
 	bool is_codeword(const std::vector<B,A>& X_N)
 	{
@@ -278,6 +328,20 @@ protected:
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
 
+	// the frames are unpacked, encoded and packed again, the encoders which work on the words directly override it
+	virtual void _encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id)
+	{
+		if (this->U_K_unpacked.empty())
+		{
+			this->U_K_unpacked.resize(this->K);
+			this->X_N_unpacked.resize(this->N);
+		}
+
+		tools::Bit_packer<B>::unpack_words(U_K, this->U_K_unpacked.data(), this->K);
+		this->_encode(this->U_K_unpacked.data(), this->X_N_unpacked.data(), frame_id);
+		tools::Bit_packer<B>::pack_words(this->X_N_unpacked.data(), X_N, this->N);
+	}
+
 	void set_sys(const bool sys)
 	{
 		this->sys = sys;
@@ -1,10 +1,12 @@
 #include <numeric>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Math/matrix.h"
+#include "Tools/Math/bits.h"
 
 #include "Encoder_LDPC.hpp"
 
@@ -52,6 +54,8 @@ Encoder_LDPC<B>
 			full_G[i * N + CN_to_VN[i][j]] = 1;
 
 	tools::real_transpose(K, N, full_G, tG); // transposed for computation matter
+
+	this->init_G_rows(G);
 }
 
 template <typename B>
@@ -71,6 +75,41 @@ void Encoder_LDPC<B>
 		X_N[j] %= 2;
 }
 
+template <typename B>
+void Encoder_LDPC<B>
+::_encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id)
+{
+	if (this->G_rows.empty())
+	{
+		Encoder<B>::_encode_packed(U_K, X_N, frame_id);
+		return;
+	}
+
+	// the codeword is the XOR of the codewords of the information bits equal to 1
+	const auto n_words = (this->N + 63) / 64;
+	std::fill(X_N, X_N + n_words, (uint64_t)0);
+	for (auto w = 0; w < (this->K + 63) / 64; w++)
+		for (auto word = U_K[w]; word; word &= word -1)
+		{
+			const auto *g = this->G_rows.data() + (size_t)(w * 64 + tools::ctz(word)) * n_words;
+			for (auto n = 0; n < n_words; n++)
+				X_N[n] ^= g[n];
+		}
+}
+
+template <typename B>
+void Encoder_LDPC<B>
+::init_G_rows(const tools::Sparse_matrix &G)
+{
+	const auto n_words = (this->N + 63) / 64;
+	this->G_rows.assign((size_t)this->K * n_words, 0);
+
+	auto &CN_to_VN = G.get_col_to_rows();
+	for (auto k = 0; k < this->K; k++)
+		for (auto n : CN_to_VN[k])
+			this->G_rows[(size_t)k * n_words + (n >> 6)] |= (uint64_t)1 << (n & 63);
+}
+
 template <typename B>
 const std::vector<uint32_t>& Encoder_LDPC<B>
 ::get_info_bits_pos()
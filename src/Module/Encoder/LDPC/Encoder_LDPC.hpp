@@ -2,6 +2,7 @@
 #define ENCODER_LDPC_HPP_
 
 #include <vector>
+#include <cstdint>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
@@ -16,7 +17,8 @@ template <typename B = int>
 class Encoder_LDPC : public Encoder<B>
 {
 protected:
-	std::vector<B> tG; // the generator matrix
+	std::vector<B>        tG;     // the generator matrix
+	std::vector<uint64_t> G_rows; // packed codeword of each information bit (K x ceil(N / 64)), empty if unknown
 
 protected:
 	Encoder_LDPC(const int K, const int N, const int n_frames = 1);
@@ -29,7 +31,11 @@ public:
 	virtual bool is_sys() const;
 
 protected:
-	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+	virtual void _encode       (const B        *U_K, B        *X_N, const int frame_id);
+	virtual void _encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id);
+
+	// pack the columns of G (N x K, position of ones by column) in 'G_rows'
+	void init_G_rows(const tools::Sparse_matrix &G);
 };
 
 }
@@ -15,8 +15,11 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_H<B>
-::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames)
-: Encoder_LDPC<B>(K, N, n_frames), G(tools::LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos)), H(H)
+::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames,
+                      const std::string &G_cache_dir)
+: Encoder_LDPC<B>(K, N, n_frames),
+  G (tools::LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos, G_cache_dir)),
+  H (H)
 {
 	const std::string name = "Encoder_LDPC_from_H";
 	this->set_name(name);
@@ -49,31 +52,50 @@ template <typename B>
 void Encoder_LDPC_from_H<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
+	// flat representation of G (owned by G, built once)
+	const auto &Gc = this->G.get_compressed();
+	const auto *row_ptr = Gc.row_ptr.data();
+	const auto *row_idx = Gc.row_idx.data();
+
 	for (unsigned i = 0; i < G.get_n_rows(); i++)
 	{
 		X_N[i] = 0;
-		for (unsigned j = 0; j < G.get_cols_from_row(i).size(); j++)
-			X_N[i] += U_K[ G.get_cols_from_row(i)[j] ];
+		for (auto j = row_ptr[i]; j < row_ptr[i +1]; j++)
+			X_N[i] += U_K[ row_idx[j] ];
 		X_N[i] %= 2;
 	}
 }
 
+template <typename B>
+void Encoder_LDPC_from_H<B>
+::_encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id)
+{
+	// the packed G (one bit per entry) is only built when the packed frames are used
+	if (this->G_rows.empty())
+		this->init_G_rows(this->G);
+
+	Encoder_LDPC<B>::_encode_packed(U_K, X_N, frame_id);
+}
+
 template <typename B>
 bool Encoder_LDPC_from_H<B>
 ::is_codeword(const B *X_N)
 {
 	auto syndrome = false;
 
+	const auto &Hc = this->H.get_compressed();
+	const auto *col_ptr = Hc.col_ptr.data();
+	const auto *col_idx = Hc.col_idx.data();
+
 	const auto n_CN = (int)this->H.get_n_cols();
 	auto i = 0;
 	while (i < n_CN && !syndrome)
 	{
 		auto sign = 0;
 
-		const auto n_VN = (int)this->H[i].size();
-		for (auto j = 0; j < n_VN; j++)
+		for (auto j = col_ptr[i]; j < col_ptr[i +1]; j++)
 		{
-			const auto bit = X_N[this->H[i][j]];
+			const auto bit = X_N[col_idx[j]];
 			const auto tmp_sign = bit ? -1 : 0;
 
 			sign ^= tmp_sign;
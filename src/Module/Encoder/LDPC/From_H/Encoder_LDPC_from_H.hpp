@@ -2,6 +2,7 @@
 #define ENCODER_LDPC_FROM_H_HPP_
 
 #include <vector>
+#include <string>
 
 #include "../Encoder_LDPC.hpp"
 
@@ -21,7 +22,8 @@ protected:
 	tools::Sparse_matrix H;
 
 public:
-	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1,
+	                    const std::string &G_cache_dir = "");
 	virtual ~Encoder_LDPC_from_H();
 
 	bool is_codeword(const B *X_N);
@@ -31,7 +33,8 @@ public:
 	bool is_sys() const;
 
 protected:
-	void _encode(const B *U_K, B *X_N, const int frame_id);
+	void _encode       (const B        *U_K, B        *X_N, const int frame_id);
+	void _encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id);
 };
 
 }
@@ -1,8 +1,10 @@
 #include <vector>
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Math/bits.h"
 
 #include "Encoder_polar.hpp"
 
@@ -11,7 +13,8 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_polar<B>
 ::Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames)
-: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N)
+: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N),
+  info_mask((N + 63) / 64, 0)
 {
 	const std::string name = "Encoder_polar";
 	this->set_name(name);
@@ -45,6 +48,14 @@ void Encoder_polar<B>
 	this->light_encode(X_N);
 }
 
+template <typename B>
+void Encoder_polar<B>
+::_encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id)
+{
+	this->convert_packed(U_K, X_N);
+	this->light_encode_packed(X_N);
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::light_encode(B *bits)
@@ -55,6 +66,32 @@ void Encoder_polar<B>
 				bits[j + i] = bits[j + i] ^ bits[k + j + i];
 }
 
+template <typename B>
+void Encoder_polar<B>
+::light_encode_packed(uint64_t *bits)
+{
+	// the stages which combine different words (k is a number of words)
+	const auto n_words = (this->N + 63) / 64;
+	for (auto k = (n_words >> 1); k > 0; k >>= 1)
+		for (auto j = 0; j < n_words; j += 2 * k)
+			for (auto i = 0; i < k; i++)
+				bits[j + i] ^= bits[k + j + i];
+
+	// the stages inside a word: the bits whose position has a 0 at the bit 'k' are XORed with the bits at 'k' positions
+	// above (when N < 64, the stages which exceed N only read the padding bits which are zero)
+	for (auto w = 0; w < n_words; w++)
+	{
+		auto x = bits[w];
+		x ^= (x >> 32) & 0x00000000FFFFFFFFull;
+		x ^= (x >> 16) & 0x0000FFFF0000FFFFull;
+		x ^= (x >>  8) & 0x00FF00FF00FF00FFull;
+		x ^= (x >>  4) & 0x0F0F0F0F0F0F0F0Full;
+		x ^= (x >>  2) & 0x3333333333333333ull;
+		x ^= (x >>  1) & 0x5555555555555555ull;
+		bits[w] = x;
+	}
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::convert(const B *U_K, B *U_N)
@@ -76,6 +113,21 @@ void Encoder_polar<B>
 	}
 }
 
+template <typename B>
+void Encoder_polar<B>
+::convert_packed(const uint64_t *U_K, uint64_t *U_N)
+{
+	std::fill(U_N, U_N + (this->N + 63) / 64, (uint64_t)0);
+
+	// only the information bits equal to 1 are moved
+	for (auto w = 0; w < (this->K + 63) / 64; w++)
+		for (auto word = U_K[w]; word; word &= word -1)
+		{
+			const auto n = this->info_bits_pos[w * 64 + tools::ctz(word)];
+			U_N[n >> 6] |= (uint64_t)1 << (n & 63);
+		}
+}
+
 template <typename B>
 bool Encoder_polar<B>
 ::is_codeword(const B *X_N)
@@ -103,6 +155,11 @@ void Encoder_polar<B>
 	for (auto n = 0; n < this->N; n++)
 		if (!frozen_bits[n])
 			this->info_bits_pos[k++] = n;
+
+	std::fill(this->info_mask.begin(), this->info_mask.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (!frozen_bits[n])
+			this->info_mask[n >> 6] |= (uint64_t)1 << (n & 63);
 }
 
 // ==================================================================================== explicit template instantiation 
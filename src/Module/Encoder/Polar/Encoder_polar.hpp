@@ -18,20 +18,24 @@ protected:
 	const int                m;           // log_2 of code length
 	const std::vector<bool>& frozen_bits; // true means frozen, false means set to 0/1
 	      std::vector<B>     X_N_tmp; 
+	std::vector<uint64_t>    info_mask;   // packed mask of the information bits (the bits which are not frozen)
 
 public:
 	Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
 	virtual ~Encoder_polar() {}
 
 	void light_encode(B *bits);
+	void light_encode_packed(uint64_t *bits);
 
 	bool is_codeword(const B *X_N);
 
 	virtual void notify_frozenbits_update();
 
 protected:
-	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
-	void convert(const B *U_K, B *U_N);
+	virtual void _encode       (const B        *U_K, B        *X_N, const int frame_id);
+	virtual void _encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id);
+	void convert       (const B        *U_K, B        *U_N);
+	void convert_packed(const uint64_t *U_K, uint64_t *U_N);
 };
 }
 }
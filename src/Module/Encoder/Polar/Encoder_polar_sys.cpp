@@ -32,6 +32,22 @@ void Encoder_polar_sys<B>
 	this->light_encode(X_N);
 }
 
+template <typename B>
+void Encoder_polar_sys<B>
+::_encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id)
+{
+	this->convert_packed(U_K, X_N);
+
+	// first time encode
+	this->light_encode_packed(X_N);
+
+	for (auto w = 0; w < (this->N + 63) / 64; w++)
+		X_N[w] &= this->info_mask[w];
+
+	// second time encode because of systematic encoder
+	this->light_encode_packed(X_N);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -17,7 +17,8 @@ public:
 	virtual ~Encoder_polar_sys() {}
 
 protected:
-	void _encode(const B *U_K, B *X_N, const int frame_id);
+	void _encode       (const B        *U_K, B        *X_N, const int frame_id);
+	void _encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id);
 };
 }
 }
@@ -2,8 +2,10 @@
 #include <iterator>
 #endif
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Encoder_RSC_sys.hpp"
 
@@ -72,6 +74,88 @@ void Encoder_RSC_sys<B>
 		         2);                    // stride tail bits
 }
 
+template <typename B>
+void Encoder_RSC_sys<B>
+::_encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id)
+{
+	using Bit_packer = tools::Bit_packer<B>;
+
+	if (this->lut_state.empty())
+	{
+		this->lut_state.resize(this->n_states * 256);
+		this->lut_par  .resize(this->n_states * 256);
+		for (auto s = 0; s < this->n_states; s++)
+			for (auto v = 0; v < 256; v++)
+			{
+				auto state = s;
+				uint8_t par = 0;
+				for (auto j = 0; j < 8; j++)
+					par |= (uint8_t)(inner_encode((v >> j) & 1, state) << j);
+				this->lut_state[s * 256 + v] = state;
+				this->lut_par  [s * 256 + v] = par;
+			}
+	}
+
+	// spread the 8 bits of 'x' on the even positions of 16 bits
+	auto spread = [](uint64_t x) -> uint64_t
+	{
+		x = (x | (x << 4)) & 0x0F0F;
+		x = (x | (x << 2)) & 0x3333;
+		x = (x | (x << 1)) & 0x5555;
+		return x;
+	};
+
+	std::fill(X_N, X_N + (this->N + 63) / 64, (uint64_t)0);
+
+	const auto off_tail_sys = buffered_encoding ? 1 * this->K               : 2 * this->K;
+	const auto off_par      = buffered_encoding ? 1 * this->K + this->n_ff  : 1;
+	const auto off_tail_par = buffered_encoding ? 2 * this->K + this->n_ff  : 2 * this->K + 1;
+	const auto stride       = buffered_encoding ? 1 : 2;
+
+	if (buffered_encoding)
+		Bit_packer::copy_bits(U_K, 0, X_N, 0, this->K);
+
+	// standard frame encoding process, one byte of information bits at a time
+	auto state = 0; // initial (and final) state 0 0 0
+	auto i = 0;
+	for (; i + 8 <= this->K; i += 8)
+	{
+		const auto v   = (int)Bit_packer::read_bits(U_K, i, 8);
+		const auto par = (uint64_t)this->lut_par[state * 256 + v];
+		state = this->lut_state[state * 256 + v];
+
+		if (buffered_encoding)
+			Bit_packer::write_bits(X_N, off_par + i, par, 8);
+		else
+			Bit_packer::write_bits(X_N, 2 * i, spread((uint64_t)v) | (spread(par) << 1), 16);
+	}
+	for (; i < this->K; i++)
+	{
+		const auto bit_sys = (int)Bit_packer::read_bits(U_K, i, 1);
+		const auto bit_par = inner_encode(bit_sys, state);
+
+		if (!buffered_encoding)
+			Bit_packer::write_bits(X_N, 2 * i, (uint64_t)bit_sys, 1);
+		Bit_packer::write_bits(X_N, off_par + i * stride, (uint64_t)bit_par, 1);
+	}
+
+	// tail bits for initialization conditions (state of data "state" have to be 0 0 0)
+	for (auto t = 0; t < this->n_ff; t++)
+	{
+		const auto bit_sys = tail_bit_sys(state);
+		const auto bit_par = inner_encode(bit_sys, state);
+		Bit_packer::write_bits(X_N, off_tail_sys + t * stride, (uint64_t)bit_sys, 1);
+		Bit_packer::write_bits(X_N, off_tail_par + t * stride, (uint64_t)bit_par, 1);
+	}
+
+	if (state != 0)
+	{
+		std::stringstream message;
+		message << "'state' should be equal to 0 ('state' = " <<  state << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
 template <typename B>
 std::vector<std::vector<int>> Encoder_RSC_sys<B>
 ::get_trellis()
@@ -1,6 +1,9 @@
 #ifndef ENCODER_RSC_SYS_HPP_
 #define ENCODER_RSC_SYS_HPP_
 
+#include <vector>
+#include <cstdint>
+
 #include "../Encoder.hpp"
 
 namespace aff3ct
@@ -16,6 +19,10 @@ protected:
 
 	const bool buffered_encoding;
 
+	// encoding of a byte from each state (built on the first call of '_encode_packed'): next state and parity bits
+	std::vector<int>     lut_state;
+	std::vector<uint8_t> lut_par;
+
 public:
 	Encoder_RSC_sys(const int& K, const int& N, const int n_ff, const int& n_frames, const bool buffered_encoding);
 	virtual ~Encoder_RSC_sys() {}
@@ -28,7 +35,8 @@ public:
 	bool is_codeword(const B *X_N);
 
 protected:
-	void _encode(const B *U_K, B *X_N, const int frame_id);
+	void _encode       (const B        *U_K, B        *X_N, const int frame_id);
+	void _encode_packed(const uint64_t *U_K, uint64_t *X_N, const int frame_id);
 
 	virtual int inner_encode(const int bit_sys, int &state) = 0;
 	virtual int tail_bit_sys(const int &state             ) = 0;
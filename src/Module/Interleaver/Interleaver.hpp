@@ -2,6 +2,7 @@
 #define INTERLEAVER_HPP_
 
 #include <cstdint>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -9,6 +10,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Interleaver/Interleaver_core.hpp"
+#include "Tools/Interleaver/Interleaver_address.hpp"
 
 #include "Module/Module.hpp"
 
@@ -124,7 +126,7 @@ public:
 	inline void interleave(const D *nat, D *itl, const int frame_id, const int n_frames,
 	                       const bool frame_reordering = false) const
 	{
-		this->_interleave(nat, itl, core.get_lut(), frame_reordering, n_frames, frame_id);
+		this->_interleave(nat, itl, frame_reordering, n_frames, frame_id, false);
 	}
 
 	template <class A = std::allocator<D>>
@@ -172,15 +174,15 @@ public:
 	inline void deinterleave(const D *itl, D *nat, const int frame_id, const int n_frames,
 	                         const bool frame_reordering = false) const
 	{
-		this->_interleave(itl, nat, core.get_lut_inv(), frame_reordering, n_frames, frame_id);
+		this->_interleave(itl, nat, frame_reordering, n_frames, frame_id, true);
 	}
 
 private:
 	inline void _interleave(const D *in_vec, D *out_vec,
-	                        const std::vector<T> &lookup_table,
 	                        const bool frame_reordering,
 	                        const int  n_frames,
-	                        const int  frame_id) const
+	                        const int  frame_id,
+	                        const bool inverse) const
 	{
 		if (!core.is_initialized())
 		{
@@ -188,67 +190,143 @@ private:
 			throw tools::length_error(__FILE__, __LINE__, __func__, message);
 		}
 
-		if (frame_reordering)
+		// the addresses are processed by blocks: a block of addresses is computed (algebraic and keyed interleavers) or
+		// loaded (lookup tables) once and used for all the frames that share the same permutation
+		constexpr int block_size = 256;
+		const auto size = this->core.get_size();
+
+		if (this->core.is_keyed())
 		{
+			// the deinterleaving addresses are computed as well: the deinterleaving is also a gather
+			T addr[block_size];
 			if (!this->core.is_uniform())
 			{
-				// vectorized interleaving
-				if (n_frames == mipp::nElReg<D>())
+				for (auto i = 0; i < size; i += block_size)
 				{
-					for (auto i = 0; i < this->core.get_size(); i++)
-						mipp::store<D>(&out_vec[i * mipp::nElReg<D>()],
-						               mipp::load<D>(&in_vec[lookup_table[i] * mipp::nElReg<D>()]));
+					const auto n = std::min(block_size, size - i);
+					this->core.gen_addr(addr, i, n, 0, inverse);
+					this->_permute(in_vec, out_vec, addr, i, n, frame_reordering, n_frames, false);
 				}
-				else
+			}
+			else
+			{
+				auto cur_frame_id = frame_id % this->n_frames;
+				for (auto f = 0; f < n_frames; f++)
 				{
-					for (auto i = 0; i < this->core.get_size(); i++)
+					for (auto i = 0; i < size; i += block_size)
 					{
-						const auto off1 =              i  * n_frames;
-						const auto off2 = lookup_table[i] * n_frames;
-						for (auto f = 0; f < n_frames; f++)
-							out_vec[off1 +f] = in_vec[off2 +f];
+						const auto n = std::min(block_size, size - i);
+						this->core.gen_addr(addr, i, n, cur_frame_id, inverse);
+						if (frame_reordering)
+							for (auto j = 0; j < n; j++)
+								out_vec[(i + j) * n_frames +f] = in_vec[addr[j] * n_frames +f];
+						else
+							tools::Interleaver_gather<D,T>::apply(in_vec + f * size, out_vec + f * size + i, addr, n);
 					}
+					cur_frame_id = (cur_frame_id +1) % this->n_frames;
+				}
+			}
+			return;
+		}
+
+		const auto &lookup_table = inverse ? this->core.get_lut_inv() : this->core.get_lut();
+
+		if (!this->core.is_uniform())
+		{
+			if (this->core.is_algebraic())
+			{
+				// the deinterleaving is a scatter with the interleaving addresses: 'pi_inv' is never loaded
+				const tools::Interleaver_address<T> address(size, this->core.get_law());
+				T addr[block_size];
+				for (auto i = 0; i < size; i += block_size)
+				{
+					const auto n = std::min(block_size, size - i);
+					address.generate(addr, i, n);
+					this->_permute(in_vec, out_vec, addr, i, n, frame_reordering, n_frames, inverse);
 				}
 			}
 			else
 			{
-				auto cur_frame_id = frame_id % this->n_frames;
-				for (auto f = 0; f < n_frames; f++)
+				for (auto i = 0; i < size; i += block_size)
 				{
-					const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
-					for (auto i = 0; i < this->core.get_size(); i++)
-						out_vec[i * n_frames +f] = in_vec[lut[i] * n_frames +f];
-					cur_frame_id = (cur_frame_id +1) % this->n_frames;
+					const auto n = std::min(block_size, size - i);
+					this->_permute(in_vec, out_vec, lookup_table.data() + i, i, n, frame_reordering, n_frames, false);
 				}
 			}
 		}
 		else
 		{
-			if (!this->core.is_uniform())
+			if (frame_reordering)
 			{
-				// TODO: vectorize this code with the new AVX gather instruction
+				auto cur_frame_id = frame_id % this->n_frames;
 				for (auto f = 0; f < n_frames; f++)
 				{
-					const auto off = f * this->core.get_size();
+					const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
 					for (auto i = 0; i < this->core.get_size(); i++)
-						out_vec[off + i] = in_vec[off + lookup_table[i]];
+						out_vec[i * n_frames +f] = in_vec[lut[i] * n_frames +f];
+					cur_frame_id = (cur_frame_id +1) % this->n_frames;
 				}
 			}
 			else
 			{
 				auto cur_frame_id = frame_id % this->n_frames;
-				// TODO: vectorize this code with the new AVX gather instruction
 				for (auto f = 0; f < n_frames; f++)
 				{
 					const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
 					const auto off = f * this->core.get_size();
-					for (auto i = 0; i < this->core.get_size(); i++)
-						out_vec[off + i] = in_vec[off + lut[i]];
+					tools::Interleaver_gather<D,T>::apply(in_vec + off, out_vec + off, lut, this->core.get_size());
 					cur_frame_id = (cur_frame_id +1) % this->n_frames;
 				}
 			}
 		}
 	}
+
+	// permutes the elements 'start' to 'start + n -1' of all the frames:
+	// out[start + j] = in[addr[j]] (gather) or out[addr[j]] = in[start + j] (scatter)
+	inline void _permute(const D *in_vec, D *out_vec, const T *addr, const int start, const int n,
+	                     const bool frame_reordering, const int n_frames, const bool scatter) const
+	{
+		if (frame_reordering)
+		{
+			// vectorized interleaving
+			if (n_frames == mipp::nElReg<D>())
+			{
+				constexpr auto n_lanes = mipp::nElReg<D>();
+				if (scatter)
+					for (auto j = 0; j < n; j++)
+						mipp::store<D>(&out_vec[addr[j] * n_lanes], mipp::load<D>(&in_vec[(start + j) * n_lanes]));
+				else
+					for (auto j = 0; j < n; j++)
+						mipp::store<D>(&out_vec[(start + j) * n_lanes], mipp::load<D>(&in_vec[addr[j] * n_lanes]));
+			}
+			else
+			{
+				for (auto j = 0; j < n; j++)
+				{
+					const auto off_s = (start + j) * n_frames;
+					const auto off_a =    addr[j] * n_frames;
+					if (scatter)
+						for (auto f = 0; f < n_frames; f++)
+							out_vec[off_a +f] = in_vec[off_s +f];
+					else
+						for (auto f = 0; f < n_frames; f++)
+							out_vec[off_s +f] = in_vec[off_a +f];
+				}
+			}
+		}
+		else
+		{
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto off = f * this->core.get_size();
+				if (scatter)
+					for (auto j = 0; j < n; j++)
+						out_vec[off + addr[j]] = in_vec[off + start + j];
+				else
+					tools::Interleaver_gather<D,T>::apply(in_vec + off, out_vec + off + start, addr, n);
+			}
+		}
+	}
 };
 }
 }
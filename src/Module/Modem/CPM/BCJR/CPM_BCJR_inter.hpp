@@ -0,0 +1,70 @@
+#ifndef CPM_BCJR_INTER_HPP_
+#define CPM_BCJR_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../CPM_parameters.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class CPM_BCJR_inter
+ *
+ * \brief Same processing as the CPM_BCJR but on mipp::nElReg<Q>() frames at once: the frames are interleaved
+ *        (e0_f0 | e0_f1 | ... | e1_f0 | ...) and each SIMD lane runs the trellis of one frame.
+ *
+ * The MAX operator works on registers: tools::max_i gives the max-log-MAP and tools::max_star_i the log-MAP.
+ */
+template <typename SIN = int, typename SOUT = int, typename Q = float, tools::proto_max_i<Q> MAX = tools::max_star_i>
+class CPM_BCJR_inter
+{
+protected:
+	const CPM_parameters<SIN,SOUT>& cpm; // all CPM parameters
+	const int n_symbols;                 // size of a frame (in symbols) from the channel (with tail bits)
+	const int chn_size;                  // size of a frame (wave form probas) from the channel (with tail bits)
+	const int dec_size;                  // size of a frame (bits proba) from the decoder
+	const int ext_size;                  // size of a frame (bits proba) from the bcjr
+
+	mipp::vector<Q> Lch;                 // the interleaved frames from the channel
+	mipp::vector<Q> Ldec;                // the interleaved frames from the decoder
+	mipp::vector<Q> Le;                  // the interleaved extrinsic information
+	mipp::vector<Q> symb_apriori_prob;
+	mipp::vector<Q> gamma;
+	mipp::vector<Q> alpha;
+	mipp::vector<Q> beta;
+	mipp::vector<Q> proba_msg_symb;
+	mipp::vector<Q> proba_msg_bits;
+
+public:
+	CPM_BCJR_inter(const CPM_parameters<SIN,SOUT>& _cpm, const int _n_symbols);
+	virtual ~CPM_BCJR_inter();
+
+	/*!
+	 * \brief Number of frames processed by a call to decode.
+	 */
+	static constexpr int get_n_frames() { return mipp::nElReg<Q>(); }
+
+	// CPM_BCJR for the demodulation, 'get_n_frames()' frames are read and the frames of 'Le_N' which are nullptr are
+	// not written (a partial group of frames can be completed with copies of the input frames)
+	void decode(const std::vector<const Q*> &Lch_N,                                       const std::vector<Q*> &Le_N);
+	void decode(const std::vector<const Q*> &Lch_N, const std::vector<const Q*> &Ldec_N, const std::vector<Q*> &Le_N);
+
+private:
+	void LLR_to_logsymb_proba    (                       ); // retrieve log symbols probability from LLR
+	void compute_alpha_beta_gamma(                       ); // compute gamma, alpha and beta
+	void symboles_probas         (                       ); // from alpha, beta, and gamma computes new symbol probability
+	void bits_probas             (                       ); // from symbol probabilities, computes bit probabilities
+	void compute_ext             (const bool sub_apriori ); // extrinsic information processing from bit probabilities
+	void store_ext               (const std::vector<Q*> &Le_N);
+};
+}
+}
+
+#include "CPM_BCJR_inter.hxx"
+
+#endif /* CPM_BCJR_INTER_HPP_ */
@@ -0,0 +1,273 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "CPM_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::CPM_BCJR_inter(const CPM_parameters<SIN,SOUT>& _cpm, const int _n_symbols)
+: cpm              (_cpm                                                          ),
+  n_symbols        (_n_symbols                                                    ),
+  chn_size         ( n_symbols           * cpm.max_wa_id                          ),
+  dec_size         ((n_symbols - cpm.tl) * cpm.n_b_per_s                          ),
+  ext_size         ( dec_size                                                     ),
+
+  Lch              (chn_size                              * mipp::nElReg<Q>()     ),
+  Ldec             (dec_size                              * mipp::nElReg<Q>()     ),
+  Le               (ext_size                              * mipp::nElReg<Q>()     ),
+  symb_apriori_prob(n_symbols                 * cpm.m_order * mipp::nElReg<Q>()   ),
+  gamma            (n_symbols * cpm.max_st_id * cpm.m_order * mipp::nElReg<Q>()   ),
+  alpha            (n_symbols * cpm.max_st_id               * mipp::nElReg<Q>()   ),
+  beta             (n_symbols * cpm.max_st_id               * mipp::nElReg<Q>()   ),
+  proba_msg_symb   (n_symbols                 * cpm.m_order * mipp::nElReg<Q>()   ),
+  proba_msg_bits   (n_symbols * cpm.n_b_per_s * 2           * mipp::nElReg<Q>()   )
+{
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::~CPM_BCJR_inter()
+{
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::decode(const std::vector<const Q*> &Lch_N, const std::vector<Q*> &Le_N)
+{
+	if ((int)Lch_N.size() != get_n_frames() || (int)Le_N.size() != get_n_frames())
+	{
+		std::stringstream message;
+		message << "'Lch_N.size()' and 'Le_N.size()' have to be equal to 'get_n_frames()' ('Lch_N.size()' = "
+		        << Lch_N.size() << ", 'Le_N.size()' = " << Le_N.size() << ", 'get_n_frames()' = "
+		        << get_n_frames() << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	tools::Reorderer<Q>::apply(Lch_N, this->Lch.data(), this->chn_size);
+
+	std::fill(symb_apriori_prob.begin(), symb_apriori_prob.end(), (Q)0);
+
+	compute_alpha_beta_gamma(     );
+	symboles_probas         (     );
+	bits_probas             (     );
+	compute_ext             (false);
+	store_ext               (Le_N );
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::decode(const std::vector<const Q*> &Lch_N, const std::vector<const Q*> &Ldec_N, const std::vector<Q*> &Le_N)
+{
+	if ((int)Lch_N.size() != get_n_frames() || (int)Ldec_N.size() != get_n_frames() ||
+	    (int)Le_N .size() != get_n_frames())
+	{
+		std::stringstream message;
+		message << "'Lch_N.size()', 'Ldec_N.size()' and 'Le_N.size()' have to be equal to 'get_n_frames()' "
+		        << "('Lch_N.size()' = " << Lch_N.size() << ", 'Ldec_N.size()' = " << Ldec_N.size()
+		        << ", 'Le_N.size()' = " << Le_N.size() << ", 'get_n_frames()' = " << get_n_frames() << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	tools::Reorderer<Q>::apply(Lch_N,  this->Lch .data(), this->chn_size);
+	tools::Reorderer<Q>::apply(Ldec_N, this->Ldec.data(), this->dec_size);
+
+	LLR_to_logsymb_proba    (    );
+	compute_alpha_beta_gamma(    );
+	symboles_probas         (    );
+	bits_probas             (    );
+	compute_ext             (true);
+	store_ext               (Le_N);
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::LLR_to_logsymb_proba()
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+	const auto m_order = cpm.m_order, n_b_per_s = cpm.n_b_per_s;
+
+	std::fill(symb_apriori_prob.begin(), symb_apriori_prob.end(), (Q)0);
+
+	for (auto i = 0; i < dec_size / n_b_per_s; i++)
+		for (auto tr = 0; tr < m_order; tr++)
+		{
+			auto r_prob = mipp::Reg<Q>((Q)0);
+			for (auto b = 0; b < n_b_per_s; b++)
+			{
+				// transition_to_binary what bit state we should have for the given transition and bit position
+				const auto r_half = mipp::div2(mipp::Reg<Q>(&Ldec[(i * n_b_per_s + b) * n_el]));
+
+				// match -> add probability else remove
+				r_prob = (cpm.transition_to_binary[tr * n_b_per_s + b] == 0) ? r_prob + r_half : r_prob - r_half;
+			}
+			r_prob.store(&symb_apriori_prob[(i * m_order + tr) * n_el]);
+		}
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::compute_alpha_beta_gamma()
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+	const auto m_order   = cpm.m_order;
+	const auto max_st_id = cpm.max_st_id;
+	const auto r_inf     = mipp::Reg<Q>(std::numeric_limits<Q>::lowest());
+
+	// alpha and beta initialization
+	std::fill(alpha.begin(), alpha.end(), std::numeric_limits<Q>::lowest());
+	std::fill(beta .begin(), beta .end(), std::numeric_limits<Q>::lowest());
+	std::fill(alpha.begin() + (                             cpm.allowed_states[0]) * n_el,
+	          alpha.begin() + (                             cpm.allowed_states[0]) * n_el + n_el, (Q)0);
+	std::fill(beta .begin() + ((n_symbols -1) * max_st_id + cpm.allowed_states[0]) * n_el,
+	          beta .begin() + ((n_symbols -1) * max_st_id + cpm.allowed_states[0]) * n_el + n_el, (Q)0);
+
+	// compute gamma
+	for (auto i = 0; i < n_symbols; i++)
+		for (auto st = 0; st < cpm.n_st; st++)
+		{
+			const auto s = cpm.allowed_states[st];
+			for (auto tr = 0; tr < m_order; tr++)
+			{
+				const auto wa = cpm.trellis_related_wave_form[s * m_order + tr];
+				const auto r_gamma = mipp::Reg<Q>(&Lch              [(i * cpm.max_wa_id + wa) * n_el]) + // from the channel
+				                     mipp::Reg<Q>(&symb_apriori_prob[(i * m_order       + tr) * n_el]);  // from the decoder
+				r_gamma.store(&gamma[((i * max_st_id + s) * m_order + tr) * n_el]);
+			}
+		}
+
+	// compute alpha and beta
+	for (auto i = 1; i < n_symbols; i++)
+	{
+		const auto *alpha_prv = &alpha[(             (i -1)) * max_st_id * n_el];
+		      auto *alpha_cur = &alpha[(             (i +0)) * max_st_id * n_el];
+		const auto *beta_prv  = &beta [(n_symbols - (i +0)) * max_st_id * n_el];
+		      auto *beta_cur  = &beta [(n_symbols - (i +1)) * max_st_id * n_el];
+		const auto *gamma_a   = &gamma[(             (i -1)) * max_st_id * m_order * n_el];
+		const auto *gamma_b   = &gamma[(n_symbols -  i     ) * max_st_id * m_order * n_el];
+
+		for (auto st = 0; st < cpm.n_st; st++)
+		{
+			const auto s = cpm.allowed_states[st];
+
+			// compute the alpha nodes
+			auto r_alpha = mipp::Reg<Q>(&alpha_cur[s * n_el]);
+			for (auto tr = 0; tr < m_order; tr++)
+			{
+				const auto org = cpm.anti_trellis_original_state  [s * m_order + tr];
+				const auto inp = cpm.anti_trellis_input_transition[s * m_order + tr];
+				r_alpha = MAX(r_alpha, mipp::Reg<Q>(&alpha_prv[org * n_el]) +
+				                       mipp::Reg<Q>(&gamma_a  [(org * m_order + inp) * n_el]));
+			}
+			r_alpha.store(&alpha_cur[s * n_el]);
+
+			// compute the beta nodes
+			auto r_beta = mipp::Reg<Q>(&beta_cur[s * n_el]);
+			for (auto tr = 0; tr < m_order; tr++)
+			{
+				const auto nxt = cpm.trellis_next_state[s * m_order + tr];
+				r_beta = MAX(r_beta, mipp::Reg<Q>(&beta_prv[nxt * n_el]) +
+				                     mipp::Reg<Q>(&gamma_b [(s * m_order + tr) * n_el]));
+			}
+			r_beta.store(&beta_cur[s * n_el]);
+		}
+
+		// normalize alpha and beta vectors (not impact on the decoding performances)
+		auto r_norm_a = r_inf, r_norm_b = r_inf;
+		for (auto j = 0; j < max_st_id; j++)
+		{
+			r_norm_a = MAX(r_norm_a, mipp::Reg<Q>(&alpha_cur[j * n_el]));
+			r_norm_b = MAX(r_norm_b, mipp::Reg<Q>(&beta_cur [j * n_el]));
+		}
+		for (auto j = 0; j < max_st_id; j++)
+		{
+			(mipp::Reg<Q>(&alpha_cur[j * n_el]) - r_norm_a).store(&alpha_cur[j * n_el]);
+			(mipp::Reg<Q>(&beta_cur [j * n_el]) - r_norm_b).store(&beta_cur [j * n_el]);
+		}
+	}
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::symboles_probas()
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+	const auto m_order   = cpm.m_order;
+	const auto max_st_id = cpm.max_st_id;
+
+	for (auto i = 0; i < n_symbols; i++)
+		for (auto tr = 0; tr < m_order; tr++)
+		{
+			auto r_proba = mipp::Reg<Q>(std::numeric_limits<Q>::lowest());
+			for (auto st = 0; st < cpm.n_st; st++)
+			{
+				const auto s   = cpm.allowed_states[st];
+				const auto nxt = cpm.trellis_next_state[s * m_order + tr];
+				r_proba = MAX(r_proba, mipp::Reg<Q>(&alpha[( i * max_st_id + s  )                * n_el]) +
+				                       mipp::Reg<Q>(&beta [( i * max_st_id + nxt)                * n_el]) +
+				                       mipp::Reg<Q>(&gamma[((i * max_st_id + s  ) * m_order + tr) * n_el]));
+			}
+			r_proba.store(&proba_msg_symb[(i * m_order + tr) * n_el]);
+		}
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::bits_probas()
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+	const auto m_order = cpm.m_order, n_b_per_s = cpm.n_b_per_s;
+	const auto r_inf   = mipp::Reg<Q>(std::numeric_limits<Q>::lowest());
+
+	for (auto i = 0; i < n_symbols; i++)
+		for (auto b = 0; b < n_b_per_s; b++)
+		{
+			mipp::Reg<Q> r_proba[2] = {r_inf, r_inf};
+			for (auto tr = 0; tr < m_order; tr++)
+			{
+				// bit_state = 0 or 1 ; bit 0 is msb, bit cpm.n_b_per_s-1 is lsb
+				const auto bit_state = cpm.transition_to_binary[tr * n_b_per_s + b];
+				r_proba[bit_state] = MAX(r_proba[bit_state], mipp::Reg<Q>(&proba_msg_symb[(i * m_order + tr) * n_el]));
+			}
+			r_proba[0].store(&proba_msg_bits[((i * n_b_per_s + b) * 2 +0) * n_el]);
+			r_proba[1].store(&proba_msg_bits[((i * n_b_per_s + b) * 2 +1) * n_el]);
+		}
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::compute_ext(const bool sub_apriori)
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+
+	// remove tail bits, processing aposteriori and substracting a priori to directly obtain extrinsic
+	for (auto i = 0; i < ext_size; i++)
+	{
+		auto r_ext = mipp::Reg<Q>(&proba_msg_bits[(i * 2 +0) * n_el]);
+		auto r_one = mipp::Reg<Q>(&proba_msg_bits[(i * 2 +1) * n_el]);
+		if (sub_apriori)
+			r_one += mipp::Reg<Q>(&Ldec[i * n_el]);
+		(r_ext - r_one).store(&Le[i * n_el]);
+	}
+}
+
+template <typename SIN, typename SOUT, typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::store_ext(const std::vector<Q*> &Le_N)
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+
+	for (auto f = 0; f < n_el; f++)
+		if (Le_N[f] != nullptr)
+			for (auto i = 0; i < ext_size; i++)
+				Le_N[f][i] = Le[i * n_el + f];
+}
+}
+}
@@ -0,0 +1,60 @@
+#ifndef MODEM_CPM_FAST_HPP_
+#define MODEM_CPM_FAST_HPP_
+
+#include <string>
+#include <vector>
+
+#include "Tools/Math/max.h"
+
+#include "Modem_CPM.hpp"
+#include "BCJR/CPM_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Modem_CPM_fast
+ *
+ * \brief CPM modem with an inter-frame SIMD demodulator (see CPM_BCJR_inter): the frames are demodulated by groups of
+ *        mipp::nElReg<Q>() frames, the last group is completed with copies of its last frame.
+ *
+ * MAX is the scalar operator of the CPM_BCJR used when a single frame is demodulated ('frame_id' >= 0), MAXI has to
+ * be its SIMD counterpart (tools::max_i for the max-log-MAP, tools::max_star_i for the log-MAP).
+ */
+template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX = tools::max_star,
+          tools::proto_max_i<Q> MAXI = tools::max_star_i>
+class Modem_CPM_fast : public Modem_CPM<B,R,Q,MAX>
+{
+	using SIN  = B;
+	using SOUT = B;
+
+protected:
+	CPM_BCJR_inter<SIN,SOUT,Q,MAXI> bcjr_inter; // inter-frame demodulator
+
+public:
+	Modem_CPM_fast(const int  N,
+	               const R    sigma              = (R)1,
+	               const int  bits_per_symbol    = 1,
+	               const int  sampling_factor    = 5,
+	               const int  cpm_L              = 3,
+	               const int  cpm_k              = 1,
+	               const int  cpm_p              = 2,
+	               const std::string &mapping    = "NATURAL",
+	               const std::string &wave_shape = "GMSK",
+	               const bool no_sig2            = false,
+	               const int  n_frames           = 1);
+	virtual ~Modem_CPM_fast();
+
+	using Modem_CPM<B,R,Q,MAX>::demodulate;
+	using Modem_CPM<B,R,Q,MAX>::tdemodulate;
+
+	void  demodulate(const Q *Y_N1,                Q *Y_N2, const int frame_id = -1);
+	void tdemodulate(const Q *Y_N1, const Q *Y_N2, Q *Y_N3, const int frame_id = -1);
+};
+}
+}
+
+#include "Modem_CPM_fast.hxx"
+
+#endif /* MODEM_CPM_FAST_HPP_ */
@@ -0,0 +1,92 @@
+#include <algorithm>
+
+#include "Modem_CPM_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+Modem_CPM_fast<B,R,Q,MAX,MAXI>
+::Modem_CPM_fast(const int  N,
+                 const R    sigma,
+                 const int  bits_per_symbol,
+                 const int  sampling_factor,
+                 const int  cpm_L,
+                 const int  cpm_k,
+                 const int  cpm_p,
+                 const std::string &mapping,
+                 const std::string &wave_shape,
+                 const bool no_sig2,
+                 const int  n_frames)
+: Modem_CPM<B,R,Q,MAX>(N, sigma, bits_per_symbol, sampling_factor, cpm_L, cpm_k, cpm_p, mapping, wave_shape, no_sig2,
+                       n_frames),
+  bcjr_inter          (this->cpm, this->n_sy_tl)
+{
+	const std::string name = "Modem_CPM_fast";
+	this->set_name(name);
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+Modem_CPM_fast<B,R,Q,MAX,MAXI>
+::~Modem_CPM_fast()
+{
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+void Modem_CPM_fast<B,R,Q,MAX,MAXI>
+::demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (frame_id >= 0)
+	{
+		Modem_CPM<B,R,Q,MAX>::demodulate(Y_N1, Y_N2, frame_id);
+		return;
+	}
+
+	constexpr int n_el = CPM_BCJR_inter<SIN,SOUT,Q,MAXI>::get_n_frames();
+
+	std::vector<const Q*> Lch_N(n_el);
+	std::vector<      Q*> Le_N (n_el);
+	for (auto f = 0; f < this->n_frames; f += n_el)
+	{
+		for (auto l = 0; l < n_el; l++)
+		{
+			const auto fl = std::min(f + l, this->n_frames -1);
+			Lch_N[l] = Y_N1 + fl * this->N_fil;
+			Le_N [l] = (f + l < this->n_frames) ? Y_N2 + fl * this->N : nullptr;
+		}
+
+		bcjr_inter.decode(Lch_N, Le_N);
+	}
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+void Modem_CPM_fast<B,R,Q,MAX,MAXI>
+::tdemodulate(const Q *Y_N1, const Q *Y_N2, Q *Y_N3, const int frame_id)
+{
+	if (frame_id >= 0)
+	{
+		Modem_CPM<B,R,Q,MAX>::tdemodulate(Y_N1, Y_N2, Y_N3, frame_id);
+		return;
+	}
+
+	constexpr int n_el = CPM_BCJR_inter<SIN,SOUT,Q,MAXI>::get_n_frames();
+
+	std::vector<const Q*> Lch_N (n_el);
+	std::vector<const Q*> Ldec_N(n_el);
+	std::vector<      Q*> Le_N  (n_el);
+	for (auto f = 0; f < this->n_frames; f += n_el)
+	{
+		for (auto l = 0; l < n_el; l++)
+		{
+			const auto fl = std::min(f + l, this->n_frames -1);
+			Lch_N [l] = Y_N1 + fl * this->N_fil;
+			Ldec_N[l] = Y_N2 + fl * this->N;
+			Le_N  [l] = (f + l < this->n_frames) ? Y_N3 + fl * this->N : nullptr;
+		}
+
+		bcjr_inter.decode(Lch_N, Ldec_N, Le_N);
+	}
+}
+}
+}
@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -26,18 +27,20 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { modulate, tmodulate, filter, demodulate, tdemodulate, demodulate_wg, tdemodulate_wg, SIZE };
+			enum list { modulate, tmodulate, filter, demodulate, tdemodulate, demodulate_wg, tdemodulate_wg,
+			            modulate_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace modulate       { enum list {      X_N1, X_N2      , SIZE }; }
-			namespace tmodulate      { enum list {      X_N1, X_N2      , SIZE }; }
-			namespace filter         { enum list {      Y_N1, Y_N2      , SIZE }; }
-			namespace demodulate     { enum list {      Y_N1, Y_N2      , SIZE }; }
-			namespace tdemodulate    { enum list {      Y_N1, Y_N2, Y_N3, SIZE }; }
-			namespace demodulate_wg  { enum list { H_N, Y_N1, Y_N2      , SIZE }; }
-			namespace tdemodulate_wg { enum list { H_N, Y_N1, Y_N2, Y_N3, SIZE }; }
+			namespace modulate        { enum list {      X_N1, X_N2      , SIZE }; }
+			namespace tmodulate       { enum list {      X_N1, X_N2      , SIZE }; }
+			namespace filter          { enum list {      Y_N1, Y_N2      , SIZE }; }
+			namespace demodulate      { enum list {      Y_N1, Y_N2      , SIZE }; }
+			namespace tdemodulate     { enum list {      Y_N1, Y_N2, Y_N3, SIZE }; }
+			namespace demodulate_wg   { enum list { H_N, Y_N1, Y_N2      , SIZE }; }
+			namespace tdemodulate_wg  { enum list { H_N, Y_N1, Y_N2, Y_N3, SIZE }; }
+			namespace modulate_packed { enum list {      X_N1, X_N2      , SIZE }; }
 		}
 	}
 
@@ -64,6 +67,8 @@ protected:
 	bool enable_filter;
 	bool enable_demodulator;
 
+	std::vector<B> X_N1_unpacked; // allocated on the first call to 'modulate_packed'
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -247,6 +252,18 @@ public:
 
 			return 0;
 		});
+
+		auto &p8 = this->create_task("modulate_packed");
+		auto &p8s_X_N1 = this->template create_socket_in <B>(p8, "X_N1", tools::Bit_packer<B>::get_packed_size(this->N)
+		                                                                 * this->n_frames);
+		auto &p8s_X_N2 = this->template create_socket_out<R>(p8, "X_N2", this->N_mod * this->n_frames);
+		this->create_codelet(p8, [this, &p8s_X_N1, &p8s_X_N2]() -> int
+		{
+			this->modulate_packed(static_cast<B*>(p8s_X_N1.get_dataptr()),
+			                      static_cast<R*>(p8s_X_N2.get_dataptr()));
+
+			return 0;
+		});
 	}
 
 	/*!
@@ -337,6 +354,31 @@ public:
 			                f);
 	}
 
+	/*!
+	 * \brief Modulates a vector of bits packed in 64-bit words (see tools::Bit_packer::pack_words).
+	 *
+	 * The bits are unpacked before the modulation: this is the boundary of the packed frames in the simulation chain.
+	 *
+	 * \param X_N1: the packed bits ('Bit_packer<B>::get_packed_size(N)' elements per frame).
+	 * \param X_N2: a vector of modulated bits or symbols.
+	 */
+	void modulate_packed(const B *X_N1, R *X_N2, const int frame_id = -1)
+	{
+		if (this->X_N1_unpacked.empty())
+			this->X_N1_unpacked.resize(this->N * this->n_frames);
+
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+		const auto n_words = tools::Bit_packer<B>::get_packed_size(this->N) * sizeof(B) / sizeof(uint64_t);
+
+		tools::Bit_packer<B>::unpack_words(reinterpret_cast<const uint64_t*>(X_N1) + f_start * n_words,
+		                                   this->X_N1_unpacked.data() + f_start * this->N,
+		                                   this->N,
+		                                   f_stop - f_start);
+
+		this->modulate(this->X_N1_unpacked.data(), X_N2, frame_id);
+	}
+
 	/*!
 	 * \brief soft Modulates a vector of LLRs.
 	 *
@@ -14,7 +14,7 @@ namespace module
 template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX = tools::max_star>
 class Modem_PAM : public Modem<B,R,Q>
 {
-private:
+protected:
 	const int bits_per_symbol;
 	const int nbr_symbols;
 	const R sqrt_es;
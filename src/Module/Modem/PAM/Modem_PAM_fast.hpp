@@ -0,0 +1,40 @@
+#ifndef MODEM_PAM_FAST_HPP_
+#define MODEM_PAM_FAST_HPP_
+
+#include <vector>
+
+#include "Modem_PAM.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Modem_PAM_fast
+ *
+ * \brief PAM modem with a max-log demodulator in O(bits_per_symbol) per symbol (closed form per bit, see
+ *        tools::max_log_PAM), vectorized over the symbols. The LLRs are the max-log ones whatever the MAX operator
+ *        (the latter is kept for the tdemodulate methods).
+ */
+template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX = tools::max_star>
+class Modem_PAM_fast : public Modem_PAM<B,R,Q,MAX>
+{
+private:
+	std::vector<Q> Z_N; // equalized symbols
+	std::vector<Q> W_N; // square gain of each symbol
+
+public:
+	Modem_PAM_fast(const int N, const R sigma = (R)1, const int bits_per_symbol = 1, const bool disable_sig2 = false,
+	               const int n_frames = 1);
+	virtual ~Modem_PAM_fast();
+
+protected:
+	void _demodulate   (              const Q *Y_N1, Q *Y_N2, const int frame_id);
+	void _demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id);
+};
+}
+}
+
+#include "Modem_PAM_fast.hxx"
+
+#endif // MODEM_PAM_FAST_HPP_
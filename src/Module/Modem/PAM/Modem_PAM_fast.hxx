@@ -0,0 +1,69 @@
+#include <typeinfo>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/max_log_PAM.h"
+
+#include "Modem_PAM_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_PAM_fast<B,R,Q,MAX>
+::Modem_PAM_fast(const int N, const R sigma, const int bits_per_symbol, const bool disable_sig2, const int n_frames)
+: Modem_PAM<B,R,Q,MAX>(N, sigma, bits_per_symbol, disable_sig2, n_frames),
+  Z_N(this->N_mod),
+  W_N(this->N_mod)
+{
+	const std::string name = "Modem_PAM_fast";
+	this->set_name(name);
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_PAM_fast<B,R,Q,MAX>
+::~Modem_PAM_fast()
+{
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_PAM_fast<B,R,Q,MAX>
+::_demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (typeid(R) != typeid(Q))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'R' and 'Q' have to be the same.");
+
+	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
+
+	auto inv_sigma2 = this->disable_sig2 ? (Q)1.0 : (Q)(1.0 / (2 * this->sigma * this->sigma));
+
+	tools::max_log_PAM<Q>(Y_N1, nullptr, Y_N2, this->N_mod, this->bits_per_symbol, this->N, (Q)this->sqrt_es,
+	                      inv_sigma2);
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_PAM_fast<B,R,Q,MAX>
+::_demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (typeid(R) != typeid(Q))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'R' and 'Q' have to be the same.");
+
+	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
+
+	auto inv_sigma2 = this->disable_sig2 ? (Q)1.0 : (Q)(1.0 / (2 * this->sigma * this->sigma));
+
+	// (Y - H.S)^2 = H^2 . (Y / H - S)^2: equalize the symbols and weight the distances by H^2
+	for (auto k = 0; k < this->N_mod; k++)
+	{
+		const auto h = (Q)H_N[k];
+		this->Z_N[k] = (h != (Q)0) ? Y_N1[k] / h : (Q)0;
+		this->W_N[k] = h * h;
+	}
+
+	tools::max_log_PAM<Q>(this->Z_N.data(), this->W_N.data(), Y_N2, this->N_mod, this->bits_per_symbol, this->N,
+	                      (Q)this->sqrt_es, inv_sigma2);
+}
+}
+}
@@ -0,0 +1,41 @@
+#ifndef MODEM_QAM_FAST_HPP_
+#define MODEM_QAM_FAST_HPP_
+
+#include <vector>
+
+#include "Modem_QAM.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Modem_QAM_fast
+ *
+ * \brief Square QAM modem with a separable max-log demodulator: the I and Q dimensions are demodulated as two
+ *        independent Gray mapped PAM with a closed form per bit (see tools::max_log_PAM), vectorized over the
+ *        symbols. The LLRs are the max-log ones whatever the MAX operator (the latter is kept for the tdemodulate
+ *        methods).
+ */
+template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX = tools::max_star>
+class Modem_QAM_fast : public Modem_QAM<B,R,Q,MAX>
+{
+private:
+	std::vector<Q> Z_N; // equalized dimensions
+	std::vector<Q> W_N; // square gain of each dimension
+
+public:
+	Modem_QAM_fast(const int N, const R sigma = (R)1, const int bits_per_symbol = 2, const bool disable_sig2 = false,
+	               const int n_frames = 1);
+	virtual ~Modem_QAM_fast();
+
+protected:
+	void _demodulate   (              const Q *Y_N1, Q *Y_N2, const int frame_id);
+	void _demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id);
+};
+}
+}
+
+#include "Modem_QAM_fast.hxx"
+
+#endif // MODEM_QAM_FAST_HPP_
@@ -0,0 +1,83 @@
+#include <typeinfo>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/max_log_PAM.h"
+
+#include "Modem_QAM_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_QAM_fast<B,R,Q,MAX>
+::Modem_QAM_fast(const int N, const R sigma, const int bits_per_symbol, const bool disable_sig2, const int n_frames)
+: Modem_QAM<B,R,Q,MAX>(N, sigma, bits_per_symbol, disable_sig2, n_frames),
+  Z_N(this->N_mod),
+  W_N(this->N_mod)
+{
+	const std::string name = "Modem_QAM_fast";
+	this->set_name(name);
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_QAM_fast<B,R,Q,MAX>
+::~Modem_QAM_fast()
+{
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_QAM_fast<B,R,Q,MAX>
+::_demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (typeid(R) != typeid(Q))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'R' and 'Q' have to be the same.");
+
+	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
+
+	auto inv_sigma2 = this->disable_sig2 ? (Q)1.0 : (Q)((Q)1.0 / (this->sigma * this->sigma));
+
+	// the real and the imaginary parts are two independent PAM with 'bits_per_symbol / 2' bits
+	tools::max_log_PAM<Q>(Y_N1, nullptr, Y_N2, this->N_mod, this->bits_per_symbol / 2, this->N, (Q)this->sqrt_es,
+	                      inv_sigma2);
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_QAM_fast<B,R,Q,MAX>
+::_demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (typeid(R) != typeid(Q))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'R' and 'Q' have to be the same.");
+
+	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
+
+	auto inv_sigma2 = this->disable_sig2 ? (Q)1.0 : (Q)((Q)1.0 / (this->sigma * this->sigma));
+
+	// |Y - H.S|^2 = |H|^2 . |conj(H).Y / |H|^2 - S|^2: equalize the symbols and weight the distances by |H|^2
+	for (auto k = 0; k < this->N_mod / 2; k++)
+	{
+		const auto h_re = (Q)H_N[2*k], h_im = (Q)H_N[2*k +1];
+		const auto y_re =   Y_N1[2*k], y_im =   Y_N1[2*k +1];
+		const auto h2   = h_re * h_re + h_im * h_im;
+
+		if (h2 > (Q)0)
+		{
+			this->Z_N[2*k   ] = (h_re * y_re + h_im * y_im) / h2;
+			this->Z_N[2*k +1] = (h_re * y_im - h_im * y_re) / h2;
+		}
+		else
+		{
+			this->Z_N[2*k   ] = (Q)0;
+			this->Z_N[2*k +1] = (Q)0;
+		}
+		this->W_N[2*k   ] = h2;
+		this->W_N[2*k +1] = h2;
+	}
+
+	tools::max_log_PAM<Q>(this->Z_N.data(), this->W_N.data(), Y_N2, this->N_mod, this->bits_per_symbol / 2, this->N,
+	                      (Q)this->sqrt_es, inv_sigma2);
+}
+}
+}
@@ -15,7 +15,7 @@ namespace module
 template <typename B = int, typename R = float, typename Q = R, tools::proto_psi<Q> PSI = tools::psi_0>
 class Modem_SCMA : public Modem<B,R,Q>
 {
-private:
+protected:
 	const static std::complex<float> CB[6][4][4];
 	const int                        re_user[4][3]       = {{1,2,4},{0,2,5},{1,3,5},{0,3,4}};
 	      Q                          arr_phi[4][4][4][4] = {}; // probability functions
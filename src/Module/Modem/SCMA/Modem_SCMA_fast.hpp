@@ -0,0 +1,57 @@
+#ifndef MODEM_SCMA_FAST_HPP_
+#define MODEM_SCMA_FAST_HPP_
+
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+#include "Tools/Code/SCMA/modem_SCMA_functions.hpp"
+
+#include "Modem_SCMA.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Modem_SCMA_fast
+ *
+ * \brief SCMA modem with a SIMD message passing detector: each lane of the registers processes one batch (the 4
+ *        resource elements of 2 bits per user), the last group of batches is completed with copies of the last batch.
+ *
+ * The MPA runs in the log domain: the products of the probabilities become sums and the sums become the MAX operator
+ * (tools::max_i gives the max-log MPA, tools::max_star_i gives the same LLRs than Modem_SCMA). LOG_PSI is the
+ * logarithm of the PSI function of Modem_SCMA (tools::log_psi_0_i for tools::psi_0, etc.).
+ */
+template <typename B = int, typename R = float, typename Q = R, tools::proto_log_psi_i<Q> LOG_PSI = tools::log_psi_0_i,
+          tools::proto_max_i<Q> MAX = tools::max_i>
+class Modem_SCMA_fast : public Modem_SCMA<B,R,Q>
+{
+protected:
+	Q   sup_re[4][64];  // superposition of the codewords of the 3 users of each resource element (index i*16 + j*4 + k)
+	Q   sup_im[4][64];
+	int user_re[6][2];  // the 2 resource elements of each user
+
+	mipp::vector<Q> Y_lanes;   // the received symbols of the batches of a group  (4 resources x 2 x n_el)
+	mipp::vector<Q> H_lanes;   // the channel gains of the batches of a group     (4 resources x 3 users x 2 x n_el)
+	mipp::vector<Q> log_phi;   // the log probability functions of a group        (4 resources x 64 x n_el)
+	mipp::vector<Q> LLR_lanes; // the LLRs of a group                             (6 users x 2 bits x n_el)
+
+public:
+	Modem_SCMA_fast(const int N, const R sigma = (R)1, const int bps = 3, const bool disable_sig2 = false,
+	                const int n_ite = 1, const int n_frames = 6);
+	virtual ~Modem_SCMA_fast();
+
+	virtual void demodulate   (              const Q *Y_N1, Q *Y_N2, const int frame_id = -1); using Modem<B,R,Q>::demodulate;
+	virtual void demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id = -1); using Modem<B,R,Q>::demodulate_wg;
+
+private:
+	void _demodulate(const R *H_N, const Q *Y_N1, Q *Y_N2);
+	void compute_log_phi(const bool wg);
+	void mpa();
+};
+}
+}
+
+#include "Modem_SCMA_fast.hxx"
+
+#endif /* MODEM_SCMA_FAST_HPP_ */
@@ -0,0 +1,271 @@
+#include <cassert>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Modem_SCMA_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::Modem_SCMA_fast(const int N, const R sigma, const int bps, const bool disable_sig2, const int n_ite,
+                  const int n_frames)
+: Modem_SCMA<B,R,Q>(N, sigma, bps, disable_sig2, n_ite, n_frames),
+  Y_lanes  (4 *     2 * mipp::nElReg<Q>()),
+  H_lanes  (4 * 3 * 2 * mipp::nElReg<Q>()),
+  log_phi  (4 *    64 * mipp::nElReg<Q>()),
+  LLR_lanes(6 *     2 * mipp::nElReg<Q>())
+{
+	const std::string name = "Modem_SCMA_fast";
+	this->set_name(name);
+
+	for (auto re = 0; re < 4; re++)
+		for (auto i = 0; i < 4; i++)
+			for (auto j = 0; j < 4; j++)
+				for (auto k = 0; k < 4; k++)
+				{
+					const auto sup = this->CB[this->re_user[re][0]][re][i] +
+					                 this->CB[this->re_user[re][1]][re][j] +
+					                 this->CB[this->re_user[re][2]][re][k];
+
+					sup_re[re][i * 16 + j * 4 + k] = (Q)sup.real();
+					sup_im[re][i * 16 + j * 4 + k] = (Q)sup.imag();
+				}
+
+	int n_re[6] = {0, 0, 0, 0, 0, 0};
+	for (auto re = 0; re < 4; re++)
+		for (auto p = 0; p < 3; p++)
+		{
+			const auto u = this->re_user[re][p];
+			user_re[u][n_re[u]++] = re;
+		}
+}
+
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::~Modem_SCMA_fast()
+{
+}
+
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+void Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (frame_id != -1)
+	{
+		std::stringstream message;
+		message << "'frame_id' has to be equal to -1 ('frame_id' = " << frame_id << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->_demodulate(nullptr, Y_N1, Y_N2);
+}
+
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+void Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (frame_id != -1)
+	{
+		std::stringstream message;
+		message << "'frame_id' has to be equal to -1 ('frame_id' = " << frame_id << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->_demodulate(H_N, Y_N1, Y_N2);
+}
+
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+void Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::_demodulate(const R *H_N, const Q *Y_N1, Q *Y_N2)
+{
+	assert(typeid(R) == typeid(Q));
+	assert(typeid(Q) == typeid(float) || typeid(Q) == typeid(double));
+
+	constexpr int n_el = mipp::nElReg<Q>();
+
+	const auto n_batches = (this->N +1) / 2;
+	const auto Nmod      = Modem_SCMA<B,R,Q>::size_mod(this->N, 3);
+
+	for (auto b = 0; b < n_batches; b += n_el)
+	{
+		// the lane 'l' processes the batch 'b + l'
+		for (auto l = 0; l < n_el; l++)
+		{
+			const auto batch = std::min(b + l, n_batches -1);
+
+			for (auto re = 0; re < 4; re++)
+			{
+				Y_lanes[(2 * re +0) * n_el + l] = Y_N1[batch * 8 + 2 * re   ];
+				Y_lanes[(2 * re +1) * n_el + l] = Y_N1[batch * 8 + 2 * re +1];
+
+				if (H_N != nullptr)
+					for (auto p = 0; p < 3; p++)
+					{
+						const auto u = this->re_user[re][p];
+						H_lanes[((re * 3 + p) * 2 +0) * n_el + l] = (Q)H_N[u * Nmod + 8 * batch + 2 * re   ];
+						H_lanes[((re * 3 + p) * 2 +1) * n_el + l] = (Q)H_N[u * Nmod + 8 * batch + 2 * re +1];
+					}
+			}
+		}
+
+		this->compute_log_phi(H_N != nullptr);
+		this->mpa();
+
+		const auto n_lanes = std::min(n_el, n_batches - b);
+		for (auto l = 0; l < n_lanes; l++)
+		{
+			const auto batch = b + l;
+			for (auto u = 0; u < 6; u++)
+			{
+				Y_N2[u * this->N + batch *2 +0] = LLR_lanes[(u * 2 +0) * n_el + l];
+				if ((this->N % 2) != 1 || batch != n_batches -1)
+					Y_N2[u * this->N + batch *2 +1] = LLR_lanes[(u * 2 +1) * n_el + l];
+			}
+		}
+	}
+}
+
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+void Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::compute_log_phi(const bool wg)
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+
+	const auto r_n0 = mipp::Reg<Q>((Q)this->n0);
+
+	for (auto re = 0; re < 4; re++)
+	{
+		const auto r_y_re = mipp::Reg<Q>(&Y_lanes[(2 * re +0) * n_el]);
+		const auto r_y_im = mipp::Reg<Q>(&Y_lanes[(2 * re +1) * n_el]);
+
+		if (!wg)
+		{
+			// the superpositions do not depend on the batch
+			for (auto t = 0; t < 64; t++)
+			{
+				const auto r_d_re = r_y_re - mipp::Reg<Q>(sup_re[re][t]);
+				const auto r_d_im = r_y_im - mipp::Reg<Q>(sup_im[re][t]);
+
+				LOG_PSI(r_d_re * r_d_re + r_d_im * r_d_im, r_n0).store(&log_phi[(re * 64 + t) * n_el]);
+			}
+		}
+		else
+		{
+			// the codewords of each user weighted by their channel gains: H_p * CB_p
+			mipp::Reg<Q> r_hcb_re[3][4], r_hcb_im[3][4];
+			for (auto p = 0; p < 3; p++)
+			{
+				const auto r_h_re = mipp::Reg<Q>(&H_lanes[((re * 3 + p) * 2 +0) * n_el]);
+				const auto r_h_im = mipp::Reg<Q>(&H_lanes[((re * 3 + p) * 2 +1) * n_el]);
+
+				for (auto i = 0; i < 4; i++)
+				{
+					const auto r_cb_re = mipp::Reg<Q>((Q)this->CB[this->re_user[re][p]][re][i].real());
+					const auto r_cb_im = mipp::Reg<Q>((Q)this->CB[this->re_user[re][p]][re][i].imag());
+
+					r_hcb_re[p][i] = r_h_re * r_cb_re - r_h_im * r_cb_im;
+					r_hcb_im[p][i] = r_h_re * r_cb_im + r_h_im * r_cb_re;
+				}
+			}
+
+			for (auto i = 0; i < 4; i++)
+				for (auto j = 0; j < 4; j++)
+					for (auto k = 0; k < 4; k++)
+					{
+						const auto r_d_re = r_y_re - (r_hcb_re[0][i] + r_hcb_re[1][j] + r_hcb_re[2][k]);
+						const auto r_d_im = r_y_im - (r_hcb_im[0][i] + r_hcb_im[1][j] + r_hcb_im[2][k]);
+
+						LOG_PSI(r_d_re * r_d_re + r_d_im * r_d_im, r_n0)
+						    .store(&log_phi[(re * 64 + i * 16 + j * 4 + k) * n_el]);
+					}
+		}
+	}
+}
+
+template <typename B, typename R, typename Q, tools::proto_log_psi_i<Q> LOG_PSI, tools::proto_max_i<Q> MAX>
+void Modem_SCMA_fast<B,R,Q,LOG_PSI,MAX>
+::mpa()
+{
+	constexpr int n_el = mipp::nElReg<Q>();
+
+	// only the messages of the edges of the factor graph are used
+	mipp::Reg<Q> msg_user_res[6][4][4];
+	mipp::Reg<Q> msg_res_user[4][6][4];
+
+	// uniform a priori (the log-domain messages are defined up to a constant)
+	for (auto u = 0; u < 6; u++)
+		for (auto e = 0; e < 2; e++)
+			for (auto i = 0; i < 4; i++)
+				msg_user_res[u][user_re[u][e]][i] = mipp::Reg<Q>((Q)0);
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		// resource to user messaging: MAX over the 16 codewords of the 2 other users
+		for (auto re = 0; re < 4; re++)
+		{
+			const auto u0 = this->re_user[re][0];
+			const auto u1 = this->re_user[re][1];
+			const auto u2 = this->re_user[re][2];
+			const auto *lphi = &log_phi[re * 64 * n_el];
+
+			for (auto i = 0; i < 4; i++)
+			{
+				mipp::Reg<Q> r_m0, r_m1, r_m2;
+				for (auto j = 0; j < 4; j++)
+					for (auto k = 0; k < 4; k++)
+					{
+						const auto r_t0 = mipp::Reg<Q>(&lphi[(i * 16 + j * 4 + k) * n_el])
+						                + msg_user_res[u1][re][j] + msg_user_res[u2][re][k];
+						const auto r_t1 = mipp::Reg<Q>(&lphi[(j * 16 + i * 4 + k) * n_el])
+						                + msg_user_res[u0][re][j] + msg_user_res[u2][re][k];
+						const auto r_t2 = mipp::Reg<Q>(&lphi[(j * 16 + k * 4 + i) * n_el])
+						                + msg_user_res[u0][re][j] + msg_user_res[u1][re][k];
+
+						const auto first = (j == 0 && k == 0);
+						r_m0 = first ? r_t0 : MAX(r_m0, r_t0);
+						r_m1 = first ? r_t1 : MAX(r_m1, r_t1);
+						r_m2 = first ? r_t2 : MAX(r_m2, r_t2);
+					}
+
+				msg_res_user[re][u0][i] = r_m0;
+				msg_res_user[re][u1][i] = r_m1;
+				msg_res_user[re][u2][i] = r_m2;
+			}
+		}
+
+		// user to resource messaging: the message from the other resource, normalized by its MAX reduction (the
+		// log-domain counterpart of the division by the sum)
+		for (auto u = 0; u < 6; u++)
+			for (auto e = 0; e < 2; e++)
+			{
+				const auto re_to   = user_re[u][e];
+				const auto re_from = user_re[u][1 - e];
+				const auto *m = msg_res_user[re_from][u];
+
+				const auto r_norm = MAX(MAX(m[0], m[1]), MAX(m[2], m[3]));
+				for (auto i = 0; i < 4; i++)
+					msg_user_res[u][re_to][i] = m[i] - r_norm;
+			}
+	}
+
+	// guess at each user and LLRs computation
+	for (auto u = 0; u < 6; u++)
+	{
+		mipp::Reg<Q> r_guess[4];
+		for (auto i = 0; i < 4; i++)
+			r_guess[i] = msg_res_user[user_re[u][0]][u][i] + msg_res_user[user_re[u][1]][u][i];
+
+		const auto r_llr0 = MAX(r_guess[0], r_guess[2]) - MAX(r_guess[1], r_guess[3]);
+		const auto r_llr1 = MAX(r_guess[0], r_guess[1]) - MAX(r_guess[2], r_guess[3]);
+
+		r_llr0.store(&LLR_lanes[(u * 2 +0) * n_el]);
+		r_llr1.store(&LLR_lanes[(u * 2 +1) * n_el]);
+	}
+}
+}
+}
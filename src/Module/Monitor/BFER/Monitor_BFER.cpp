@@ -2,6 +2,9 @@
 #include <vector>
 #include <stdexcept>
 
+#include "Tools/Perf/count_errors.h"
+#include "Tools/Algo/Bit_packer.hpp"
+
 #include "Monitor_BFER.hpp"
 
 using namespace aff3ct::module;
@@ -13,7 +16,8 @@ Monitor_BFER<B>
   max_fe(max_fe),
   n_bit_errors(0),
   n_frame_errors(0),
-  n_analyzed_frames(0)
+  n_analyzed_frames(0),
+  frame_errors(n_frames, 0)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
@@ -26,52 +30,96 @@ Monitor_BFER<B>
 		return this->check_errors(static_cast<B*>(ps_U.get_dataptr()),
 		                          static_cast<B*>(ps_V.get_dataptr()));
 	});
+
+	const auto packed_size = tools::Bit_packer<B>::get_packed_size(this->size);
+	auto &p2 = this->create_task("check_errors_packed", mnt::tsk::check_errors_packed);
+	auto &p2s_U = this->template create_socket_in<B>(p2, "U", packed_size * this->n_frames);
+	auto &p2s_V = this->template create_socket_in<B>(p2, "V", packed_size * this->n_frames);
+	this->create_codelet(p2, [this, &p2s_U, &p2s_V]() -> int
+	{
+		return this->check_errors_packed(static_cast<B*>(p2s_U.get_dataptr()),
+		                                 static_cast<B*>(p2s_V.get_dataptr()));
+	});
 }
 
 template <typename B>
 int Monitor_BFER<B>
 ::check_errors(const B *U, const B *V, const int frame_id)
 {
+	if (frame_id >= 0)
+	{
+		const auto f = frame_id % this->n_frames;
+		return this->_check_errors(U + f * this->size, V + f * this->size, f);
+	}
+
+	// inter-frame: all the frames are counted in one pass over U and V and the counters are published once
+	for (auto f = 0; f < this->n_frames; f++)
+		this->frame_errors[f] = tools::count_errors(U + f * this->size, V + f * this->size, this->size);
+
+	return this->update_counters(this->frame_errors.data(), 0, this->n_frames);
+}
+
+template <typename B>
+int Monitor_BFER<B>
+::check_errors_packed(const B *U, const B *V, const int frame_id)
+{
+	const auto n_bytes = tools::Bit_packer<B>::get_packed_size(this->size) * (int)sizeof(B);
+	const auto *U_bytes = reinterpret_cast<const uint8_t*>(U);
+	const auto *V_bytes = reinterpret_cast<const uint8_t*>(V);
+
 	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
-	int n_be = 0;
 	for (auto f = f_start; f < f_stop; f++)
-		n_be += this->_check_errors(U + f * this->size,
-		                            V + f * this->size,
-		                            f);
+		this->frame_errors[f] = tools::count_errors_packed(U_bytes + f * n_bytes, V_bytes + f * n_bytes, this->size);
 
-	return n_be;
+	return this->update_counters(this->frame_errors.data() + f_start, f_start, f_stop - f_start);
 }
 
 template <typename B>
 int Monitor_BFER<B>
 ::_check_errors(const B *U, const B *V, const int frame_id)
 {
-	auto bit_errors_count = 0;
-	for (auto b = 0; b < this->size; b++)
-		bit_errors_count += !U[b] != !V[b];
+	const int bit_errors_count = tools::count_errors(U, V, this->size);
+	return this->update_counters(&bit_errors_count, frame_id, 1);
+}
+
+template <typename B>
+int Monitor_BFER<B>
+::update_counters(const int *bit_errors_counts, const int f_start, const int n_frames)
+{
+	const auto f_stop = f_start + n_frames;
+
+	unsigned long long n_be = 0, n_fe = 0;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		n_be += bit_errors_counts[f];
+		n_fe += bit_errors_counts[f] != 0;
+	}
 
-	if (bit_errors_count)
+	if (n_fe)
 	{
-		n_bit_errors += bit_errors_count;
-		n_frame_errors++;
+		// single writer: a relaxed load/store is enough and avoids a locked read-modify-write
+		n_bit_errors  .store(n_bit_errors  .load(std::memory_order_relaxed) + n_be, std::memory_order_relaxed);
+		n_frame_errors.store(n_frame_errors.load(std::memory_order_relaxed) + n_fe, std::memory_order_relaxed);
 
-		for (auto c : this->callbacks_fe)
-			c(bit_errors_count, frame_id);
+		for (auto f = 0; f < n_frames; f++)
+			if (bit_errors_counts[f])
+				for (auto c : this->callbacks_fe)
+					c(bit_errors_counts[f], f_start + f);
 
-		if (this->fe_limit_achieved() && frame_id == this->n_frames -1)
+		if (this->fe_limit_achieved() && f_stop == this->n_frames && bit_errors_counts[n_frames -1])
 			for (auto c : this->callbacks_fe_limit_achieved)
 				c();
 	}
 
-	n_analyzed_frames++;
+	n_analyzed_frames.store(n_analyzed_frames.load(std::memory_order_relaxed) + n_frames, std::memory_order_relaxed);
 
-	if (frame_id == this->n_frames -1)
+	if (f_stop == this->n_frames)
 		for (auto c : this->callbacks_check)
 			c();
 
-	return bit_errors_count;
+	return (int)n_be;
 }
 
 template <typename B>
@@ -92,21 +140,21 @@ template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_analyzed_fra() const
 {
-	return n_analyzed_frames;
+	return n_analyzed_frames.load(std::memory_order_relaxed);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_fe() const
 {
-	return n_frame_errors;
+	return n_frame_errors.load(std::memory_order_relaxed);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_be() const
 {
-	return n_bit_errors;
+	return n_bit_errors.load(std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -162,9 +210,9 @@ void Monitor_BFER<B>
 {
 	Monitor::reset();
 
-	this->n_bit_errors      = 0;
-	this->n_frame_errors    = 0;
-	this->n_analyzed_frames = 0;
+	this->n_bit_errors     .store(0, std::memory_order_relaxed);
+	this->n_frame_errors   .store(0, std::memory_order_relaxed);
+	this->n_analyzed_frames.store(0, std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -3,6 +3,7 @@
 
 #include <chrono>
 #include <vector>
+#include <atomic>
 #include <functional>
 
 #include "../Monitor.hpp"
@@ -17,9 +18,16 @@ class Monitor_BFER : public Monitor
 protected:
 	const unsigned max_fe;
 
-	unsigned long long n_bit_errors;
-	unsigned long long n_frame_errors;
-	unsigned long long n_analyzed_frames;
+	// the counters are only written by the thread which owns the monitor but they are read by the other threads (the
+	// reduction and the terminal): relaxed atomics padded to not share a cache line with the counters of the other
+	// monitors
+	uint8_t pad_counters_0[64];
+	std::atomic<unsigned long long> n_bit_errors;
+	std::atomic<unsigned long long> n_frame_errors;
+	std::atomic<unsigned long long> n_analyzed_frames;
+	uint8_t pad_counters_1[64];
+
+	std::vector<int> frame_errors; // number of bit errors of each frame of the last check
 
 	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
 	std::vector<std::function<void(          void)>> callbacks_check;
@@ -69,6 +77,16 @@ public:
 
 	virtual int check_errors(const B *U, const B *V, const int frame_id = -1);
 
+	/*!
+	 * \brief Same as 'check_errors' but the frames of 'U' and 'V' are packed in 64-bit words (each frame of 'size'
+	 *        bits starts on a new word, see 'Bit_packer::pack_words'): the errors are counted with one popcount per
+	 *        word.
+	 *
+	 * \param U: the original packed message.
+	 * \param V: the decoded packed message.
+	 */
+	virtual int check_errors_packed(const B *U, const B *V, const int frame_id = -1);
+
 	virtual bool fe_limit_achieved();
 	unsigned get_fe_limit() const;
 
@@ -88,6 +106,9 @@ public:
 
 protected:
 	virtual int _check_errors(const B *U, const B *V, const int frame_id);
+
+	// add the bit errors of the frames [f_start, f_start + n_frames) to the counters and call the callbacks
+	int update_counters(const int *bit_errors_counts, const int f_start, const int n_frames);
 };
 }
 }
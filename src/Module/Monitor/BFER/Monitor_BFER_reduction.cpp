@@ -17,7 +17,12 @@ Monitor_BFER_reduction<B>
                          const int n_frames)
 : Monitor_BFER<B>           (size, max_fe, n_frames),
   n_analyzed_frames_historic(0                     ),
-  monitors                  (monitors              )
+  monitors                  (monitors              ),
+  n_analyzed_frames_resumed (0                     ),
+  n_frame_errors_resumed    (0                     ),
+  n_bit_errors_resumed      (0                     ),
+  n_fe_total                (0                     ),
+  stop                      (max_fe == 0           )
 {
 	const std::string name = "Monitor_BFER_reduction";
 	this->set_name(name);
@@ -32,6 +37,8 @@ Monitor_BFER_reduction<B>
 	for (size_t i = 0; i < monitors.size(); ++i)
 		if (monitors[i] == nullptr)
 			throw tools::logic_error(__FILE__, __LINE__, __func__, "'monitors[i]' can't be null.");
+
+	this->add_handlers_fe();
 }
 
 template <typename B>
@@ -44,11 +51,11 @@ template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_analyzed_fra() const
 {
-	unsigned long long cur_fra = this->n_analyzed_frames;
+	unsigned long long cur_fra = this->n_analyzed_frames.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_fra += monitors[i]->get_n_analyzed_fra();
 
-	return cur_fra;
+	return cur_fra + this->n_analyzed_frames_resumed;
 }
 
 template <typename B>
@@ -62,22 +69,41 @@ template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_fe() const
 {
-	auto cur_fe = this->n_frame_errors;
+	unsigned long long cur_fe = this->n_frame_errors.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_fe += monitors[i]->get_n_fe();
 
-	return cur_fe;
+	return cur_fe + this->n_frame_errors_resumed;
 }
 
 template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_be() const
 {
-	auto cur_be = this->n_bit_errors;
+	unsigned long long cur_be = this->n_bit_errors.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_be += monitors[i]->get_n_be();
 
-	return cur_be;
+	return cur_be + this->n_bit_errors_resumed;
+}
+
+template <typename B>
+bool Monitor_BFER_reduction<B>
+::fe_limit_achieved()
+{
+	return stop.load(std::memory_order_relaxed) || Monitor::interrupt;
+}
+
+template <typename B>
+void Monitor_BFER_reduction<B>
+::resume(const unsigned long long n_analyzed_fra, const unsigned long long n_fe, const unsigned long long n_be)
+{
+	n_analyzed_frames_resumed = n_analyzed_fra;
+	n_frame_errors_resumed    = n_fe;
+	n_bit_errors_resumed      = n_be;
+
+	n_fe_total.store(n_fe, std::memory_order_relaxed);
+	stop.store(n_fe >= this->get_fe_limit(), std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -88,6 +114,13 @@ void Monitor_BFER_reduction<B>
 	Monitor_BFER<B>::reset();
 	for (auto m : monitors)
 		m->reset();
+
+	n_analyzed_frames_resumed = 0;
+	n_frame_errors_resumed    = 0;
+	n_bit_errors_resumed      = 0;
+
+	n_fe_total.store(0, std::memory_order_relaxed);
+	stop.store(this->get_fe_limit() == 0, std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -97,6 +130,22 @@ void Monitor_BFER_reduction<B>
 	Monitor_BFER<B>::clear_callbacks();
 	for (auto m : monitors)
 		m->clear_callbacks();
+
+	this->add_handlers_fe();
+}
+
+template <typename B>
+void Monitor_BFER_reduction<B>
+::add_handlers_fe()
+{
+	// the frame errors are rare compared to the analyzed frames: the shared counter is only updated on a frame error
+	// and the stop flag is raised by the thread which reaches the limit
+	for (auto m : monitors)
+		m->add_handler_fe([this](unsigned, int)
+		{
+			if (this->n_fe_total.fetch_add(1, std::memory_order_relaxed) +1 >= this->get_fe_limit())
+				this->stop.store(true, std::memory_order_relaxed);
+		});
 }
 
 // ==================================================================================== explicit template instantiation 
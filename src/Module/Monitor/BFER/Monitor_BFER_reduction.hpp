@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include <atomic>
 
 #include "Monitor_BFER.hpp"
 
@@ -17,6 +18,17 @@ private:
 	unsigned long long n_analyzed_frames_historic;
 	std::vector<Monitor_BFER<B>*> monitors;
 
+	// counters of the current SNR point given by a previous run (resumed simulation)
+	unsigned long long n_analyzed_frames_resumed;
+	unsigned long long n_frame_errors_resumed;
+	unsigned long long n_bit_errors_resumed;
+
+	// read after each frame by all the threads, written only when a frame error occurs
+	uint8_t pad_stop_0[64];
+	std::atomic<unsigned long long> n_fe_total;
+	std::atomic<bool>               stop;
+	uint8_t pad_stop_1[64];
+
 public:
 	Monitor_BFER_reduction(const int size, const unsigned max_fe, std::vector<Monitor_BFER<B>*> monitors,
 	                       const int n_frames = 1);
@@ -27,8 +39,23 @@ public:
 	unsigned long long get_n_fe                   () const;
 	unsigned long long get_n_be                   () const;
 
+	/*!
+	 * \brief Tells if the frame error limit has been reached by the sum of the monitors (O(1), does not walk the
+	 *        monitors).
+	 */
+	virtual bool fe_limit_achieved();
+
+	/*!
+	 * \brief Starts the current SNR point from the counters of a previous run (has to be called before the simulation
+	 *        of the SNR point, the counters are cleared by 'reset').
+	 */
+	void resume(const unsigned long long n_analyzed_fra, const unsigned long long n_fe, const unsigned long long n_be);
+
 	virtual void reset();
 	virtual void clear_callbacks();
+
+private:
+	void add_handlers_fe();
 };
 }
 }
@@ -27,13 +27,14 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { check_errors, check_mutual_info, SIZE };
+			enum list { check_errors, check_mutual_info, check_errors_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace check_errors      { enum list { U,    V             , SIZE }; }
-			namespace check_mutual_info { enum list { bits, llrs_a, llrs_e, SIZE }; }
+			namespace check_errors        { enum list { U,    V             , SIZE }; }
+			namespace check_mutual_info   { enum list { bits, llrs_a, llrs_e, SIZE }; }
+			namespace check_errors_packed { enum list { U,    V             , SIZE }; }
 		}
 	}
 
@@ -0,0 +1,255 @@
+#include <map>
+#include <deque>
+#include <sstream>
+#include <functional>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Socket.hpp"
+#include "Sequence.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+Sequence
+::Sequence(Task &first)
+{
+	this->build({&first});
+}
+
+Sequence
+::Sequence(const std::vector<Task*> &firsts)
+{
+	this->build(firsts);
+}
+
+Sequence
+::~Sequence()
+{
+}
+
+const std::vector<Task*>& Sequence
+::get_tasks() const
+{
+	return this->tasks;
+}
+
+size_t Sequence
+::get_arena_size() const
+{
+	return this->arena.size();
+}
+
+size_t Sequence
+::share_buffers()
+{
+	if (!this->arena.empty())
+	{
+		std::stringstream message;
+		message << "The buffers of this sequence are already shared ('arena.size()' = " << this->arena.size() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	struct Buffer
+	{
+		Socket *socket;
+		size_t  first;  // position of the task which writes the buffer
+		size_t  last;   // position of the last task which reads the buffer
+		size_t  offset; // in the arena
+	};
+
+	std::map<const Task*, size_t> position;
+	for (size_t i = 0; i < this->tasks.size(); i++)
+		position[this->tasks[i]] = i;
+
+	// lifetime of each output buffer, the readers are found through the bindings (the bypassed tasks are transparent)
+	std::vector<Buffer> buffers;
+	for (size_t i = 0; i < this->tasks.size(); i++)
+	{
+		if (!this->tasks[i]->is_autoalloc())
+			continue;
+
+		for (auto *s_out : this->tasks[i]->sockets)
+		{
+			if (this->tasks[i]->get_socket_type(*s_out) != Socket_type::OUT)
+				continue;
+
+			auto last    = i;
+			auto outside = false;
+			std::function<void(const Socket&)> find_readers = [&](const Socket &s)
+			{
+				for (auto *b : s.get_bound_sockets())
+				{
+					auto &t = b->get_task();
+					const auto type = t.get_socket_type(*b);
+					if (type != Socket_type::OUT && !Sequence::is_no_op(t))
+					{
+						auto it = position.find(&t);
+						if (it == position.end())
+							outside = true;
+						else
+							last = std::max(last, it->second);
+					}
+					if (type != Socket_type::IN)
+						find_readers(*b);
+				}
+			};
+			find_readers(*s_out);
+
+			if (!outside)
+				buffers.push_back({s_out, i, last, 0});
+		}
+	}
+
+	// the biggest buffers are placed first, each buffer takes the lowest free range of the arena during its lifetime
+	std::stable_sort(buffers.begin(), buffers.end(), [](const Buffer &a, const Buffer &b)
+	{
+		return a.socket->get_databytes() > b.socket->get_databytes();
+	});
+
+	const auto align = (size_t)mipp::RequiredAlignment;
+	auto align_up = [align](const size_t n) { return ((n + align -1) / align) * align; };
+
+	size_t n_bytes_before = 0, arena_size = 0;
+	for (size_t b = 0; b < buffers.size(); b++)
+	{
+		const auto size = buffers[b].socket->get_databytes();
+		n_bytes_before += size;
+
+		std::vector<std::pair<size_t,size_t>> used;
+		for (size_t p = 0; p < b; p++)
+			if (buffers[p].first <= buffers[b].last && buffers[b].first <= buffers[p].last)
+				used.push_back(std::make_pair(buffers[p].offset, buffers[p].offset +
+				                                                 buffers[p].socket->get_databytes()));
+		std::sort(used.begin(), used.end());
+
+		size_t offset = 0;
+		for (auto &u : used)
+		{
+			if (offset + size <= u.first)
+				break;
+			offset = std::max(offset, align_up(u.second));
+		}
+
+		buffers[b].offset = offset;
+		arena_size = std::max(arena_size, offset + size);
+	}
+
+	if (buffers.empty())
+		return 0;
+
+	this->arena.resize(arena_size);
+
+	// the readers take the new address of the buffer by binding them again
+	std::function<void(Socket&)> bind_readers = [&](Socket &s)
+	{
+		const auto bound = s.get_bound_sockets(); // copy: 'bind' modifies the list of 's'
+		for (auto *b : bound)
+		{
+			b->bind(s);
+			if (b->get_task().get_socket_type(*b) != Socket_type::IN)
+				bind_readers(*b);
+		}
+	};
+
+	for (auto &b : buffers)
+	{
+		b.socket->get_task().set_out_buffer(*b.socket, (void*)(this->arena.data() + b.offset));
+		bind_readers(*b.socket);
+	}
+
+	return n_bytes_before > arena_size ? n_bytes_before - arena_size : 0;
+}
+
+bool Sequence
+::is_no_op(const Task &task)
+{
+	for (auto *s_out : task.sockets)
+		if (task.get_socket_type(*s_out) == Socket_type::OUT)
+			for (auto *s_in : task.sockets)
+				if (task.get_socket_type(*s_in) == Socket_type::IN && s_in->get_dataptr() == s_out->get_dataptr())
+					return true;
+
+	return false;
+}
+
+void Sequence
+::build(const std::vector<Task*> &firsts)
+{
+	if (firsts.empty())
+	{
+		std::stringstream message;
+		message << "'firsts' can't be empty.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// discover the graph: the successors of a task are the tasks of the input sockets bound to its output sockets
+	std::vector<Task*> discovered;
+	std::map<Task*, std::vector<Task*>> successors;
+	std::map<Task*, size_t> n_predecessors;
+
+	for (auto *t : firsts)
+		if (!n_predecessors.count(t))
+		{
+			n_predecessors[t] = 0;
+			discovered.push_back(t);
+		}
+
+	for (size_t d = 0; d < discovered.size(); d++)
+	{
+		auto *t = discovered[d];
+		for (auto *s_out : t->sockets)
+		{
+			if (t->get_socket_type(*s_out) == Socket_type::IN)
+				continue;
+
+			for (auto *s_in : s_out->get_bound_sockets())
+			{
+				auto &next = s_in->get_task();
+				if (next.get_socket_type(*s_in) == Socket_type::OUT)
+					continue; // an output aliased on this socket is not a dependency
+
+				auto &succ = successors[t];
+				if (std::find(succ.begin(), succ.end(), &next) != succ.end())
+					continue;
+				succ.push_back(&next);
+
+				if (!n_predecessors.count(&next))
+				{
+					n_predecessors[&next] = 0;
+					discovered.push_back(&next);
+				}
+				n_predecessors[&next]++;
+			}
+		}
+	}
+
+	// topological order (Kahn), the discovery order is kept between independent tasks
+	std::deque<Task*> ready;
+	for (auto *t : discovered)
+		if (n_predecessors[t] == 0)
+			ready.push_back(t);
+
+	size_t n_sorted = 0;
+	while (!ready.empty())
+	{
+		auto *t = ready.front();
+		ready.pop_front();
+		n_sorted++;
+
+		if (!Sequence::is_no_op(*t))
+			this->tasks.push_back(t);
+
+		for (auto *next : successors[t])
+			if (--n_predecessors[next] == 0)
+				ready.push_back(next);
+	}
+
+	if (n_sorted != discovered.size())
+	{
+		std::stringstream message;
+		message << "The graph of the bound tasks has a cycle, it can't be executed as a sequence ('discovered.size()' = "
+		        << discovered.size() << ", 'n_sorted' = " << n_sorted << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
@@ -0,0 +1,75 @@
+/*!
+ * \file
+ * \brief Flat execution plan of a graph of bound tasks.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SEQUENCE_HPP_
+#define SEQUENCE_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <mipp.h>
+
+#include "Task.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Sequence
+ *
+ * \brief Execution plan of the tasks reachable from one or more first tasks through the socket bindings.
+ *
+ * The graph is discovered once in the constructor by following the sockets bound to the output sockets
+ * (Socket::bind). The tasks which do nothing are removed (an output socket is bound on one of their input sockets, this
+ * is how the "NO" modules are bypassed) and the other ones are sorted in a topological order. The execution is then a
+ * flat loop over the tasks, without any test on the type of the modules.
+ *
+ * The socket bindings must not be modified after the construction of the sequence (the plan is not updated).
+ * The graph has to be acyclic: a feedback loop (like in the turbo demodulation) can't be compiled in a sequence.
+ *
+ * Optionally, the output buffers of the tasks can be moved in a single arena ('share_buffers'): a buffer is alive from
+ * the task which writes it to the last task of the sequence which reads it, and the buffers which are never alive at
+ * the same time share the same memory.
+ */
+class Sequence
+{
+protected:
+	std::vector<Task*>    tasks; // the tasks to execute, in a topological order
+	mipp::vector<uint8_t> arena; // the output buffers shared by the tasks (see 'share_buffers')
+
+public:
+	explicit Sequence(Task &first);
+	explicit Sequence(const std::vector<Task*> &firsts);
+	virtual ~Sequence();
+
+	inline void exec()
+	{
+		for (auto *t : this->tasks)
+			t->exec();
+	}
+
+	const std::vector<Task*>& get_tasks() const;
+
+	/*
+	 * Move the output buffers of the tasks in the arena, return the number of bytes saved. The buffers read by a task
+	 * which is not in the sequence are not moved. The arena is freed with the sequence: the tasks can't be executed
+	 * anymore after the destruction of the sequence.
+	 */
+	size_t share_buffers();
+
+	size_t get_arena_size() const;
+
+	// true if an output socket of the task is bound on one of its input sockets (the task is bypassed)
+	static bool is_no_op(const Task &task);
+
+private:
+	void build(const std::vector<Task*> &firsts);
+};
+}
+}
+
+#endif /* SEQUENCE_HPP_ */
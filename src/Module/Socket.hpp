@@ -2,7 +2,9 @@
 #define SOCKET_HPP_
 
 #include <string>
+#include <vector>
 #include <sstream>
+#include <algorithm>
 #include <typeindex>
 
 #include "Tools/Exception/exception.hpp"
@@ -40,14 +42,31 @@ protected:
 	      bool            fast;
 	      void*           dataptr;
 
+	Socket*              bound_socket;  // the socket bound to this one (nullptr if bound to a raw buffer or not bound)
+	std::vector<Socket*> bound_sockets; // the sockets which are bound to this one
+
 	Socket(Task &task, const std::string &name, const std::type_index datatype, const size_t databytes,
 	       const bool fast = false, void *dataptr = nullptr)
-	: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr)
+	: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr),
+	  bound_socket(nullptr)
 	{
 	}
 
 	~Socket()
 	{
+		unlink();
+		for (auto *s : bound_sockets)
+			s->bound_socket = nullptr;
+	}
+
+	inline void unlink()
+	{
+		if (this->bound_socket != nullptr)
+		{
+			auto &sockets = this->bound_socket->bound_sockets;
+			sockets.erase(std::remove(sockets.begin(), sockets.end(), this), sockets.end());
+			this->bound_socket = nullptr;
+		}
 	}
 
 public:
@@ -59,6 +78,10 @@ public:
 	inline size_t          get_n_elmts        () const { return get_databytes() / (size_t)get_datatype_size(); }
 	inline void*           get_dataptr        () const { return dataptr;                                       }
 	inline bool            is_fast            () const { return fast;                                          }
+	inline Task&           get_task           () const { return task;                                          }
+	inline Socket*         get_bound_socket   () const { return bound_socket;                                  }
+
+	inline const std::vector<Socket*>& get_bound_sockets() const { return bound_sockets; }
 
 	inline void set_fast(const bool fast) { this->fast = fast; }
 
@@ -106,6 +129,10 @@ public:
 
 		this->dataptr = s.dataptr;
 
+		this->unlink();
+		this->bound_socket = &s;
+		s.bound_sockets.push_back(this);
+
 		if (this->task.is_autoexec() && this->task.is_last_input_socket(*this))
 			return this->task.exec();
 		else
@@ -123,6 +150,7 @@ public:
 		if (is_fast())
 		{
 			this->dataptr = static_cast<void*>(vector.data());
+			this->unlink();
 			return 0;
 		}
 
@@ -153,6 +181,7 @@ public:
 		if (is_fast())
 		{
 			this->dataptr = static_cast<void*>(array);
+			this->unlink();
 			return 0;
 		}
 
@@ -190,6 +219,7 @@ public:
 		}
 
 		this->dataptr = dataptr;
+		this->unlink();
 
 		return 0;
 	}
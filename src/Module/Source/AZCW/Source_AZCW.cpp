@@ -24,6 +24,13 @@ void Source_AZCW<B>
 	std::fill(U_K, U_K + this->K, 0);
 }
 
+template <typename B>
+void Source_AZCW<B>
+::_generate_packed(uint64_t *U_K, const int frame_id)
+{
+	std::fill(U_K, U_K + (this->K + 63) / 64, (uint64_t)0);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -20,7 +20,8 @@ public:
 	virtual ~Source_AZCW();
 
 protected:
-	void _generate(B *U_K, const int frame_id);
+	void _generate       (B        *U_K, const int frame_id);
+	void _generate_packed(uint64_t *U_K, const int frame_id);
 };
 }
 }
@@ -28,6 +28,23 @@ void Source_random<B>
 		U_K[i] = (B)this->uniform_dist(this->rd_engine);
 }
 
+template <typename B>
+void Source_random<B>
+::_generate_packed(uint64_t *U_K, const int frame_id)
+{
+	// 32 bits per draw of the Mersenne Twister instead of one
+	const auto n_words = (this->K + 63) / 64;
+	for (auto w = 0; w < n_words; w++)
+	{
+		const uint64_t lo = this->rd_engine();
+		const uint64_t hi = this->rd_engine();
+		U_K[w] = lo | (hi << 32);
+	}
+
+	if (this->K % 64)
+		U_K[n_words -1] &= ((uint64_t)1 << (this->K % 64)) -1;
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
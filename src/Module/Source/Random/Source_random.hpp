@@ -27,7 +27,8 @@ public:
 	virtual ~Source_random();
 
 protected:
-	void _generate(B *U_K, const int frame_id);
+	void _generate       (B        *U_K, const int frame_id);
+	void _generate_packed(uint64_t *U_K, const int frame_id);
 };
 }
 }
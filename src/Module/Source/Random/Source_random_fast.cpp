@@ -67,6 +67,31 @@ void Source_random_fast<B>
 	}
 }
 
+template <typename B>
+void Source_random_fast<B>
+::_generate_packed(uint64_t *U_K, const int frame_id)
+{
+	const auto n_words = (this->K + 63) / 64;
+
+	// vectorized loop: a register of random 32-bit integers fills nElReg<int>() / 2 words
+	constexpr int n_words_reg = mipp::nElReg<int>() / 2;
+	auto w = 0;
+	if (n_words_reg > 0)
+		for (; w + n_words_reg <= n_words; w += n_words_reg)
+			mt19937_simd.rand_s32().storeu(reinterpret_cast<int*>(U_K + w));
+
+	// remaining scalar operations
+	for (; w < n_words; w++)
+	{
+		const uint64_t lo = mt19937.rand_u32();
+		const uint64_t hi = mt19937.rand_u32();
+		U_K[w] = lo | (hi << 32);
+	}
+
+	if (this->K % 64)
+		U_K[n_words -1] &= ((uint64_t)1 << (this->K % 64)) -1;
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -0,0 +1,76 @@
+#include "Source_random_philox.hpp"
+
+using namespace aff3ct::module;
+
+// the stream of the sources, the noise generators of the channels use an other one
+static constexpr uint32_t source_stream = 0;
+
+template <typename B>
+Source_random_philox<B>
+::Source_random_philox(const int K, const int seed, const int n_frames)
+: Source<B>(K, n_frames),
+  n_blocks((K + 127) / 128),
+  philox((uint32_t)seed, source_stream),
+  frame_index(0),
+  words(n_blocks * tools::PRNG_philox::n_words)
+{
+	const std::string name = "Source_random_philox";
+	this->set_name(name);
+}
+
+template <typename B>
+Source_random_philox<B>
+::~Source_random_philox()
+{
+}
+
+template <typename B>
+void Source_random_philox<B>
+::set_frame_index(const uint64_t frame_index)
+{
+	this->frame_index = frame_index;
+}
+
+template <typename B>
+void Source_random_philox<B>
+::_generate(B *U_K, const int frame_id)
+{
+	this->philox.generate((this->frame_index + frame_id) * this->n_blocks, this->n_blocks, this->words.data());
+
+	for (auto k = 0; k < this->K; k++)
+		U_K[k] = (B)((this->words[k >> 5] >> (k & 31)) & 1);
+
+	// the next call continues with the next frames if the index is not set again
+	if (frame_id == this->n_frames -1)
+		this->frame_index += this->n_frames;
+}
+
+template <typename B>
+void Source_random_philox<B>
+::_generate_packed(uint64_t *U_K, const int frame_id)
+{
+	this->philox.generate((this->frame_index + frame_id) * this->n_blocks, this->n_blocks, this->words.data());
+
+	// same bits as the unpacked frames: two 32-bit words of a block make a 64-bit word
+	const auto n_words = (this->K + 63) / 64;
+	for (auto w = 0; w < n_words; w++)
+		U_K[w] = (uint64_t)this->words[2 * w] | ((uint64_t)this->words[2 * w +1] << 32);
+
+	if (this->K % 64)
+		U_K[n_words -1] &= ((uint64_t)1 << (this->K % 64)) -1;
+
+	if (frame_id == this->n_frames -1)
+		this->frame_index += this->n_frames;
+}
+
+// ==================================================================================== explicit template instantiation 
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Source_random_philox<B_8>;
+template class aff3ct::module::Source_random_philox<B_16>;
+template class aff3ct::module::Source_random_philox<B_32>;
+template class aff3ct::module::Source_random_philox<B_64>;
+#else
+template class aff3ct::module::Source_random_philox<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,46 @@
+#ifndef SOURCE_RANDOM_PHILOX_HPP_
+#define SOURCE_RANDOM_PHILOX_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/PRNG/PRNG_philox.hpp"
+
+#include "../Source.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Source_random_philox
+ *
+ * \brief Random bits drawn from the Philox counter-based generator.
+ *
+ * The bits of the frame 'i' (index of the frame in the whole simulation) are the bits of the Philox blocks
+ * [i * n_blocks, (i +1) * n_blocks) with n_blocks = ceil(K / 128): a frame only depends on the seed and on its
+ * index, whatever the number of threads and the number of frames per call.
+ */
+template <typename B = int>
+class Source_random_philox : public Source<B>
+{
+private:
+	const unsigned        n_blocks;    // number of Philox blocks per frame
+	tools::PRNG_philox    philox;
+	uint64_t              frame_index; // index of the first frame of the next call
+	std::vector<uint32_t> words;
+
+public:
+	Source_random_philox(const int K, const int seed = 0, const int n_frames = 1);
+	virtual ~Source_random_philox();
+
+	virtual void set_frame_index(const uint64_t frame_index);
+
+protected:
+	void _generate       (B        *U_K, const int frame_id);
+	void _generate_packed(uint64_t *U_K, const int frame_id);
+};
+}
+}
+
+#endif /* SOURCE_RANDOM_PHILOX_HPP_ */
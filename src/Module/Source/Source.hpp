@@ -10,10 +10,13 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <sstream>
 #include <iostream>
+#include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -25,12 +28,13 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { generate, SIZE };
+			enum list { generate, generate_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace generate { enum list { U_K, SIZE }; }
+			namespace generate        { enum list { U_K, SIZE }; }
+			namespace generate_packed { enum list { U_K, SIZE }; }
 		}
 	}
 
@@ -49,6 +53,8 @@ class Source : public Module
 protected:
 	const int K; /*!< Number of information bits in one frame */
 
+	mipp::vector<B> U_K_unpacked; // allocated on the first call of the generic '_generate_packed'
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -79,6 +85,16 @@ public:
 
 			return 0;
 		});
+
+		auto &p2 = this->create_task("generate_packed");
+		auto &p2s_U_K = this->template create_socket_out<B>(p2, "U_K", tools::Bit_packer<B>::get_packed_size(this->K)
+		                                                               * this->n_frames);
+		this->create_codelet(p2, [this, &p2s_U_K]() -> int
+		{
+			this->generate_packed(static_cast<B*>(p2s_U_K.get_dataptr()));
+
+			return 0;
+		});
 	}
 
 	/*!
@@ -93,6 +109,17 @@ public:
 		return K;
 	}
 
+	/*!
+	 * \brief Sets the index (in the whole simulation) of the first frame of the next call.
+	 *
+	 * Only the counter-based sources draw the bits of a frame from its index, the others ignore it.
+	 *
+	 * \param frame_index: the index of the first frame of the next call.
+	 */
+	virtual void set_frame_index(const uint64_t frame_index)
+	{
+	}
+
 	/*!
 	 * \brief Fulfills a vector with bits.
 	 *
@@ -121,11 +148,38 @@ public:
 			this->_generate(U_K + f * this->K, f);
 	}
 
+	/*!
+	 * \brief Fulfills a vector with bits packed in 64-bit words (see 'tools::Bit_packer::get_packed_size').
+	 *
+	 * \param U_K: a vector of ceil(K / 64) words per frame to fill.
+	 */
+	virtual void generate_packed(B *U_K, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		const auto n_words = (this->K + 63) / 64;
+		auto *words = reinterpret_cast<uint64_t*>(U_K);
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_generate_packed(words + f * n_words, f);
+	}
+
 protected:
 	virtual void _generate(B *U_K, const int frame_id)
 	{
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
+
+	// the bits are generated unpacked and then packed, the sources which can draw the words directly override it
+	virtual void _generate_packed(uint64_t *U_K, const int frame_id)
+	{
+		if (this->U_K_unpacked.empty())
+			this->U_K_unpacked.resize(this->K);
+
+		this->_generate(this->U_K_unpacked.data(), frame_id);
+		tools::Bit_packer<B>::pack_words(this->U_K_unpacked.data(), U_K, this->K);
+	}
 };
 }
 }
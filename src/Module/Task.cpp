@@ -4,6 +4,8 @@
 
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
+#include "Tools/Perf/Perf_counters/Perf_counters.hpp"
+#include "Tools/Perf/Tracer/Tracer.hpp"
 
 #include "Module.hpp"
 #include "Socket.hpp"
@@ -29,6 +31,8 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   duration_total(std::chrono::nanoseconds(0)),
   duration_min(std::chrono::nanoseconds(0)),
   duration_max(std::chrono::nanoseconds(0)),
+  counting(false),
+  trace_id(-1),
   last_input_socket(nullptr)
 {
 }
@@ -179,10 +183,25 @@ static inline void display_data(const T *data,
 	std::cout.flags(f);
 }
 
+int Task::run_codelet()
+{
+	if (!tools::Tracer::is_enabled())
+		return this->codelet();
+
+	if (this->trace_id < 0)
+		this->trace_id = tools::Tracer::register_name(this->module.get_short_name() + "::" + this->get_name());
+
+	const auto begin = tools::Tracer::now();
+	const auto exec_status = this->codelet();
+	tools::Tracer::record((uint32_t)this->trace_id, begin, tools::Tracer::now());
+
+	return exec_status;
+}
+
 int Task::exec()
 {
 	if (fast)
-		return this->codelet();
+		return this->run_codelet();
 
 	if (can_exec())
 	{
@@ -240,9 +259,12 @@ int Task::exec()
 		int exec_status;
 		if (stats)
 		{
+			this->counting = tools::Perf_counters::is_enabled() && this->start_counters();
 			auto t_start = std::chrono::steady_clock::now();
-			exec_status = this->codelet();
+			exec_status = this->run_codelet();
 			auto duration = std::chrono::steady_clock::now() - t_start;
+			if (this->counting)
+				this->stop_counters();
 
 			this->duration_total += duration;
 			if (n_calls)
@@ -257,7 +279,7 @@ int Task::exec()
 			}
 		}
 		else
-			exec_status = this->codelet();
+			exec_status = this->run_codelet();
 		this->n_calls++;
 
 		if (debug)
@@ -367,6 +389,42 @@ Socket& Task::create_socket_out(const std::string &name, const size_t n_elmts)
 	return s;
 }
 
+void Task::set_out_buffer(Socket &s, void *dataptr)
+{
+	if (std::find(sockets.begin(), sockets.end(), &s) == sockets.end() || get_socket_type(s) != OUT)
+	{
+		std::stringstream message;
+		message << "'s' has to be an output socket of this task ('s.name' = " << s.get_name()
+		        << ", 'task.name' = " << this->get_name() << ", 'module.name' = " << module.get_name() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (dataptr == nullptr)
+	{
+		std::stringstream message;
+		message << "'dataptr' can't be NULL.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the buffers of 'autoalloc' are in the same order as the output sockets
+	if (this->is_autoalloc())
+	{
+		size_t b = 0;
+		for (auto *so : sockets)
+			if (get_socket_type(*so) == OUT)
+			{
+				if (so == &s)
+					break;
+				b++;
+			}
+
+		if (b < out_buffers.size() && out_buffers[b].data() == s.dataptr)
+			mipp::vector<uint8_t>().swap(out_buffers[b]);
+	}
+
+	s.dataptr = dataptr;
+}
+
 void Task::create_codelet(std::function<int(void)> &codelet)
 {
 	this->codelet = codelet;
@@ -425,6 +483,55 @@ const std::vector<std::chrono::nanoseconds>& Task::get_timers_max() const
 	return this->timers_max;
 }
 
+const std::vector<uint64_t>& Task::get_counters_total() const
+{
+	return this->counters_total;
+}
+
+const std::vector<std::vector<uint64_t>>& Task::get_timers_counters() const
+{
+	return this->timers_counters;
+}
+
+bool Task::start_counters()
+{
+	const auto n_events = tools::Perf_counters::get_events().size();
+	if (this->counters_total.size() != n_events)
+	{
+		this->counters_total.assign(n_events, 0);
+		this->counters_start.resize(n_events);
+		this->counters_mark .resize(n_events);
+		this->counters_now  .resize(n_events);
+		for (auto &c : this->timers_counters)
+			c.assign(n_events, 0);
+	}
+
+	if (!tools::Perf_counters::read(this->counters_start.data()))
+		return false;
+
+	std::copy(this->counters_start.begin(), this->counters_start.end(), this->counters_mark.begin());
+	return true;
+}
+
+void Task::stop_counters()
+{
+	if (tools::Perf_counters::read(this->counters_now.data()))
+		for (size_t e = 0; e < this->counters_total.size(); e++)
+			this->counters_total[e] += this->counters_now[e] - this->counters_start[e];
+
+	this->counting = false;
+}
+
+void Task::update_timer_counters(const int id)
+{
+	if (tools::Perf_counters::read(this->counters_now.data()))
+		for (size_t e = 0; e < this->counters_mark.size(); e++)
+		{
+			this->timers_counters[id][e] += this->counters_now[e] - this->counters_mark[e];
+			this->counters_mark[e] = this->counters_now[e];
+		}
+}
+
 Socket_type Task::get_socket_type(const Socket &s) const
 {
 	for (size_t i = 0; i < sockets.size(); i++)
@@ -439,11 +546,12 @@ Socket_type Task::get_socket_type(const Socket &s) const
 
 void Task::register_timer(const std::string &name)
 {
-	this->timers_name   .push_back(name                       );
-	this->timers_n_calls.push_back(0                          );
-	this->timers_total  .push_back(std::chrono::nanoseconds(0));
-	this->timers_max    .push_back(std::chrono::nanoseconds(0));
-	this->timers_min    .push_back(std::chrono::nanoseconds(0));
+	this->timers_name    .push_back(name                       );
+	this->timers_n_calls .push_back(0                          );
+	this->timers_total   .push_back(std::chrono::nanoseconds(0));
+	this->timers_max     .push_back(std::chrono::nanoseconds(0));
+	this->timers_min     .push_back(std::chrono::nanoseconds(0));
+	this->timers_counters.push_back(std::vector<uint64_t>(this->counters_total.size(), 0));
 }
 
 void Task::reset_stats()
@@ -457,6 +565,10 @@ void Task::reset_stats()
 	for (auto &x : this->timers_total  ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_min    ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_max    ) x = std::chrono::nanoseconds(0);
+
+	for (auto &x : this->counters_total) x = 0;
+	for (auto &c : this->timers_counters)
+		for (auto &x : c) x = 0;
 }
 
 // ==================================================================================== explicit template instantiation
@@ -62,6 +62,16 @@ protected:
 	std::vector<std::chrono::nanoseconds> timers_min;
 	std::vector<std::chrono::nanoseconds> timers_max;
 
+	// hardware counters (see 'tools::Perf_counters'), one value per event
+	bool                               counting;        // true during a codelet if the counters have been read
+	std::vector<uint64_t>              counters_total;
+	std::vector<std::vector<uint64_t>> timers_counters;
+	std::vector<uint64_t>              counters_start;  // counters at the beginning of the codelet
+	std::vector<uint64_t>              counters_mark;   // counters at the last 'update_timer' of the codelet
+	std::vector<uint64_t>              counters_now;
+
+	int64_t trace_id; // name of the task in the traces (see 'tools::Tracer'), -1 if not registered yet
+
 	Socket* last_input_socket;
 	std::vector<Socket_type> socket_type;
 
@@ -104,18 +114,23 @@ public:
 	       Socket_type   get_socket_type(const Socket &s) const;
 
 	// get stats
-	std::chrono::nanoseconds                     get_duration_total() const;
-	std::chrono::nanoseconds                     get_duration_avg  () const;
-	std::chrono::nanoseconds                     get_duration_min  () const;
-	std::chrono::nanoseconds                     get_duration_max  () const;
-	const std::vector<std::string>             & get_timers_name   () const;
-	const std::vector<uint32_t>                & get_timers_n_calls() const;
-	const std::vector<std::chrono::nanoseconds>& get_timers_total  () const;
-	const std::vector<std::chrono::nanoseconds>& get_timers_min    () const;
-	const std::vector<std::chrono::nanoseconds>& get_timers_max    () const;
+	std::chrono::nanoseconds                     get_duration_total () const;
+	std::chrono::nanoseconds                     get_duration_avg   () const;
+	std::chrono::nanoseconds                     get_duration_min   () const;
+	std::chrono::nanoseconds                     get_duration_max   () const;
+	const std::vector<std::string>             & get_timers_name    () const;
+	const std::vector<uint32_t>                & get_timers_n_calls () const;
+	const std::vector<std::chrono::nanoseconds>& get_timers_total   () const;
+	const std::vector<std::chrono::nanoseconds>& get_timers_min     () const;
+	const std::vector<std::chrono::nanoseconds>& get_timers_max     () const;
+	const std::vector<uint64_t>                & get_counters_total () const;
+	const std::vector<std::vector<uint64_t>>   & get_timers_counters() const;
 
 	int exec();
 
+	// bind the output socket 's' on an external buffer and free the buffer allocated for it by 'autoalloc'
+	void set_out_buffer(Socket &s, void *dataptr);
+
 	inline Socket& operator[](const int id)
 	{
 		return *this->sockets[id];
@@ -137,6 +152,10 @@ public:
 				this->timers_max[id] = duration;
 				this->timers_min[id] = duration;
 			}
+
+			// the counters since the previous timer of the codelet are given to this timer
+			if (this->counting)
+				this->update_timer_counters(id);
 		}
 	}
 
@@ -154,6 +173,12 @@ protected:
 
 	void create_codelet(std::function<int(void)> &codelet);
 
+	inline int run_codelet();
+
+	bool start_counters();
+	void stop_counters();
+	void update_timer_counters(const int id);
+
 private:
 	template <typename T>
 	inline Socket& create_socket(const std::string &name, const size_t n_elmts);
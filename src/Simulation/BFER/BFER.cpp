@@ -10,12 +10,18 @@
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Perf/Tracer/Tracer.hpp"
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 
 #ifdef ENABLE_MPI
 #include "Module/Monitor/BFER/Monitor_BFER_reduction_mpi.hpp"
 #endif
 
+#include "Module/Source/Source.hpp"
+#include "Module/CRC/CRC.hpp"
+#include "Module/Encoder/Encoder.hpp"
+#include "Module/Modem/Modem.hpp"
+
 #include "Factory/Module/Monitor/Monitor.hpp"
 #include "Factory/Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 
@@ -26,7 +32,7 @@ using namespace aff3ct::simulation;
 
 template <typename B, typename R, typename Q>
 BFER<B,R,Q>
-::BFER(const factory::BFER::parameters& params_BFER)
+::BFER(const factory::BFER::parameters& params_BFER, const int n_monitors)
 : Simulation(params_BFER),
   params_BFER(params_BFER),
 
@@ -41,11 +47,14 @@ BFER<B,R,Q>
 
   max_fra(0),
 
+  local_seed(params_BFER.local_seed),
+
   monitor    (params_BFER.n_threads, nullptr),
   monitor_red(                       nullptr),
   dumper     (params_BFER.n_threads, nullptr),
   dumper_red (                       nullptr),
-  terminal   (                       nullptr)
+  terminal   (                       nullptr),
+  checkpoint (                       nullptr)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -66,18 +75,22 @@ BFER<B,R,Q>
 		dumper_red = new tools::Dumper_reduction(dumpers);
 	}
 
+	// one monitor per thread by default
+	const auto n_mnt = n_monitors > 0 ? n_monitors : params_BFER.n_threads;
+
 	modules["monitor"] = std::vector<module::Module*>(params_BFER.n_threads, nullptr);
-	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+	for (auto tid = 0; tid < n_mnt; tid++)
 	{
 		this->monitor[tid] = this->build_monitor(tid);
 		modules["monitor"][tid] = this->monitor[tid];
 	}
+	const std::vector<module::Monitor_BFER<B>*> monitors(this->monitor.begin(), this->monitor.begin() + n_mnt);
 
 #ifdef ENABLE_MPI
 	// build a monitor to compute BER/FER (reduce the other monitors)
 	this->monitor_red = new module::Monitor_BFER_reduction_mpi<B>(this->monitor[0]->get_size(),
 	                                                              this->monitor[0]->get_fe_limit(),
-	                                                              this->monitor,
+	                                                              monitors,
 	                                                              std::this_thread::get_id(),
 	                                                              params_BFER.mpi_comm_freq,
 	                                                              params_BFER.src->n_frames);
@@ -85,9 +98,28 @@ BFER<B,R,Q>
 	// build a monitor to compute BER/FER (reduce the other monitors)
 	this->monitor_red = new module::Monitor_BFER_reduction<B>(this->monitor[0]->get_size(),
 	                                                          this->monitor[0]->get_fe_limit(),
-	                                                          this->monitor,
+	                                                          monitors,
 	                                                          params_BFER.src->n_frames);
 #endif
+
+	if (!params_BFER.chkpt_path.empty())
+	{
+#ifdef ENABLE_MPI
+		const auto writer = params_BFER.mpi_rank == 0;
+#else
+		const auto writer = true;
+#endif
+		this->checkpoint = new tools::Checkpoint_BFER<B>(params_BFER.chkpt_path, this->params_hash(),
+		                                                 *this->monitor_red, writer);
+		if (params_BFER.resume)
+			this->checkpoint->load();
+
+		// each run has its own seeds: the frames of a resumed SNR point do not overlap the ones of the previous runs
+		this->local_seed = (int)((unsigned)params_BFER.local_seed + (this->checkpoint->get_run() << 20));
+	}
+
+	if (!params_BFER.trace_path.empty())
+		tools::Tracer::enable((size_t)params_BFER.trace_size);
 }
 
 template <typename B, typename R, typename Q>
@@ -96,6 +128,7 @@ BFER<B,R,Q>
 {
 	release_objects();
 
+	if (checkpoint  != nullptr) { delete checkpoint;  checkpoint  = nullptr; }
 	if (monitor_red != nullptr) { delete monitor_red; monitor_red = nullptr; }
 	if (dumper_red  != nullptr) { delete dumper_red;  dumper_red  = nullptr; }
 
@@ -196,6 +229,17 @@ void BFER<B,R,Q>
 			}
 		}
 
+		// the SNR point has already been simulated by a previous run
+		typename tools::Checkpoint_BFER<B>::Point prev;
+		const auto resumed = this->checkpoint != nullptr && this->checkpoint->find(snr, prev);
+		const auto finished = resumed && prev.n_fe >= this->monitor_red->get_fe_limit();
+#ifdef ENABLE_MPI
+		if (resumed && params_BFER.mpi_rank == 0) // the counters of the other processes are reduced on the rank 0
+#else
+		if (resumed)
+#endif
+			this->monitor_red->resume(prev.n_fra, prev.n_fe, prev.n_be);
+
 #ifdef ENABLE_MPI
 		if (((!params_BFER.ter->disabled && snr == params_BFER.snr_min && !params_BFER.debug) ||
 		    (params_BFER.statistics && !params_BFER.debug)) && params_BFER.mpi_rank == 0)
@@ -214,10 +258,14 @@ void BFER<B,R,Q>
 #endif
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
+		if (this->checkpoint != nullptr)
+			this->checkpoint->start_periodic_save(snr, params_BFER.chkpt_freq);
+
 		auto simu_error = false;
 		try
 		{
-			this->_launch();
+			if (!finished)
+				this->_launch();
 		}
 		catch (std::exception const& e)
 		{
@@ -228,6 +276,19 @@ void BFER<B,R,Q>
 			simu_error = true;
 		}
 
+		if (this->checkpoint != nullptr)
+		{
+			this->checkpoint->stop_periodic_save();
+			try
+			{
+				this->checkpoint->save(snr);
+			}
+			catch (std::exception const& e)
+			{
+				std::cerr << tools::apply_on_each_line(e.what(), &tools::format_warning) << std::endl;
+			}
+		}
+
 #ifdef ENABLE_MPI
 		if (!params_BFER.ter->disabled && terminal != nullptr && !simu_error && params_BFER.mpi_rank == 0)
 #else
@@ -246,7 +307,8 @@ void BFER<B,R,Q>
 				{
 					std::vector<const module::Module*> sub_mod_vec;
 					for (auto *m : vm.second)
-						sub_mod_vec.push_back(m);
+						if (m != nullptr)
+							sub_mod_vec.push_back(m);
 					mod_vec.push_back(sub_mod_vec);
 				}
 
@@ -265,7 +327,28 @@ void BFER<B,R,Q>
 			this->dumper_red->clear();
 		}
 
-		if (!module::Monitor::is_interrupt() && this->monitor_red->get_n_fe() < this->monitor_red->get_fe_limit() &&
+		// the threads of the simulation and of the terminal are stopped: the timelines can be written
+		if (tools::Tracer::is_enabled())
+		{
+			std::stringstream s_snr;
+			s_snr << std::setprecision(2) << std::fixed << snr;
+
+			auto path = params_BFER.trace_path + "_" + s_snr.str();
+#ifdef ENABLE_MPI
+			path += "_rank" + std::to_string(params_BFER.mpi_rank);
+#endif
+			try
+			{
+				tools::Tracer::dump(path + ".json");
+			}
+			catch (std::exception const& e)
+			{
+				std::cerr << tools::apply_on_each_line(e.what(), &tools::format_warning) << std::endl;
+			}
+		}
+
+		if (!finished &&
+		    !module::Monitor::is_interrupt() && this->monitor_red->get_n_fe() < this->monitor_red->get_fe_limit() &&
 		    (max_fra == 0 || this->monitor_red->get_n_fe() < max_fra))
 			module::Monitor::stop();
 
@@ -289,6 +372,31 @@ void BFER<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::is_allocated(module::Task &task) const
+{
+	using namespace module;
+
+	const std::vector<std::pair<std::string,int>> packed_tasks = {{"source",  src::tsk::generate_packed    },
+	                                                              {"crc",     crc::tsk::build_packed       },
+	                                                              {"crc",     crc::tsk::extract_packed     },
+	                                                              {"encoder", enc::tsk::encode_packed      },
+	                                                              {"modem",   mdm::tsk::modulate_packed    },
+	                                                              {"monitor", mnt::tsk::check_errors_packed}};
+
+	for (auto &pt : packed_tasks)
+	{
+		const auto m = this->modules.find(pt.first);
+		if (m != this->modules.end())
+			for (auto *mm : m->second)
+				if (mm != nullptr && &(*mm)[pt.second] == &task)
+					return false;
+	}
+
+	return true;
+}
+
 template <typename B, typename R, typename Q>
 module::Monitor_BFER<B>* BFER<B,R,Q>
 ::build_monitor(const int tid)
@@ -303,6 +411,53 @@ tools::Terminal_BFER<B>* BFER<B,R,Q>
 	return factory::Terminal_BFER::build<B>(*params_BFER.ter, *this->monitor_red);
 }
 
+template <typename B, typename R, typename Q>
+uint64_t BFER<B,R,Q>
+::params_hash() const
+{
+	// the parameters of the "sim" group which do not change the statistics are not hashed
+	const std::vector<std::string> sim_keys = {"Type", "Type of bits", "Type of reals", "Type of quant. reals",
+	                                           "Code type (C)", "SNR type", "Coset approach (c)", "Coded monitoring",
+	                                           "Bit rate"};
+
+	std::map<std::string,factory::header_list> headers;
+	params_BFER.get_headers(headers, true);
+
+	// 64-bit FNV-1a
+	uint64_t h = 14695981039346656037ull;
+	auto mix = [&h](const std::string &str)
+	{
+		for (auto c : str)
+		{
+			h ^= (uint8_t)c;
+			h *= 1099511628211ull;
+		}
+		h ^= 0xFF; // separator
+		h *= 1099511628211ull;
+	};
+
+	for (auto &group : headers)
+	{
+		if (group.first == params_BFER.mnt->get_prefix() || group.first == params_BFER.ter->get_prefix())
+			continue;
+
+		for (auto &kv : group.second)
+		{
+			if (kv.first == "Seed")
+				continue;
+			if (group.first == params_BFER.get_prefix() &&
+			    std::find(sim_keys.begin(), sim_keys.end(), kv.first) == sim_keys.end())
+				continue;
+
+			mix(group.first);
+			mix(kv.first);
+			mix(kv.second);
+		}
+	}
+
+	return h;
+}
+
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid)
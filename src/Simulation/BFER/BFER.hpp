@@ -2,6 +2,7 @@
 #define SIMULATION_BFER_HPP_
 
 #include <map>
+#include <cstdint>
 #include <chrono>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 #include "Tools/Display/Dumper/Dumper.hpp"
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
+#include "Tools/Display/Checkpoint/Checkpoint_BFER.hpp"
 
 #include "Module/Module.hpp"
 #include "Module/Monitor/Monitor.hpp"
@@ -46,7 +48,10 @@ protected:
 
 	unsigned max_fra;
 
-	// the monitors of the the BFER simulation
+	// seed of the current run (the seed of the parameters is shifted for each resumed run)
+	int local_seed;
+
+	// the monitors of the the BFER simulation (one per thread, or less in the pipeline mode: the last ones are null)
 	std::vector<module::Monitor_BFER          <B>*> monitor;
 	            module::Monitor_BFER_reduction<B>*  monitor_red;
 
@@ -57,8 +62,11 @@ protected:
 	// terminal (for the output of the code)
 	tools::Terminal_BFER<B> *terminal;
 
+	// save the counters periodically to be able to resume the simulation
+	tools::Checkpoint_BFER<B> *checkpoint;
+
 public:
-	explicit BFER(const factory::BFER::parameters& params_BFER);
+	explicit BFER(const factory::BFER::parameters& params_BFER, const int n_monitors = 0);
 	virtual ~BFER();
 	void launch();
 
@@ -68,11 +76,18 @@ protected:
 	virtual void release_objects();
 	virtual void _launch() = 0;
 
+	// the tasks of the packed frames (source to modulator, CRC extraction and monitor) are not allocated
+	virtual bool is_allocated(module::Task &task) const;
+
 	module::Monitor_BFER <B>* build_monitor (const int tid = 0);
 	tools ::Terminal_BFER<B>* build_terminal(                 );
 
 private:
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
+
+	// hash of the parameters which change the statistics of the simulation (the SNR range, the number of threads, the
+	// seed or the stop criteria can change between two runs)
+	uint64_t params_hash() const;
 };
 }
 }
@@ -28,7 +28,7 @@ BFER_ite<B,R,Q>
   rd_engine_seed(params_BFER_ite.n_threads)
 {
 	for (auto tid = 0; tid < params_BFER_ite.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_ite.local_seed + tid);
+		rd_engine_seed[tid].seed(this->local_seed + tid);
 
 	this->modules["source"         ] = std::vector<module::Module*>(params_BFER_ite.n_threads, nullptr);
 	this->modules["crc"            ] = std::vector<module::Module*>(params_BFER_ite.n_threads, nullptr);
@@ -114,7 +114,8 @@ void BFER_ite<B,R,Q>
 
 		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_ite.err_track_threshold, "chn", true, this->params_BFER_ite.src->n_frames, {});
 
-		if (interleaver_core[tid]->is_uniform())
+		// the keyed interleavers have no lookup table to dump
+		if (interleaver_core[tid]->is_uniform() && !interleaver_core[tid]->is_keyed())
 			this->dumper[tid]->register_data(interleaver.get_lut(), this->params_BFER_ite.err_track_threshold, "itl", false, this->params_BFER_ite.src->n_frames, {});
 	}
 }
@@ -10,33 +10,37 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std<B,R,Q>
 ::BFER_std(const factory::BFER_std::parameters &params_BFER_std)
-: BFER<B,R,Q>(params_BFER_std),
+: BFER<B,R,Q>(params_BFER_std, params_BFER_std.pipeline_n_threads.empty() ? 0 :
+                               (int)params_BFER_std.pipeline_n_threads.back()),
   params_BFER_std(params_BFER_std),
 
-  source    (params_BFER_std.n_threads, nullptr),
-  crc       (params_BFER_std.n_threads, nullptr),
-  codec     (params_BFER_std.n_threads, nullptr),
-  modem     (params_BFER_std.n_threads, nullptr),
-  channel   (params_BFER_std.n_threads, nullptr),
-  quantizer (params_BFER_std.n_threads, nullptr),
-  coset_real(params_BFER_std.n_threads, nullptr),
-  coset_bit (params_BFER_std.n_threads, nullptr),
+  segment_stage(init_segment_stage(params_BFER_std)),
+  stage_slot   (init_stage_slot   (params_BFER_std)),
 
-  rd_engine_seed(params_BFER_std.n_threads)
-{
-	for (auto tid = 0; tid < params_BFER_std.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_std.local_seed + tid);
+  source    (stage_slot.back(), nullptr),
+  crc       (stage_slot.back(), nullptr),
+  codec     (stage_slot.back(), nullptr),
+  modem     (stage_slot.back(), nullptr),
+  channel   (stage_slot.back(), nullptr),
+  quantizer (stage_slot.back(), nullptr),
+  coset_real(stage_slot.back(), nullptr),
+  coset_bit (stage_slot.back(), nullptr),
 
-	this->modules["source"    ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["crc"       ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["encoder"   ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["puncturer" ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["modem"     ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["channel"   ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["quantizer" ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["coset_real"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["decoder"   ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
-	this->modules["coset_bit" ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
+  rd_engine_seed(stage_slot.back())
+{
+	for (auto slot = 0; slot < this->get_n_slots(); slot++)
+		rd_engine_seed[slot].seed(this->local_seed + slot);
+
+	this->modules["source"    ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["crc"       ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["encoder"   ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["puncturer" ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["modem"     ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["channel"   ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["quantizer" ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["coset_real"] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["decoder"   ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
+	this->modules["coset_bit" ] = std::vector<module::Module*>(this->get_n_slots(), nullptr);
 }
 
 template <typename B, typename R, typename Q>
@@ -45,42 +49,127 @@ BFER_std<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+std::vector<size_t> BFER_std<B,R,Q>
+::init_segment_stage(const factory::BFER_std::parameters &params_BFER_std)
+{
+	// 1 stage: the whole chain, 2 stages: the transmitter and the channel | the decoder and the monitor, 3 stages: the
+	// transmitter and the channel | the decoder | the monitor, 4 stages: the transmitter | the channel | the decoder |
+	// the monitor
+	switch (params_BFER_std.pipeline_n_threads.size())
+	{
+		case 2:  return {0, 0, 1, 1};
+		case 3:  return {0, 0, 1, 2};
+		case 4:  return {0, 1, 2, 3};
+		default: return {0, 0, 0, 0};
+	}
+}
+
+template <typename B, typename R, typename Q>
+std::vector<int> BFER_std<B,R,Q>
+::init_stage_slot(const factory::BFER_std::parameters &params_BFER_std)
+{
+	if (params_BFER_std.pipeline_n_threads.empty())
+		return {0, params_BFER_std.n_threads};
+
+	std::vector<int> stage_slot(1, 0);
+	for (auto n : params_BFER_std.pipeline_n_threads)
+		stage_slot.push_back(stage_slot.back() + (int)n);
+	return stage_slot;
+}
+
+template <typename B, typename R, typename Q>
+int BFER_std<B,R,Q>
+::get_n_slots() const
+{
+	return stage_slot.back();
+}
+
+template <typename B, typename R, typename Q>
+size_t BFER_std<B,R,Q>
+::get_slot_stage(const int slot) const
+{
+	size_t stage = 0;
+	while (slot >= stage_slot[stage +1])
+		stage++;
+	return stage;
+}
+
+template <typename B, typename R, typename Q>
+int BFER_std<B,R,Q>
+::get_slot(const segment_t segment, const int replica) const
+{
+	return stage_slot[segment_stage[segment]] + replica;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std<B,R,Q>
+::is_in_slot(const segment_t segment, const int slot) const
+{
+	return segment_stage[segment] == this->get_slot_stage(slot);
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std<B,R,Q>
 ::__build_communication_chain(const int tid)
 {
+	// there can be more slots than threads in the pipeline mode
+	for (auto slot = tid; slot < this->get_n_slots(); slot += this->params_BFER_std.n_threads)
+		this->build_modules(slot);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::build_modules(const int slot)
+{
+	const auto tx  = this->is_in_slot(SEG_TX,  slot);
+	const auto rx  = this->is_in_slot(SEG_RX,  slot);
+	const auto dcd = this->is_in_slot(SEG_DEC, slot);
+	const auto pct = this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO";
+
+	// the CRC of a slot is given to its codec (for the CRC aided decoders)
+	const auto cdc = tx || dcd || (rx && pct);
+
 	// build the objects
-	source     [tid] = build_source    (tid);
-	crc        [tid] = build_crc       (tid);
-	codec      [tid] = build_codec     (tid);
-	modem      [tid] = build_modem     (tid);
-	channel    [tid] = build_channel   (tid);
-	quantizer  [tid] = build_quantizer (tid);
-	coset_real [tid] = build_coset_real(tid);
-	coset_bit  [tid] = build_coset_bit (tid);
-
-	this->modules["source"    ][tid] = source    [tid];
-	this->modules["crc"       ][tid] = crc       [tid];
-	this->modules["encoder"   ][tid] = codec     [tid]->get_encoder();
-	this->modules["puncturer" ][tid] = codec     [tid]->get_puncturer();
-	this->modules["modem"     ][tid] = modem     [tid];
-	this->modules["channel"   ][tid] = channel   [tid];
-	this->modules["quantizer" ][tid] = quantizer [tid];
-	this->modules["coset_real"][tid] = coset_real[tid];
-	this->modules["decoder"   ][tid] = codec     [tid]->get_decoder_siho();
-	this->modules["coset_bit" ][tid] = coset_bit [tid];
-
-	this->monitor[tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[tid]));
+	if (tx      ) source     [slot] = build_source    (slot);
+	if (cdc     ) crc        [slot] = build_crc       (slot);
+	if (cdc     ) codec      [slot] = build_codec     (slot);
+	if (tx || rx) modem      [slot] = build_modem     (slot);
+	if (rx      ) channel    [slot] = build_channel   (slot);
+	if (rx      ) quantizer  [slot] = build_quantizer (slot);
+	if (dcd     ) coset_real [slot] = build_coset_real(slot);
+	if (dcd     ) coset_bit  [slot] = build_coset_bit (slot);
+
+	this->modules["source"    ][slot] = source    [slot];
+	this->modules["crc"       ][slot] = crc       [slot];
+	this->modules["encoder"   ][slot] = cdc ? codec[slot]->get_encoder     () : nullptr;
+	this->modules["puncturer" ][slot] = cdc ? codec[slot]->get_puncturer   () : nullptr;
+	this->modules["modem"     ][slot] = modem     [slot];
+	this->modules["channel"   ][slot] = channel   [slot];
+	this->modules["quantizer" ][slot] = quantizer [slot];
+	this->modules["coset_real"][slot] = coset_real[slot];
+	this->modules["decoder"   ][slot] = cdc ? codec[slot]->get_decoder_siho() : nullptr;
+	this->modules["coset_bit" ][slot] = coset_bit [slot];
+
+	if (!cdc)
+		return;
+
+	// in the pipeline mode the decoders are reset and the uniform interleavers are refreshed directly by the pipeline
+	const auto pipeline = !this->params_BFER_std.pipeline_n_threads.empty();
+
+	if (!pipeline)
+		this->monitor[slot]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[slot]));
 
 	try
 	{
-		auto *interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
+		auto *interleaver = codec[slot]->get_interleaver(); // can raise an exceptions
 		interleaver->init();
-		if (interleaver->is_uniform())
-			this->monitor[tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh, interleaver));
+		if (interleaver->is_uniform() && !pipeline)
+			this->monitor[slot]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh, interleaver));
 
-		if (this->params_BFER_std.err_track_enable && interleaver->is_uniform())
-			this->dumper[tid]->register_data(interleaver->get_lut(), this->params_BFER_std.err_track_threshold, "itl", false, this->params_BFER_std.src->n_frames, {});
+		// the keyed interleavers have no lookup table to dump
+		if (this->params_BFER_std.err_track_enable && interleaver->is_uniform() && !interleaver->is_keyed())
+			this->dumper[slot]->register_data(interleaver->get_lut(), this->params_BFER_std.err_track_threshold, "itl", false, this->params_BFER_std.src->n_frames, {});
 	}
 	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
 
@@ -88,22 +177,22 @@ void BFER_std<B,R,Q>
 	{
 		using namespace module;
 
-		auto &source  = *this->source [tid];
-		auto &encoder = *this->codec  [tid]->get_encoder();
-		auto &channel = *this->channel[tid];
+		auto &source  = *this->source [slot];
+		auto &encoder = *this->codec  [slot]->get_encoder();
+		auto &channel = *this->channel[slot];
 
 		source[src::tsk::generate].set_autoalloc(true);
 		auto src_data = (B*)(source[src::tsk::generate][src::sck::generate::U_K].get_dataptr());
 		auto src_size = (source[src::tsk::generate][src::sck::generate::U_K].get_databytes() / sizeof(B)) / this->params_BFER_std.src->n_frames;
-		this->dumper[tid]->register_data(src_data, (unsigned int)src_size, this->params_BFER_std.err_track_threshold, "src", false, this->params_BFER_std.src->n_frames, {});
+		this->dumper[slot]->register_data(src_data, (unsigned int)src_size, this->params_BFER_std.err_track_threshold, "src", false, this->params_BFER_std.src->n_frames, {});
 
 		encoder[enc::tsk::encode].set_autoalloc(true);
 		auto enc_data = (B*)(encoder[enc::tsk::encode][enc::sck::encode::X_N].get_dataptr());
 		auto enc_size = (encoder[enc::tsk::encode][enc::sck::encode::X_N].get_databytes() / sizeof(B)) / this->params_BFER_std.src->n_frames;
-		this->dumper[tid]->register_data(enc_data, (unsigned int)enc_size, this->params_BFER_std.err_track_threshold, "enc", false, this->params_BFER_std.src->n_frames,
+		this->dumper[slot]->register_data(enc_data, (unsigned int)enc_size, this->params_BFER_std.err_track_threshold, "enc", false, this->params_BFER_std.src->n_frames,
 		                                 {(unsigned)this->params_BFER_std.cdc->enc->K});
 
-		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_std.err_track_threshold, "chn", true, this->params_BFER_std.src->n_frames, {});
+		this->dumper[slot]->register_data(channel.get_noise(), this->params_BFER_std.err_track_threshold, "chn", true, this->params_BFER_std.src->n_frames, {});
 	}
 }
 
@@ -112,11 +201,14 @@ void BFER_std<B,R,Q>
 ::_launch()
 {
 	// set current sigma
-	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
+	for (auto slot = 0; slot < this->get_n_slots(); slot++)
 	{
-		this->channel[tid]->set_sigma(                                                                    this->sigma);
-		this->modem  [tid]->set_sigma(this->params_BFER_std.mdm->complex ? this->sigma * std::sqrt(2.f) : this->sigma);
-		this->codec  [tid]->set_sigma(                                                                    this->sigma);
+		if (this->channel[slot] != nullptr)
+			this->channel[slot]->set_sigma(this->sigma);
+		if (this->modem[slot] != nullptr)
+			this->modem[slot]->set_sigma(this->params_BFER_std.mdm->complex ? this->sigma * std::sqrt(2.f) : this->sigma);
+		if (this->codec[slot] != nullptr)
+			this->codec[slot]->set_sigma(this->sigma);
 	}
 }
 
@@ -124,7 +216,7 @@ template <typename B, typename R, typename Q>
 void BFER_std<B,R,Q>
 ::release_objects()
 {
-	const auto nthr = params_BFER_std.n_threads;
+	const auto nthr = this->get_n_slots();
 	for (auto i = 0; i < nthr; i++) if (source    [i] != nullptr) { delete source    [i]; source    [i] = nullptr; }
 	for (auto i = 0; i < nthr; i++) if (crc       [i] != nullptr) { delete crc       [i]; crc       [i] = nullptr; }
 	for (auto i = 0; i < nthr; i++) if (codec     [i] != nullptr) { delete codec     [i]; codec     [i] = nullptr; }
@@ -137,6 +229,14 @@ void BFER_std<B,R,Q>
 	BFER<B,R,Q>::release_objects();
 }
 
+template <typename B, typename R, typename Q>
+bool BFER_std<B,R,Q>
+::is_allocated(module::Task &task) const
+{
+	// the tasks of the packed frames are only executed with '--sim-packed'
+	return this->params_BFER_std.packed || BFER<B,R,Q>::is_allocated(task);
+}
+
 template <typename B, typename R, typename Q>
 module::Source<B>* BFER_std<B,R,Q>
 ::build_source(const int tid)
@@ -144,7 +244,8 @@ module::Source<B>* BFER_std<B,R,Q>
 	const auto seed_src = rd_engine_seed[tid]();
 
 	auto params_src = params_BFER_std.src->clone();
-	params_src->seed = seed_src;
+	// the counter-based source is the same in all the threads, the frame index makes the difference
+	params_src->seed = (params_BFER_std.src->type == "RAND_PHILOX") ? this->local_seed : seed_src;
 	auto s = params_src->template build<B>();
 	delete params_src;
 	return s;
@@ -203,7 +304,8 @@ module::Channel<R>* BFER_std<B,R,Q>
 	const auto seed_chn = rd_engine_seed[tid]();
 
 	auto params_chn = this->params_BFER_std.chn->clone();
-	params_chn->seed = seed_chn;
+	// the counter-based noise is the same in all the threads, the frame index makes the difference
+	params_chn->seed = (params_BFER_std.chn->implem == "PHILOX") ? this->local_seed : seed_chn;
 	auto c = params_chn->template build<R>();
 	delete params_chn;
 	return c;
@@ -25,8 +25,17 @@ template <typename B = int, typename R = float, typename Q = R>
 class BFER_std : public BFER<B,R,Q>
 {
 protected:
+	// the parts of the communication chain: from the source to the modulator, from the channel to the depuncturer,
+	// from the coset (real) to the CRC extraction and the monitor
+	enum segment_t { SEG_TX = 0, SEG_RX, SEG_DEC, SEG_MNT, N_SEGMENTS };
+
 	const factory::BFER_std::parameters &params_BFER_std;
 
+	// the modules of a replica of a stage are in one slot of the vectors of the communication chain (a slot only
+	// contains the modules of its stage), without the pipeline mode there is one stage with one replica per thread
+	const std::vector<size_t> segment_stage; // stage of each segment
+	const std::vector<int   > stage_slot;    // first slot of each stage, followed by the total number of slots
+
 	// communication chain
 	std::vector<module::Source    <B    >*> source;
 	std::vector<module::CRC       <B    >*> crc;
@@ -48,6 +57,12 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
 	virtual void release_objects();
+	virtual bool is_allocated(module::Task &task) const;
+
+	int    get_n_slots   (                                          ) const;
+	size_t get_slot_stage(const int slot                            ) const;
+	int    get_slot      (const segment_t segment, const int replica) const;
+	bool   is_in_slot    (const segment_t segment, const int slot   ) const;
 
 	module::Source    <B    >* build_source    (const int tid = 0);
 	module::CRC       <B    >* build_crc       (const int tid = 0);
@@ -57,6 +72,12 @@ protected:
 	module::Quantizer <R,Q  >* build_quantizer (const int tid = 0);
 	module::Coset     <B,Q  >* build_coset_real(const int tid = 0);
 	module::Coset     <B,B  >* build_coset_bit (const int tid = 0);
+
+private:
+	void build_modules(const int slot);
+
+	static std::vector<size_t> init_segment_stage(const factory::BFER_std::parameters &params_BFER_std);
+	static std::vector<int   > init_stage_slot   (const factory::BFER_std::parameters &params_BFER_std);
 };
 }
 }
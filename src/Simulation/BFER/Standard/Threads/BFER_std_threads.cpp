@@ -1,10 +1,15 @@
+#include <cmath>
 #include <cstring>
 #include <string>
 #include <vector>
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Work_stealing_pool.hpp"
+#include "Tools/Threads/Pipeline.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
 
@@ -18,7 +23,9 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std)
-: BFER_std<B,R,Q>(params_BFER_std)
+: BFER_std<B,R,Q>(params_BFER_std),
+  next_frame_index(0),
+  sequence(params_BFER_std.n_threads, nullptr)
 {
 	if (this->params_BFER_std.err_track_revert)
 	{
@@ -27,12 +34,85 @@ BFER_std_threads<B,R,Q>
 			                                   "Each thread will play the same frames. Please run with one thread.")
 			          << std::endl;
 	}
+
+	// the error tracker reads the frames in the buffers of the sockets after the execution of the monitor
+	if (this->params_BFER_std.share_buffers && (this->params_BFER_std.err_track_enable ||
+	                                            this->params_BFER_std.err_track_revert))
+	{
+		std::stringstream message;
+		message << "The shared buffers are not compatible with the error tracking feature.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (!this->params_BFER_std.pipeline_n_threads.empty())
+	{
+		if (this->params_BFER_std.err_track_enable || this->params_BFER_std.err_track_revert)
+		{
+			std::stringstream message;
+			message << "The pipeline mode is not compatible with the error tracking feature.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.debug)
+		{
+			std::stringstream message;
+			message << "The pipeline mode is not compatible with the debug mode.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.share_buffers)
+		{
+			std::stringstream message;
+			message << "The pipeline mode is not compatible with the shared buffers.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// the packed frames are unpacked by the modem and the decoded bits are packed by the CRC extraction: the modules
+	// which read or write the frames in between are not supported
+	if (this->params_BFER_std.packed)
+	{
+		if (this->params_BFER_std.coset || this->params_BFER_std.coded_monitoring)
+		{
+			std::stringstream message;
+			message << "The packed frames are not compatible with the coset approach and the coded monitoring.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+		{
+			std::stringstream message;
+			message << "The packed frames are not compatible with the puncturing ('pct->type' = "
+			        << this->params_BFER_std.cdc->pct->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.err_track_enable || this->params_BFER_std.err_track_revert)
+		{
+			std::stringstream message;
+			message << "The packed frames are not compatible with the error tracking feature.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
 }
 
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::~BFER_std_threads()
 {
+	for (auto &s : sequence)
+		if (s != nullptr) { delete s; s = nullptr; }
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::release_objects()
+{
+	// the sequences refer to the tasks of the modules
+	for (auto &s : sequence)
+		if (s != nullptr) { delete s; s = nullptr; }
+
+	BFER_std<B,R,Q>::release_objects();
 }
 
 template <typename B, typename R, typename Q>
@@ -41,6 +121,20 @@ void BFER_std_threads<B,R,Q>
 {
 	BFER_std<B,R,Q>::_launch();
 
+	// each SNR point has its own range of frame indexes
+	const auto snr_id = std::llround((this->snr - this->params_BFER_std.snr_min) / this->params_BFER_std.snr_step);
+	this->next_frame_index = (uint64_t)std::max(0ll, snr_id) << 40;
+
+	if (!this->params_BFER_std.pipeline_n_threads.empty())
+	{
+		this->launch_pipeline();
+
+		if (!this->prev_err_messages.empty())
+			throw std::runtime_error(this->prev_err_messages.back());
+
+		return;
+	}
+
 	std::vector<std::thread> threads(this->params_BFER_std.n_threads -1);
 	// launch a group of slave threads (there is "n_threads -1" slave threads)
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
@@ -63,7 +157,7 @@ void BFER_std_threads<B,R,Q>
 {
 	try
 	{
-		simu->sockets_binding(tid);
+		simu->sockets_binding(tid, tid, tid, tid);
 		simu->simulation_loop(tid);
 	}
 	catch (std::exception const& e)
@@ -79,21 +173,28 @@ void BFER_std_threads<B,R,Q>
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
-::sockets_binding(const int tid)
+::sockets_binding(const int tx, const int rx, const int dcd, const int mnt_id)
 {
 	using namespace module;
 
-	auto &src = *this->source    [tid];
-	auto &crc = *this->crc       [tid];
-	auto &enc = *this->codec     [tid]->get_encoder();
-	auto &pct = *this->codec     [tid]->get_puncturer();
-	auto &mdm = *this->modem     [tid];
-	auto &chn = *this->channel   [tid];
-	auto &qnt = *this->quantizer [tid];
-	auto &csr = *this->coset_real[tid];
-	auto &dec = *this->codec     [tid]->get_decoder_siho();
-	auto &csb = *this->coset_bit [tid];
-	auto &mnt = *this->monitor   [tid];
+	// without puncturing the depuncturer is bypassed (only bound), the one of the decoder is used when the receiver
+	// has no codec
+	const auto rx_cdc = this->codec[rx] != nullptr ? rx : dcd;
+
+	auto &src = *this->source    [tx    ];
+	auto &crc = *this->crc       [tx    ];
+	auto &enc = *this->codec     [tx    ]->get_encoder();
+	auto &pct = *this->codec     [tx    ]->get_puncturer();
+	auto &mdm = *this->modem     [tx    ];
+	auto &chn = *this->channel   [rx    ];
+	auto &dmd = *this->modem     [rx    ];
+	auto &qnt = *this->quantizer [rx    ];
+	auto &dpc = *this->codec     [rx_cdc]->get_puncturer();
+	auto &csr = *this->coset_real[dcd   ];
+	auto &dec = *this->codec     [dcd   ]->get_decoder_siho();
+	auto &csb = *this->coset_bit [dcd   ];
+	auto &crx = *this->crc       [dcd   ];
+	auto &mnt = *this->monitor   [mnt_id];
 
 	if (this->params_BFER_std.src->type == "AZCW")
 	{
@@ -115,6 +216,24 @@ void BFER_std_threads<B,R,Q>
 		mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
 		mdm[mdm::tsk::modulate].exec();
 		mdm[mdm::tsk::modulate].reset_stats();
+
+		if (this->params_BFER_std.packed)
+		{
+			auto src_pdata = (uint8_t*)(src[src::tsk::generate_packed][src::sck::generate_packed::U_K].get_dataptr());
+			auto src_pbytes = src[src::tsk::generate_packed][src::sck::generate_packed::U_K].get_databytes();
+			std::fill(src_pdata, src_pdata + src_pbytes, 0);
+		}
+	}
+	else if (this->params_BFER_std.packed)
+	{
+		if (this->params_BFER_std.crc->type == "NO")
+			crc[crc::tsk::build_packed][crc::sck::build_packed::U_K2](src[src::tsk::generate_packed][src::sck::generate_packed::U_K]);
+		if (this->params_BFER_std.cdc->enc->type == "NO")
+			enc[enc::tsk::encode_packed][enc::sck::encode_packed::X_N](crc[crc::tsk::build_packed][crc::sck::build_packed::U_K2]);
+
+		crc[crc::tsk::build_packed   ][crc::sck::build_packed   ::U_K1](src[src::tsk::generate_packed][src::sck::generate_packed::U_K ]);
+		enc[enc::tsk::encode_packed  ][enc::sck::encode_packed  ::U_K ](crc[crc::tsk::build_packed   ][crc::sck::build_packed   ::U_K2]);
+		mdm[mdm::tsk::modulate_packed][mdm::sck::modulate_packed::X_N1](enc[enc::tsk::encode_packed  ][enc::sck::encode_packed  ::X_N ]);
 	}
 	else
 	{
@@ -131,54 +250,59 @@ void BFER_std_threads<B,R,Q>
 		mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
 	}
 
+	// with an all zero codeword the frames are modulated once by the unpacked task
+	auto &mdm_X_N2 = this->params_BFER_std.packed && this->params_BFER_std.src->type != "AZCW" ?
+	                 mdm[mdm::tsk::modulate_packed][mdm::sck::modulate_packed::X_N2] :
+	                 mdm[mdm::tsk::modulate       ][mdm::sck::modulate       ::X_N2];
+
 	if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
 	{
 		if (this->params_BFER_std.chn->type == "NO")
 		{
-			chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N](mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N2]);
+			chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N](mdm_X_N2);
 			auto chn_data = (uint8_t*)(chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N].get_dataptr());
 			auto chn_bytes = chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N].get_databytes();
 			std::fill(chn_data, chn_data + chn_bytes, 0);
 		}
-		if (!mdm.is_filter())
-			mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N]);
-		if (!mdm.is_demodulator())
-			mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2](mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
+		if (!dmd.is_filter())
+			dmd[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N]);
+		if (!dmd.is_demodulator())
+			dmd[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2](dmd[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
 		if (this->params_BFER_std.qnt->type == "NO")
-			qnt[qnt::tsk::process][qnt::sck::process::Y_N2](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
+			qnt[qnt::tsk::process][qnt::sck::process::Y_N2](dmd[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
 
-		chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::X_N ](mdm[mdm::tsk::modulate     ][mdm::sck::modulate     ::X_N2]);
-		mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::H_N ](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::H_N ]);
-		mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N1](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::Y_N ]);
-		mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N1](mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N2]);
-		qnt[qnt::tsk::process      ][qnt::sck::process      ::Y_N1](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
+		chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::X_N ](mdm_X_N2);
+		dmd[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::H_N ](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::H_N ]);
+		dmd[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N1](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::Y_N ]);
+		dmd[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N1](dmd[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N2]);
+		qnt[qnt::tsk::process      ][qnt::sck::process      ::Y_N1](dmd[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
 	}
 	else
 	{
 		if (this->params_BFER_std.chn->type == "NO")
-			chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N](mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N2]);
-		if (!mdm.is_filter())
-			mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N]);
-		if (!mdm.is_demodulator())
-			mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2](mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
+			chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N](mdm_X_N2);
+		if (!dmd.is_filter())
+			dmd[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N]);
+		if (!dmd.is_demodulator())
+			dmd[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2](dmd[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
 		if (this->params_BFER_std.qnt->type == "NO")
-			qnt[qnt::tsk::process][qnt::sck::process::Y_N2](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
+			qnt[qnt::tsk::process][qnt::sck::process::Y_N2](dmd[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
 
-		chn[chn::tsk::add_noise ][chn::sck::add_noise ::X_N ](mdm[mdm::tsk::modulate  ][mdm::sck::modulate  ::X_N2]);
-		mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N1](chn[chn::tsk::add_noise ][chn::sck::add_noise ::Y_N ]);
-		mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N1](mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N2]);
-		qnt[qnt::tsk::process   ][qnt::sck::process   ::Y_N1](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
+		chn[chn::tsk::add_noise ][chn::sck::add_noise ::X_N ](mdm_X_N2);
+		dmd[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N1](chn[chn::tsk::add_noise ][chn::sck::add_noise ::Y_N ]);
+		dmd[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N1](dmd[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N2]);
+		qnt[qnt::tsk::process   ][qnt::sck::process   ::Y_N1](dmd[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
 	}
 
 	if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
-		pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
+		dpc[pct::tsk::depuncture][pct::sck::depuncture::Y_N2](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
 
-	pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
+	dpc[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
 
 	if (this->params_BFER_std.coset)
 	{
 		csr[cst::tsk::apply][cst::sck::apply::ref](enc[enc::tsk::encode    ][enc::sck::encode    ::X_N ]);
-		csr[cst::tsk::apply][cst::sck::apply::in ](pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
+		csr[cst::tsk::apply][cst::sck::apply::in ](dpc[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
 
 		if (this->params_BFER_std.coded_monitoring)
 		{
@@ -189,27 +313,33 @@ void BFER_std_threads<B,R,Q>
 		else
 		{
 			if (this->params_BFER_std.crc->type == "NO")
-				crc[crc::tsk::extract][crc::sck::extract::V_K2](csb[cst::tsk::apply][cst::sck::apply::out]);
+				crx[crc::tsk::extract][crc::sck::extract::V_K2](csb[cst::tsk::apply][cst::sck::apply::out]);
 
 			dec[dec::tsk::decode_siho][dec::sck::decode_siho::Y_N ](csr[cst::tsk::apply      ][cst::sck::apply      ::out ]);
 			csb[cst::tsk::apply      ][cst::sck::apply      ::ref ](crc[crc::tsk::build      ][crc::sck::build      ::U_K2]);
 			csb[cst::tsk::apply      ][cst::sck::apply      ::in  ](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K ]);
-			crc[crc::tsk::extract    ][crc::sck::extract    ::V_K1](csb[cst::tsk::apply      ][cst::sck::apply      ::out ]);
+			crx[crc::tsk::extract    ][crc::sck::extract    ::V_K1](csb[cst::tsk::apply      ][cst::sck::apply      ::out ]);
 		}
 	}
 	else
 	{
 		if (this->params_BFER_std.coded_monitoring)
 		{
-			dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::Y_N](pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
+			dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::Y_N](dpc[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
+		}
+		else if (this->params_BFER_std.packed)
+		{
+			// the extraction always packs the decoded bits, even without CRC
+			dec[dec::tsk::decode_siho   ][dec::sck::decode_siho   ::Y_N ](dpc[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
+			crx[crc::tsk::extract_packed][crc::sck::extract_packed::V_K1](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K ]);
 		}
 		else
 		{
 			if (this->params_BFER_std.crc->type == "NO")
-				crc[crc::tsk::extract][crc::sck::extract::V_K2](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K]);
+				crx[crc::tsk::extract][crc::sck::extract::V_K2](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K]);
 
-			dec[dec::tsk::decode_siho][dec::sck::decode_siho::Y_N ](pct[pct::tsk::depuncture ][pct::sck::depuncture ::Y_N2]);
-			crc[crc::tsk::extract    ][crc::sck::extract    ::V_K1](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K ]);
+			dec[dec::tsk::decode_siho][dec::sck::decode_siho::Y_N ](dpc[pct::tsk::depuncture ][pct::sck::depuncture ::Y_N2]);
+			crx[crc::tsk::extract    ][crc::sck::extract    ::V_K1](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K ]);
 		}
 	}
 
@@ -226,120 +356,363 @@ void BFER_std_threads<B,R,Q>
 			mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::V_N]);
 		}
 	}
+	else if (this->params_BFER_std.packed)
+	{
+		mnt[mnt::tsk::check_errors_packed][mnt::sck::check_errors_packed::U](src[src::tsk::generate_packed][src::sck::generate_packed::U_K ]);
+		mnt[mnt::tsk::check_errors_packed][mnt::sck::check_errors_packed::V](crx[crc::tsk::extract_packed ][crc::sck::extract_packed ::V_K2]);
+	}
 	else
 	{
 		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](src[src::tsk::generate][src::sck::generate::U_K ]);
-		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crc[crc::tsk::extract ][crc::sck::extract ::V_K2]);
+		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crx[crc::tsk::extract ][crc::sck::extract ::V_K2]);
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::set_frame_index(const int tid)
+{
+	const auto frame_index = this->next_frame_index.fetch_add((uint64_t)this->params_BFER_std.src->n_frames);
+
+	this->source [tid]->set_frame_index(frame_index);
+	this->channel[tid]->set_frame_index(frame_index);
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::simulation_loop(const int tid)
 {
-	auto &source     = *this->source    [tid];
-	auto &crc        = *this->crc       [tid];
-	auto &encoder    = *this->codec     [tid]->get_encoder();
-	auto &puncturer  = *this->codec     [tid]->get_puncturer();
-	auto &modem      = *this->modem     [tid];
-	auto &channel    = *this->channel   [tid];
-	auto &quantizer  = *this->quantizer [tid];
-	auto &coset_real = *this->coset_real[tid];
-	auto &decoder    = *this->codec     [tid]->get_decoder_siho();
-	auto &coset_bit  = *this->coset_bit [tid];
-	auto &monitor    = *this->monitor   [tid];
+	auto &source  = *this->source [tid];
+	auto &channel = *this->channel[tid];
+	auto &monitor = *this->monitor[tid];
 
 	using namespace module;
 	using namespace std::chrono;
+
+	// the tasks of the communication chain in the order of the data (the bypassed modules are not executed), with an
+	// all zero codeword the frames are already modulated so the chain starts with the channel
+	if (this->sequence[tid] == nullptr)
+	{
+		auto &first = this->params_BFER_std.src->type != "AZCW" ?
+		              source[this->params_BFER_std.packed ? src::tsk::generate_packed : src::tsk::generate] :
+		              this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos ?
+		              channel[chn::tsk::add_noise_wg] : channel[chn::tsk::add_noise];
+		this->sequence[tid] = new Sequence(first);
+
+		if (this->params_BFER_std.share_buffers)
+		{
+			const auto n_saved = this->sequence[tid]->share_buffers();
+			if (tid == 0)
+				std::clog << tools::format_info("Shared buffers: " +
+				                                std::to_string(this->sequence[tid]->get_arena_size() >> 10) +
+				                                " KB per thread (" + std::to_string(n_saved >> 10) + " KB saved).")
+				          << std::endl;
+		}
+	}
+	auto &sequence = *this->sequence[tid];
+	auto &check = monitor[this->params_BFER_std.packed ? mnt::tsk::check_errors_packed : mnt::tsk::check_errors];
+
 	auto t_snr = steady_clock::now();
 
 	// communication chain execution
 	while (!this->monitor_red->fe_limit_achieved() && // while max frame error count has not been reached
 	       (this->params_BFER_std.stop_time == seconds(0) || 
 	       (steady_clock::now() - t_snr) < this->params_BFER_std.stop_time) &&
-	       (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	       (this->max_fra == 0 || this->monitor_red->get_n_analyzed_fra() < this->max_fra))
 	{
 		if (this->params_BFER_std.debug)
 		{
-			if (!monitor[mnt::tsk::check_errors].get_n_calls())
+			if (!check.get_n_calls())
 				std::cout << "#" << std::endl;
 
 			std::cout << "# -------------------------------" << std::endl;
-			std::cout << "# New communication (n°" << monitor[mnt::tsk::check_errors].get_n_calls() << ")" << std::endl;
+			std::cout << "# New communication (n°" << check.get_n_calls() << ")" << std::endl;
 			std::cout << "# -------------------------------" << std::endl;
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_std.src->type != "AZCW")
+		this->set_frame_index(tid);
+		sequence.exec();
+	}
+}
+
+template <typename B, typename R, typename Q>
+std::vector<module::Task*> BFER_std_threads<B,R,Q>
+::build_pipeline_stage(const size_t stage, const int replica)
+{
+	using namespace module;
+
+	const auto slot = this->stage_slot[stage] + replica;
+	const auto pct  = this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO";
+
+	// same tasks as in the sequence of the 'simulation_loop' method
+	std::vector<Task*> tasks;
+
+	if (this->segment_stage[SEG_TX] == stage)
+	{
+		auto &source    = *this->source[slot];
+		auto &crc       = *this->crc   [slot];
+		auto &encoder   = *this->codec [slot]->get_encoder();
+		auto &puncturer = *this->codec [slot]->get_puncturer();
+		auto &modem     = *this->modem [slot];
+
+		if (this->params_BFER_std.src->type != "AZCW" && this->params_BFER_std.packed)
+		{
+			tasks.push_back(&source[src::tsk::generate_packed]);
+			if (this->params_BFER_std.crc->type != "NO")
+				tasks.push_back(&crc[crc::tsk::build_packed]);
+			if (this->params_BFER_std.cdc->enc->type != "NO")
+				tasks.push_back(&encoder[enc::tsk::encode_packed]);
+			tasks.push_back(&modem[mdm::tsk::modulate_packed]);
+		}
+		else if (this->params_BFER_std.src->type != "AZCW")
 		{
-			source[src::tsk::generate].exec();
+			tasks.push_back(&source[src::tsk::generate]);
 			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
+				tasks.push_back(&crc[crc::tsk::build]);
 			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
+				tasks.push_back(&encoder[enc::tsk::encode]);
+			if (pct)
+				tasks.push_back(&puncturer[pct::tsk::puncture]);
+			tasks.push_back(&modem[mdm::tsk::modulate]);
 		}
+	}
+
+	if (this->segment_stage[SEG_RX] == stage)
+	{
+		auto &channel   = *this->channel  [slot];
+		auto &modem     = *this->modem    [slot];
+		auto &quantizer = *this->quantizer[slot];
 
 		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
 		{
 			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
+				tasks.push_back(&channel[chn::tsk::add_noise_wg]);
 			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
+				tasks.push_back(&modem[mdm::tsk::filter]);
 			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+				tasks.push_back(&modem[mdm::tsk::demodulate_wg]);
 		}
 		else
 		{
 			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
+				tasks.push_back(&channel[chn::tsk::add_noise]);
 			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
+				tasks.push_back(&modem[mdm::tsk::filter]);
 			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+				tasks.push_back(&modem[mdm::tsk::demodulate]);
 		}
 
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
+		if (this->params_BFER_std.qnt->type != "NO")
+			tasks.push_back(&quantizer[qnt::tsk::process]);
+
+		if (pct)
+			tasks.push_back(&(*this->codec[slot]->get_puncturer())[pct::tsk::depuncture]);
+	}
+
+	if (this->segment_stage[SEG_DEC] == stage)
+	{
+		auto &crc        = *this->crc       [slot];
+		auto &coset_real = *this->coset_real[slot];
+		auto &decoder    = *this->codec     [slot]->get_decoder_siho();
+		auto &coset_bit  = *this->coset_bit [slot];
 
 		if (this->params_BFER_std.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
+			tasks.push_back(&coset_real[cst::tsk::apply]);
 
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
+		if (this->params_BFER_std.coded_monitoring)
+		{
+			tasks.push_back(&decoder[dec::tsk::decode_siho_cw]);
+			if (this->params_BFER_std.coset)
+				tasks.push_back(&coset_bit[cst::tsk::apply]);
+		}
+		else if (this->params_BFER_std.packed)
+		{
+			tasks.push_back(&decoder[dec::tsk::decode_siho]);
+			tasks.push_back(&crc[crc::tsk::extract_packed]);
 		}
 		else
 		{
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder[dec::tsk::decode_siho_cw].exec();
-			}
-			else
+			tasks.push_back(&decoder[dec::tsk::decode_siho]);
+			if (this->params_BFER_std.coset)
+				tasks.push_back(&coset_bit[cst::tsk::apply]);
+			if (this->params_BFER_std.crc->type != "NO")
+				tasks.push_back(&crc[crc::tsk::extract]);
+		}
+	}
+
+	if (this->segment_stage[SEG_MNT] == stage)
+	{
+		auto &monitor = *this->monitor[replica];
+		tasks.push_back(&monitor[this->params_BFER_std.packed ? mnt::tsk::check_errors_packed : mnt::tsk::check_errors]);
+	}
+
+	return tasks;
+}
+
+// seed of the uniform interleavers of a frame in the pipeline mode: the encoder and the decoder of the frame are in
+// different slots, they draw the same permutations from the index of the frame
+static int pipeline_itl_seed(const int local_seed, const uint64_t frame_index)
+{
+	auto z = frame_index + (uint64_t)(unsigned)local_seed * 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return (int)(uint32_t)(z ^ (z >> 31));
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch_pipeline()
+{
+	using namespace module;
+	using namespace std::chrono;
+
+	// a socket identified by its position in the stages
+	struct Socket_id { size_t stage, task, socket; };
+
+	try
+	{
+		const auto &n_replicas = this->params_BFER_std.pipeline_n_threads;
+		const auto  n_stages   = n_replicas.size();
+		const auto  max_rep    = (int)*std::max_element(n_replicas.begin(), n_replicas.end());
+
+		// bind the communication chains made of the replica 'r' of each stage (or of its last replica): each replica
+		// gets the bindings inside its stage, the data which cross the stages are read in the tokens. The chains are
+		// bound from the last to the first one, the first chain is then consistent for the analysis below.
+		for (auto r = max_rep -1; r >= 0; r--)
+		{
+			auto rep = [&](const segment_t seg) { return std::min(r, (int)n_replicas[this->segment_stage[seg]] -1); };
+			this->sockets_binding(this->get_slot(SEG_TX,  rep(SEG_TX )),
+			                      this->get_slot(SEG_RX,  rep(SEG_RX )),
+			                      this->get_slot(SEG_DEC, rep(SEG_DEC)),
+			                      rep(SEG_MNT));
+		}
+
+		std::vector<std::vector<std::vector<Task*>>> stages(n_stages); // tasks of each replica of each stage
+		for (size_t s = 0; s < n_stages; s++)
+			for (size_t r = 0; r < n_replicas[s]; r++)
+				stages[s].push_back(this->build_pipeline_stage(s, (int)r));
+
+		// find the data which cross the stages: an input socket of a stage bound to an output socket of a previous
+		// stage, the bindings are the same in all the replicas of a stage so the first one is enough
+		std::vector<Socket_id>                    producers; // one per crossing data
+		std::vector<std::pair<Socket_id, size_t>> consumers; // (input socket, crossing data id)
+		for (size_t s = 1; s < n_stages; s++)
+			for (size_t t = 0; t < stages[s][0].size(); t++)
+				for (size_t k = 0; k < stages[s][0][t]->sockets.size(); k++)
+				{
+					auto &sin = *stages[s][0][t]->sockets[k];
+					if (stages[s][0][t]->get_socket_type(sin) == OUT)
+						continue;
+
+					for (size_t ps = 0; ps < s; ps++)
+						for (size_t pt = 0; pt < stages[ps][0].size(); pt++)
+							for (size_t pk = 0; pk < stages[ps][0][pt]->sockets.size(); pk++)
+							{
+								auto &sout = *stages[ps][0][pt]->sockets[pk];
+								if (stages[ps][0][pt]->get_socket_type(sout) == IN ||
+								    sout.get_dataptr() != sin.get_dataptr())
+									continue;
+
+								size_t p = 0;
+								while (p < producers.size() && (producers[p].stage  != ps ||
+								                                producers[p].task   != pt ||
+								                                producers[p].socket != pk))
+									p++;
+								if (p == producers.size())
+									producers.push_back({ps, pt, pk});
+
+								consumers.push_back(std::make_pair(Socket_id{s, t, k}, p));
+							}
+				}
+
+		tools::Pipeline pipeline(n_replicas, (size_t)this->params_BFER_std.pipeline_queue_size);
+		tools::Work_stealing_pool pool((size_t)this->params_BFER_std.n_threads);
+
+		// the data of a frame in flight are copied in the buffers of its token between two stages
+		std::vector<std::vector<mipp::vector<uint8_t>>> tokens(pipeline.get_n_tokens());
+		for (auto &tok : tokens)
+			for (auto &p : producers)
+				tok.push_back(mipp::vector<uint8_t>(stages[p.stage][0][p.task]->sockets[p.socket]->get_databytes()));
+
+		// index of the first frame of each token
+		std::vector<uint64_t> token_frame(pipeline.get_n_tokens(), 0);
+
+		const auto uniform_itl = this->params_BFER_std.cdc->itl != nullptr && this->params_BFER_std.cdc->itl->core->uniform;
+		auto refresh_itl = [&](const int slot, const uint64_t frame_index)
+		{
+			if (!uniform_itl)
+				return;
+
+			auto *interleaver = this->codec[slot]->get_interleaver();
+			interleaver->set_seed(pipeline_itl_seed(this->local_seed, frame_index));
+			interleaver->refresh();
+		};
+
+		const auto n_frames = (unsigned)this->params_BFER_std.src->n_frames;
+		unsigned n_admitted_fra = 0;
+		auto t_snr = steady_clock::now();
+
+		auto admit = [&]() -> bool
+		{
+			if (this->monitor_red->fe_limit_achieved() || // while max frame error count has not been reached
+			    (this->params_BFER_std.stop_time != seconds(0) &&
+			    (steady_clock::now() - t_snr) >= this->params_BFER_std.stop_time) ||
+			    (n_admitted_fra >= this->max_fra && this->max_fra != 0))
+				return false;
+
+			n_admitted_fra += n_frames;
+			return true;
+		};
+
+		auto exec = [&](const size_t stage, const size_t replica, const size_t token)
+		{
+			auto &tasks = stages[stage][replica];
+			const auto slot = this->stage_slot[stage] + (int)replica;
+
+			if (stage == 0)
+				token_frame[token] = this->next_frame_index.fetch_add((uint64_t)n_frames);
+
+			if (this->segment_stage[SEG_TX] == stage)
 			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
+				this->source[slot]->set_frame_index(token_frame[token]);
+				refresh_itl(slot, token_frame[token]);
 			}
-		}
+			if (this->segment_stage[SEG_RX] == stage)
+				this->channel[slot]->set_frame_index(token_frame[token]);
+			if (this->segment_stage[SEG_DEC] == stage)
+				refresh_itl(slot, token_frame[token]);
+
+			for (auto &c : consumers)
+				if (c.first.stage == stage)
+					tasks[c.first.task]->sockets[c.first.socket]->bind((void*)tokens[token][c.second].data());
+
+			for (auto *t : tasks)
+				t->exec();
+
+			for (size_t p = 0; p < producers.size(); p++)
+				if (producers[p].stage == stage)
+				{
+					auto &s = *tasks[producers[p].task]->sockets[producers[p].socket];
+					std::copy((uint8_t*)s.get_dataptr(), (uint8_t*)s.get_dataptr() + s.get_databytes(),
+					          tokens[token][p].begin());
+				}
+
+			// the decoder of this replica is ready for a new frame
+			if (this->segment_stage[SEG_DEC] == stage)
+				this->codec[slot]->reset();
+		};
+
+		pipeline.run(pool, admit, exec);
+	}
+	catch (std::exception const& e)
+	{
+		module::Monitor::stop();
 
-		monitor[mnt::tsk::check_errors].exec();
+		this->mutex_exception.lock();
+		if (std::find(this->prev_err_messages.begin(), this->prev_err_messages.end(), e.what()) == this->prev_err_messages.end())
+			this->prev_err_messages.push_back(e.what());
+		this->mutex_exception.unlock();
 	}
 }
 
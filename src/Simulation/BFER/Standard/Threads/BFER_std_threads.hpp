@@ -1,6 +1,13 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+#include "Module/Task.hpp"
+#include "Module/Sequence.hpp"
+
 #include "../BFER_std.hpp"
 
 namespace aff3ct
@@ -10,18 +17,43 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_std_threads : public BFER_std<B,R,Q>
 {
+private:
+	using segment_t = typename BFER_std<B,R,Q>::segment_t;
+	using BFER_std<B,R,Q>::SEG_TX;
+	using BFER_std<B,R,Q>::SEG_RX;
+	using BFER_std<B,R,Q>::SEG_DEC;
+	using BFER_std<B,R,Q>::SEG_MNT;
+
+	// index of the next frame of the current SNR point, shared by all the communication chains: the counter-based
+	// sources and channels draw the data of a frame from its index
+	std::atomic<uint64_t> next_frame_index;
+
+	// the communication chain of each thread, built at the first SNR point (the bindings are the same for all the SNR
+	// points and the shared buffers have to stay in place)
+	std::vector<module::Sequence*> sequence;
+
 public:
 	explicit BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std_threads();
 
 protected:
 	virtual void _launch();
+	virtual void release_objects();
 
 private:
-	void sockets_binding(const int tid = 0);
+	// bind the modules of the transmitter, of the receiver and of the decoder of the slots 'tx', 'rx' and 'dcd' and the
+	// monitor 'mnt_id' (the same slot and monitor for all in a communication chain of the standard mode)
+	void sockets_binding(const int tx, const int rx, const int dcd, const int mnt_id);
 	void simulation_loop(const int tid = 0);
 
 	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+
+	// pipeline mode: the stages are executed by a work stealing pool instead of one thread per communication chain
+	void launch_pipeline();
+	std::vector<module::Task*> build_pipeline_stage(const size_t stage, const int replica = 0);
+
+	// number the next 'n_frames' frames of the communication chain 'tid'
+	void set_frame_index(const int tid = 0);
 };
 }
 }
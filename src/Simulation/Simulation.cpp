@@ -1,3 +1,5 @@
+#include "Tools/Perf/Perf_counters/Perf_counters.hpp"
+
 #include "Simulation.hpp"
 
 using namespace aff3ct;
@@ -19,12 +21,15 @@ void Simulation
 {
 	_build_communication_chain();
 
+	if (params.statistics)
+		tools::Perf_counters::set_events(params.stats_hw_events);
+
 	for (auto &m : modules)
 		for (auto mm : m.second)
 			if (mm != nullptr)
 				for (auto &t : mm->tasks)
 				{
-					t->set_autoalloc(true);
+					t->set_autoalloc(this->is_allocated(*t));
 
 					if (params.statistics)
 						t->set_stats(true);
@@ -44,3 +49,9 @@ void Simulation
 						t->set_fast(true);
 				}
 }
+
+bool Simulation
+::is_allocated(module::Task &/*task*/) const
+{
+	return true;
+}
@@ -49,6 +49,12 @@ public:
 protected:
 	void build_communication_chain();
 	virtual void _build_communication_chain() = 0;
+
+	/*!
+	 *  \brief Tells if the output buffers of a task are allocated when the communication chain is built (all the
+	 *         tasks by default).
+	 */
+	virtual bool is_allocated(module::Task &task) const;
 };
 }
 }
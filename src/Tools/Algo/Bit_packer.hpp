@@ -9,8 +9,10 @@
 #define BIT_PACKER_HPP_
 
 #include <cmath>
+#include <cstdint>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -218,6 +220,123 @@ struct Bit_packer
 		}
 	}
 
+	/*!
+	 * \brief Gets the number of 'B' elements required to store a frame packed in 64-bit words.
+	 *
+	 * In the word packed format, the bit 'i' of a frame is the bit (i % 64) of the word (i / 64) and the unused bits
+	 * of the last word are zero: the frames start on a 64-bit boundary.
+	 *
+	 * \param n_bits: number of bits in the frame.
+	 */
+	static inline int get_packed_size(const int n_bits)
+	{
+		return ((n_bits + 63) / 64) * (int)(sizeof(uint64_t) / sizeof(B));
+	}
+
+	/*!
+	 * \brief Packs bits in 64-bit words (see 'get_packed_size').
+	 *
+	 * \param vec_in:    an input vector of unpacked bits (only 1 bit per data is used to transport data).
+	 * \param words_out: an output vector of ceil('n_bits_per_frame' / 64) words per frame.
+	 */
+	static inline void pack_words(const B *vec_in, uint64_t *words_out, const int n_bits_per_frame,
+	                              const int n_frames = 1)
+	{
+		const auto n_words = (n_bits_per_frame + 63) / 64;
+
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto *in  = vec_in    + f * n_bits_per_frame;
+			      auto *out = words_out + f * n_words;
+
+			for (auto w = 0; w < n_words; w++)
+			{
+				const auto n_bits = std::min(64, n_bits_per_frame - w * 64);
+
+				uint64_t word = 0;
+				for (auto j = 0; j < n_bits; j++)
+					word |= (uint64_t)(in[w * 64 +j] != 0) << j;
+				out[w] = word;
+			}
+		}
+	}
+
+	/*!
+	 * \brief Unpacks bits from 64-bit words (see 'get_packed_size').
+	 *
+	 * \param words_in: an input vector of ceil('n_bits_per_frame' / 64) words per frame.
+	 * \param vec_out:  an output vector of unpacked bits.
+	 */
+	static inline void unpack_words(const uint64_t *words_in, B *vec_out, const int n_bits_per_frame,
+	                                const int n_frames = 1)
+	{
+		const auto n_words = (n_bits_per_frame + 63) / 64;
+
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto *in  = words_in + f * n_words;
+			      auto *out = vec_out  + f * n_bits_per_frame;
+
+			for (auto w = 0; w < n_words; w++)
+			{
+				const auto n_bits = std::min(64, n_bits_per_frame - w * 64);
+				const auto word   = in[w];
+
+				for (auto j = 0; j < n_bits; j++)
+					out[w * 64 +j] = (B)((word >> j) & 1);
+			}
+		}
+	}
+
+	/*!
+	 * \brief Copies 'n_bits' bits from a word packed vector to an other one (the destination bits after the copied
+	 *        ones are left unchanged).
+	 *
+	 * \param src:     the source words.
+	 * \param src_off: the position of the first bit to copy in 'src'.
+	 * \param dst:     the destination words.
+	 * \param dst_off: the position of the first copied bit in 'dst'.
+	 */
+	static inline void copy_bits(const uint64_t *src, const int src_off, uint64_t *dst, const int dst_off,
+	                             const int n_bits)
+	{
+		for (auto i = 0; i < n_bits; i += 64)
+		{
+			const auto n = std::min(64, n_bits - i);
+			Bit_packer<B>::write_bits(dst, dst_off + i, Bit_packer<B>::read_bits(src, src_off + i, n), n);
+		}
+	}
+
+	/*!
+	 * \brief Reads 'n_bits' (<= 64) consecutive bits from a word packed vector starting from the bit 'off'.
+	 */
+	static inline uint64_t read_bits(const uint64_t *words, const int off, const int n_bits)
+	{
+		const auto w = off >> 6;
+		const auto s = off & 63;
+
+		auto bits = words[w] >> s;
+		if (s != 0 && s + n_bits > 64)
+			bits |= words[w +1] << (64 - s);
+
+		return (n_bits == 64) ? bits : bits & (((uint64_t)1 << n_bits) -1);
+	}
+
+	/*!
+	 * \brief Writes the 'n_bits' (<= 64) lowest bits of 'bits' in a word packed vector starting from the bit 'off'
+	 *        (the other bits of the vector are left unchanged).
+	 */
+	static inline void write_bits(uint64_t *words, const int off, const uint64_t bits, const int n_bits)
+	{
+		const auto w    = off >> 6;
+		const auto s    = off & 63;
+		const auto mask = (n_bits == 64) ? ~(uint64_t)0 : (((uint64_t)1 << n_bits) -1);
+
+		words[w] = (words[w] & ~(mask << s)) | ((bits & mask) << s);
+		if (s != 0 && s + n_bits > 64)
+			words[w +1] = (words[w +1] & ~(mask >> (64 - s))) | ((bits & mask) >> (64 - s));
+	}
+
 private:
 	static inline void _pack(const B* vec_in, unsigned char* bytes_out, const int n_bits, const bool rev = false)
 	{
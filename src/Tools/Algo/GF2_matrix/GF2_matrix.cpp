@@ -0,0 +1,378 @@
+#include <string>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/bits.h"
+
+#include "GF2_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr unsigned GF2_matrix::block_size;
+
+static const char gf2_matrix_magic[8] = {'G','F','2','M','A','T','0','1'};
+
+GF2_matrix
+::GF2_matrix(const unsigned n_rows, const unsigned n_cols)
+: n_rows (n_rows                                   ),
+  n_cols (n_cols                                   ),
+  n_words((n_cols + 63) / 64                       ),
+  rows   (n_rows, std::vector<uint64_t>(n_words, 0))
+{
+}
+
+GF2_matrix
+::~GF2_matrix()
+{
+}
+
+unsigned GF2_matrix
+::get_n_rows() const
+{
+	return this->n_rows;
+}
+
+unsigned GF2_matrix
+::get_n_cols() const
+{
+	return this->n_cols;
+}
+
+unsigned GF2_matrix
+::get_n_words() const
+{
+	return this->n_words;
+}
+
+const uint64_t* GF2_matrix
+::get_row(const size_t row_index) const
+{
+	return this->rows[row_index].data();
+}
+
+void GF2_matrix
+::swap_rows(const size_t row_index1, const size_t row_index2)
+{
+	std::swap(this->rows[row_index1], this->rows[row_index2]);
+}
+
+void GF2_matrix
+::swap_cols(const size_t col_index1, const size_t col_index2)
+{
+	const auto w1 = col_index1 >> 6, s1 = col_index1 & 63;
+	const auto w2 = col_index2 >> 6, s2 = col_index2 & 63;
+
+	for (auto &r : this->rows)
+	{
+		const auto b1 = (r[w1] >> s1) & 1;
+		const auto b2 = (r[w2] >> s2) & 1;
+		if (b1 != b2)
+		{
+			r[w1] ^= (uint64_t)1 << s1;
+			r[w2] ^= (uint64_t)1 << s2;
+		}
+	}
+}
+
+void GF2_matrix
+::erase_row(const size_t row_index)
+{
+	this->rows.erase(this->rows.begin() + row_index);
+	this->n_rows--;
+}
+
+GF2_matrix GF2_matrix
+::from_sparse(const Sparse_matrix &sparse)
+{
+	GF2_matrix full(sparse.get_n_rows(), sparse.get_n_cols());
+
+	for (unsigned i = 0; i < sparse.get_n_rows(); i++)
+		for (auto j : sparse.get_cols_from_row(i))
+			full.set(i, j);
+
+	return full;
+}
+
+Sparse_matrix GF2_matrix
+::to_sparse() const
+{
+	Sparse_matrix sparse(this->n_rows, this->n_cols);
+
+	std::vector<unsigned> cols;
+	for (unsigned i = 0; i < this->n_rows; i++)
+	{
+		cols.clear();
+		for (unsigned w = 0; w < this->n_words; w++)
+			for (auto word = this->rows[i][w]; word; word &= word -1)
+				cols.push_back(w * 64 + tools::ctz(word));
+
+		sparse.add_row_connections(i, cols);
+	}
+
+	return sparse;
+}
+
+inline void GF2_matrix
+::xor_row(const size_t dst, const uint64_t *src, const unsigned first_word)
+{
+	auto *d = this->rows[dst].data() + first_word;
+	for (unsigned w = 0; w < this->n_words - first_word; w++)
+		d[w] ^= src[w];
+}
+
+inline uint64_t GF2_matrix
+::get_bits(const size_t row_index, const size_t col_index, const unsigned n_bits) const
+{
+	const auto &r = this->rows[row_index];
+	const auto  w = col_index >> 6;
+	const auto  s = col_index & 63;
+
+	auto bits = r[w] >> s;
+	if (s != 0 && s + n_bits > 64 && w +1 < this->n_words)
+		bits |= r[w +1] << (64 - s);
+
+	return (n_bits == 64) ? bits : bits & (((uint64_t)1 << n_bits) -1);
+}
+
+void GF2_matrix
+::create_diagonal(std::vector<unsigned>& swapped_cols)
+{
+	if (this->n_rows > this->n_cols)
+	{
+		std::stringstream message;
+		message << "'n_rows' has to be smaller or equal to 'n_cols' ('n_rows' = " << this->n_rows
+		        << ", 'n_cols' = " << this->n_cols << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the rows [blk_first, blk_first + n_pending) are pivots which have not been eliminated in the rows below yet,
+	// 'coefs[j]' gives the combination of these pivots which has to be added to the row j to bring it up to date
+	std::vector<uint32_t> coefs(this->n_rows, 0);
+	std::vector<uint64_t> table;
+	unsigned blk_first = 0;
+	unsigned n_pending = 0;
+
+	// bit 'a' of the returned mask is the bit in the column 'col' of the pending pivot 'a'
+	auto pending_col_mask = [&](const unsigned col) -> uint32_t
+	{
+		uint32_t mask = 0;
+		for (unsigned a = 0; a < n_pending; a++)
+			mask |= (uint32_t)this->at(blk_first + a, col) << a;
+		return mask;
+	};
+
+	// actual value of a bit of a row which is not up to date
+	auto actual_bit = [&](const unsigned row, const unsigned col, const uint32_t col_mask) -> bool
+	{
+		return this->at(row, col) ^ (tools::popcount(coefs[row] & col_mask) & 1);
+	};
+
+	// eliminate the pending pivots in all the rows below with one XOR per row (M4RI table)
+	auto flush = [&](const unsigned first_row)
+	{
+		if (n_pending)
+		{
+			const auto first_word = blk_first / 64;
+			const auto width      = this->n_words - first_word;
+
+			table.assign(((size_t)1 << n_pending) * width, 0);
+			for (unsigned a = 0; a < n_pending; a++)
+			{
+				const auto *p = this->rows[blk_first + a].data() + first_word;
+				for (size_t m = 0; m < ((size_t)1 << a); m++)
+				{
+					const auto *src = table.data() + m * width;
+					      auto *dst = table.data() + (m | ((size_t)1 << a)) * width;
+					for (unsigned w = 0; w < width; w++)
+						dst[w] = src[w] ^ p[w];
+				}
+			}
+
+			for (auto j = first_row; j < this->n_rows; j++)
+				if (coefs[j])
+				{
+					this->xor_row(j, table.data() + coefs[j] * width, first_word);
+					coefs[j] = 0;
+				}
+		}
+
+		blk_first = first_row;
+		n_pending = 0;
+	};
+
+	unsigned i = 0;
+	while (i < this->n_rows)
+	{
+		// bring the current row up to date
+		for (auto c = coefs[i]; c; c &= c -1)
+			this->xor_row(i, this->rows[blk_first + tools::ctz(c)].data() + blk_first / 64, blk_first / 64);
+		coefs[i] = 0;
+
+		if (this->at(i, i))
+		{
+			const auto col_mask = pending_col_mask(i);
+			for (auto j = i +1; j < this->n_rows; j++)
+				if (actual_bit(j, i, col_mask))
+					coefs[j] |= (uint32_t)1 << n_pending;
+
+			n_pending++;
+			i++;
+
+			if (n_pending == GF2_matrix::block_size)
+				flush(i);
+		}
+		else
+		{
+			auto found = false;
+
+			const auto col_mask = pending_col_mask(i);
+			for (auto j = i +1; j < this->n_rows; j++) // find an other row which is good
+				if (actual_bit(j, i, col_mask))
+				{
+					this->swap_rows(i, j);
+					std::swap(coefs[i], coefs[j]);
+					found = true;
+					break;
+				}
+
+			if (!found) // find an other column which is good
+				for (auto j = i +1; j < this->n_cols; j++)
+					if (this->at(i, j))
+					{
+						swapped_cols.push_back(i);
+						swapped_cols.push_back(j);
+						this->swap_cols(i, j);
+						found = true;
+						break;
+					}
+
+			if (!found) // the row is the null vector
+			{
+				this->erase_row(i);
+				coefs.erase(coefs.begin() + i);
+			}
+		}
+	}
+
+	flush(this->n_rows);
+}
+
+void GF2_matrix
+::create_identity()
+{
+	if (this->n_rows > this->n_cols)
+	{
+		std::stringstream message;
+		message << "'n_rows' has to be smaller or equal to 'n_cols' ('n_rows' = " << this->n_rows
+		        << ", 'n_cols' = " << this->n_cols << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<uint64_t> table;
+
+	// from the bottom to the top, by blocks of pivots [lo, hi)
+	for (auto hi = this->n_rows; hi > 0;)
+	{
+		const auto lo         = (hi > GF2_matrix::block_size) ? hi - GF2_matrix::block_size : 0;
+		const auto n_piv      = hi - lo;
+		const auto first_word = lo / 64;
+		const auto width      = this->n_words - first_word;
+
+		// back substitution inside the block
+		for (auto i = hi -1; i > lo; i--)
+			for (auto j = i; j > lo; j--)
+				if (this->at(j -1, i))
+					this->xor_row(j -1, this->rows[i].data() + i / 64, i / 64);
+
+		// all the combinations of the pivots of the block
+		table.assign(((size_t)1 << n_piv) * width, 0);
+		for (unsigned a = 0; a < n_piv; a++)
+		{
+			const auto *p = this->rows[lo + a].data() + first_word;
+			for (size_t m = 0; m < ((size_t)1 << a); m++)
+			{
+				const auto *src = table.data() + m * width;
+				      auto *dst = table.data() + (m | ((size_t)1 << a)) * width;
+				for (unsigned w = 0; w < width; w++)
+					dst[w] = src[w] ^ p[w];
+			}
+		}
+
+		// eliminate the pivots of the block in the rows above with one XOR per row
+		for (unsigned j = 0; j < lo; j++)
+		{
+			const auto m = this->get_bits(j, lo, n_piv);
+			if (m)
+				this->xor_row(j, table.data() + m * width, first_word);
+		}
+
+		hi = lo;
+	}
+}
+
+uint64_t GF2_matrix
+::hash() const
+{
+	uint64_t h = 14695981039346656037ull;
+	auto mix = [&h](uint64_t v)
+	{
+		for (auto b = 0; b < 8; b++)
+		{
+			h ^= (v >> (8 * b)) & 0xFF;
+			h *= 1099511628211ull;
+		}
+	};
+
+	mix(this->n_rows);
+	mix(this->n_cols);
+	for (auto &r : this->rows)
+		for (auto w : r)
+			mix(w);
+
+	return h;
+}
+
+void GF2_matrix
+::write(std::ostream &stream) const
+{
+	const uint32_t dims[2] = {this->n_rows, this->n_cols};
+
+	stream.write(gf2_matrix_magic, sizeof(gf2_matrix_magic));
+	stream.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+	for (auto &r : this->rows)
+		stream.write(reinterpret_cast<const char*>(r.data()), this->n_words * sizeof(uint64_t));
+}
+
+GF2_matrix GF2_matrix
+::read(std::istream &stream)
+{
+	char magic[sizeof(gf2_matrix_magic)];
+	uint32_t dims[2] = {0, 0};
+
+	stream.read(magic, sizeof(magic));
+	stream.read(reinterpret_cast<char*>(dims), sizeof(dims));
+
+	if (!stream.good() || !std::equal(magic, magic + sizeof(magic), gf2_matrix_magic))
+	{
+		std::stringstream message;
+		message << "The stream does not contain a valid binary GF(2) matrix.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	GF2_matrix mat(dims[0], dims[1]);
+	for (auto &r : mat.rows)
+		stream.read(reinterpret_cast<char*>(r.data()), mat.n_words * sizeof(uint64_t));
+
+	if (!stream.good())
+	{
+		std::stringstream message;
+		message << "The stream is too short to contain the whole GF(2) matrix ('n_rows' = " << dims[0]
+		        << ", 'n_cols' = " << dims[1] << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return mat;
+}
@@ -0,0 +1,112 @@
+/*!
+ * \file
+ * \brief Dense binary matrix packed in 64-bit words with a Gaussian elimination engine over GF(2).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef GF2_MATRIX_HPP_
+#define GF2_MATRIX_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <iostream>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class GF2_matrix
+ *
+ * \brief Dense binary matrix where each row is packed in 64-bit words (bit j of a row is the bit (j % 64) of the word
+ *        (j / 64)).
+ *
+ * The row reductions are processed word by word and the eliminations are delayed and grouped by blocks of pivots in
+ * the spirit of the Method of the Four Russians (M4RI): all the combinations of the pivots of a block are precomputed
+ * in a table and each remaining row is updated with a single table row.
+ */
+class GF2_matrix
+{
+private:
+	static constexpr unsigned block_size = 8; // number of pivots processed at once (the tables have 2^block_size rows)
+
+	unsigned n_rows;
+	unsigned n_cols;
+	unsigned n_words; // number of 64-bit words per row
+
+	std::vector<std::vector<uint64_t>> rows;
+
+public:
+	GF2_matrix(const unsigned n_rows = 0, const unsigned n_cols = 0);
+	virtual ~GF2_matrix();
+
+	unsigned get_n_rows () const;
+	unsigned get_n_cols () const;
+	unsigned get_n_words() const;
+
+	inline bool at(const size_t row_index, const size_t col_index) const
+	{
+		return (this->rows[row_index][col_index >> 6] >> (col_index & 63)) & 1;
+	}
+
+	inline void set(const size_t row_index, const size_t col_index, const bool value = true)
+	{
+		const auto mask = (uint64_t)1 << (col_index & 63);
+		auto &word = this->rows[row_index][col_index >> 6];
+		word = value ? (word | mask) : (word & ~mask);
+	}
+
+	const uint64_t* get_row(const size_t row_index) const;
+
+	void swap_rows(const size_t row_index1, const size_t row_index2);
+	void swap_cols(const size_t col_index1, const size_t col_index2);
+	void erase_row(const size_t row_index);
+
+	/*
+	 * Build a dense matrix from a sparse one (same orientation)
+	 */
+	static GF2_matrix from_sparse(const Sparse_matrix &sparse);
+
+	/*
+	 * Return the sparse version of this matrix
+	 */
+	Sparse_matrix to_sparse() const;
+
+	/*
+	 * Same behavior as the historical LDPC_matrix_handler::create_diagonal (the same rows and columns are swapped and
+	 * the same null rows are removed) but the row reductions are packed and delayed by blocks of pivots.
+	 * The height of the matrix must be smaller than its width.
+	 * swapped_cols is completed each time with couple of positions of the two swapped columns.
+	 */
+	void create_diagonal(std::vector<unsigned>& swapped_cols);
+
+	/*
+	 * Back substitution on a matrix returned by 'create_diagonal': the left square part becomes the identity.
+	 */
+	void create_identity();
+
+	/*
+	 * 64-bit FNV-1a hash of the dimensions and of the content of the matrix
+	 */
+	uint64_t hash() const;
+
+	/*
+	 * Binary (de)serialization of the matrix
+	 */
+	void              write(std::ostream &stream) const;
+	static GF2_matrix read (std::istream &stream);
+
+private:
+	// rows[dst] ^= src from the word 'first_word' ('src' points to the word 'first_word' of the source row)
+	inline void xor_row(const size_t dst, const uint64_t *src, const unsigned first_word);
+
+	// return 'n_bits' (<= 64) consecutive bits of a row starting from the column 'col_index'
+	inline uint64_t get_bits(const size_t row_index, const size_t col_index, const unsigned n_bits) const;
+};
+}
+}
+
+#endif /* GF2_MATRIX_HPP_ */
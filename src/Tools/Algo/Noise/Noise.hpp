@@ -2,6 +2,7 @@
 #define NOISE_HPP_
 
 #include <vector>
+#include <cstdint>
 
 namespace aff3ct
 {
@@ -28,6 +29,12 @@ public:
 	virtual void set_seed(const int seed) = 0;
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0) = 0;
 
+	// move the stream to the sample 'position': only the counter-based generators can jump, the others ignore it and
+	// keep drawing the next samples
+	virtual void set_position(const uint64_t position)
+	{
+	}
+
 };
 }
 }
@@ -0,0 +1,189 @@
+#include <cmath>
+#include <algorithm>
+
+#include "Noise_philox.hpp"
+
+using namespace aff3ct::tools;
+
+template <typename R>
+constexpr unsigned Noise_philox<R>::chunk_size;
+template <typename R>
+constexpr unsigned Noise_philox<R>::n_chunks_per_batch;
+
+template <typename R>
+Noise_philox<R>
+::Noise_philox(const int seed, const int stream)
+: Noise<R>(),
+  seed(seed),
+  stream(stream),
+  philox((uint32_t)seed, (uint32_t)stream),
+  position(0),
+  words(n_chunks_per_batch * chunk_size),
+  uniforms(n_chunks_per_batch * chunk_size),
+  samples(chunk_size)
+{
+}
+
+template <typename R>
+Noise_philox<R>
+::~Noise_philox()
+{
+}
+
+template <typename R>
+void Noise_philox<R>
+::set_seed(const int seed)
+{
+	this->seed = seed;
+	this->philox.seed((uint32_t)this->seed, (uint32_t)this->stream);
+	this->position = 0;
+}
+
+template <typename R>
+void Noise_philox<R>
+::set_stream(const int stream)
+{
+	this->stream = stream;
+	this->philox.seed((uint32_t)this->seed, (uint32_t)this->stream);
+	this->position = 0;
+}
+
+template <typename R>
+void Noise_philox<R>
+::set_position(const uint64_t position)
+{
+	this->position = position;
+}
+
+template <typename R>
+uint64_t Noise_philox<R>
+::get_position() const
+{
+	return this->position;
+}
+
+// uniform number in ]0,1[ from a random 32-bit word: 0 and 1 are never produced, so log(u) is finite in Box-Muller
+// (23 bits + 0.5 are exactly represented in a float, 32 bits + 0.5 in a double)
+template <typename R>
+static inline R philox_uniform(const uint32_t word)
+{
+	return ((R)word + (R)0.5) * (R)(1.0 / 4294967296.0);
+}
+
+template <>
+inline float philox_uniform<float>(const uint32_t word)
+{
+	return ((float)(word >> 9) + 0.5f) * (float)(1.0 / 8388608.0);
+}
+
+template <typename R>
+void Noise_philox<R>
+::box_muller(const unsigned n_chunks, R *noise, const R sigma, const R mu)
+{
+	const auto twopi = (R)(2.0 * 3.14159265358979323846);
+	constexpr auto half = chunk_size / 2;
+
+	for (unsigned c = 0; c < n_chunks; c++)
+	{
+		const auto *u1 = this->uniforms.data() + c * chunk_size;
+		const auto *u2 = u1 + half;
+		auto *n = noise + c * chunk_size;
+
+		for (unsigned i = 0; i < half; i++)
+		{
+			const auto radius = (R)std::sqrt(std::log(u1[i]) * (R)-2.0) * sigma;
+			const auto theta  = u2[i] * twopi;
+
+			n[i       ] = radius * std::cos(theta) + mu;
+			n[i + half] = radius * std::sin(theta) + mu;
+		}
+	}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Noise_philox<float>
+::box_muller(const unsigned n_chunks, float *noise, const float sigma, const float mu)
+{
+	const auto twopi = (float)(2.0 * 3.14159265358979323846);
+	constexpr auto half = chunk_size / 2;
+	static_assert(half % mipp::nElReg<float>() == 0, "The SIMD width has to divide the half of a chunk.");
+
+	for (unsigned c = 0; c < n_chunks; c++)
+	{
+		const auto *u1 = this->uniforms.data() + c * chunk_size;
+		const auto *u2 = u1 + half;
+		auto *n = noise + c * chunk_size;
+
+		for (unsigned i = 0; i < half; i += mipp::nElReg<float>())
+		{
+			const auto radius = mipp::sqrt(mipp::log(mipp::Reg<float>(&u1[i])) * -2.f) * sigma;
+			const auto theta  = mipp::Reg<float>(&u2[i]) * twopi;
+
+			mipp::Reg<float> sintheta, costheta;
+			mipp::sincos(theta, sintheta, costheta);
+
+			(radius * costheta + mu).storeu(&n[i       ]);
+			(radius * sintheta + mu).storeu(&n[i + half]);
+		}
+	}
+}
+}
+}
+
+template <typename R>
+void Noise_philox<R>
+::generate_chunks(const uint64_t first_chunk, const unsigned n_chunks, R *noise, const R sigma, const R mu)
+{
+	constexpr auto blocks_per_chunk = chunk_size / PRNG_philox::n_words;
+
+	this->philox.generate(first_chunk * blocks_per_chunk, n_chunks * blocks_per_chunk, this->words.data());
+
+	for (unsigned i = 0; i < n_chunks * chunk_size; i++)
+		this->uniforms[i] = philox_uniform<R>(this->words[i]);
+
+	this->box_muller(n_chunks, noise, sigma, mu);
+}
+
+template <typename R>
+void Noise_philox<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	unsigned i = 0;
+	while (i < length)
+	{
+		const auto chunk  = this->position / chunk_size;
+		const auto offset = (unsigned)(this->position % chunk_size);
+
+		if (offset == 0 && length - i >= chunk_size)
+		{
+			// whole chunks are directly computed in the output
+			const auto n_chunks = std::min(n_chunks_per_batch, (length - i) / chunk_size);
+			this->generate_chunks(chunk, n_chunks, noise + i, sigma, mu);
+			i              += n_chunks * chunk_size;
+			this->position += n_chunks * chunk_size;
+		}
+		else
+		{
+			// head or tail of the call: only a part of the chunk is kept
+			const auto n_samples = std::min(chunk_size - offset, length - i);
+			this->generate_chunks(chunk, 1, this->samples.data(), sigma, mu);
+			std::copy(this->samples.begin() + offset, this->samples.begin() + offset + n_samples, noise + i);
+			i              += n_samples;
+			this->position += n_samples;
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Noise_philox<R_32>;
+template class aff3ct::tools::Noise_philox<R_64>;
+#else
+template class aff3ct::tools::Noise_philox<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,65 @@
+#ifndef NOISE_PHILOX_HPP_
+#define NOISE_PHILOX_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_philox.hpp"
+
+#include "../Noise.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Noise_philox
+ *
+ * \brief Gaussian noise drawn from the Philox counter-based generator.
+ *
+ * The stream is cut in chunks of 'chunk_size' samples: the chunk 'c' only depends on the Philox blocks
+ * [c * chunk_size / 4, (c +1) * chunk_size / 4) and is computed with the Box-Muller method (the cosines fill the first
+ * half of the chunk and the sines the second half). A sample is then fully defined by (seed, stream, position): the
+ * output does not depend on the size of the calls to 'generate' and the generator can jump anywhere in O(1).
+ */
+template <typename R = float>
+class Noise_philox : public Noise<R>
+{
+public:
+	static constexpr unsigned chunk_size = 32; // the same on all the SIMD instruction sets
+
+private:
+	static constexpr unsigned n_chunks_per_batch = 16;
+
+	int                   seed;
+	int                   stream;
+	tools::PRNG_philox    philox;
+	uint64_t              position; // index of the next sample in the stream
+	std::vector<uint32_t> words;
+	mipp::vector<R>       uniforms;
+	mipp::vector<R>       samples;
+
+public:
+	explicit Noise_philox(const int seed = 0, const int stream = 0);
+	virtual ~Noise_philox();
+
+	virtual void set_seed    (const int seed);
+	        void set_stream  (const int stream);
+	virtual void set_position(const uint64_t position);
+
+	uint64_t get_position() const;
+
+	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+
+private:
+	// compute the chunks [first_chunk, first_chunk + n_chunks) in 'noise' (n_chunks <= n_chunks_per_batch)
+	void generate_chunks(const uint64_t first_chunk, const unsigned n_chunks, R *noise, const R sigma, const R mu);
+
+	// Box-Muller on 'n_chunks' chunks of uniform numbers
+	void box_muller(const unsigned n_chunks, R *noise, const R sigma, const R mu);
+};
+}
+}
+
+#endif /* NOISE_PHILOX_HPP_ */
@@ -0,0 +1,105 @@
+#include <algorithm>
+
+#include "PRNG_philox.hpp"
+
+using namespace aff3ct::tools;
+
+constexpr unsigned PRNG_philox::n_words;
+
+// multipliers and Weyl sequence increments of Philox4x32 (Random123 reference implementation)
+static constexpr uint32_t philox_M0 = 0xD2511F53;
+static constexpr uint32_t philox_M1 = 0xCD9E8D57;
+static constexpr uint32_t philox_W0 = 0x9E3779B9;
+static constexpr uint32_t philox_W1 = 0xBB67AE85;
+static constexpr int      philox_n_rounds = 10;
+
+// number of counters processed side by side in 'generate'
+static constexpr unsigned philox_n_lanes = 16;
+
+static inline void philox_round(uint32_t &c0, uint32_t &c1, uint32_t &c2, uint32_t &c3,
+                                const uint32_t k0, const uint32_t k1)
+{
+	const uint64_t p0 = (uint64_t)philox_M0 * c0;
+	const uint64_t p1 = (uint64_t)philox_M1 * c2;
+
+	const auto n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+	const auto n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+	c1 = (uint32_t)p1;
+	c3 = (uint32_t)p0;
+	c0 = n0;
+	c2 = n2;
+}
+
+PRNG_philox
+::PRNG_philox(const uint32_t seed, const uint32_t stream)
+{
+	this->seed(seed, stream);
+}
+
+PRNG_philox
+::~PRNG_philox()
+{
+}
+
+void PRNG_philox
+::seed(const uint32_t seed, const uint32_t stream)
+{
+	this->key[0] = seed;
+	this->key[1] = stream;
+}
+
+void PRNG_philox
+::block(const uint64_t counter, uint32_t words[4]) const
+{
+	uint32_t c0 = (uint32_t)counter, c1 = (uint32_t)(counter >> 32), c2 = 0, c3 = 0;
+	uint32_t k0 = this->key[0], k1 = this->key[1];
+
+	for (auto r = 0; r < philox_n_rounds; r++)
+	{
+		if (r) { k0 += philox_W0; k1 += philox_W1; }
+		philox_round(c0, c1, c2, c3, k0, k1);
+	}
+
+	words[0] = c0;
+	words[1] = c1;
+	words[2] = c2;
+	words[3] = c3;
+}
+
+void PRNG_philox
+::generate(const uint64_t first_counter, const unsigned n_blocks, uint32_t *words) const
+{
+	uint32_t c0[philox_n_lanes], c1[philox_n_lanes], c2[philox_n_lanes], c3[philox_n_lanes];
+
+	unsigned b = 0;
+	for (; b + philox_n_lanes <= n_blocks; b += philox_n_lanes)
+	{
+		for (unsigned l = 0; l < philox_n_lanes; l++)
+		{
+			const auto counter = first_counter + b + l;
+			c0[l] = (uint32_t)counter;
+			c1[l] = (uint32_t)(counter >> 32);
+			c2[l] = 0;
+			c3[l] = 0;
+		}
+
+		uint32_t k0 = this->key[0], k1 = this->key[1];
+		for (auto r = 0; r < philox_n_rounds; r++)
+		{
+			if (r) { k0 += philox_W0; k1 += philox_W1; }
+			for (unsigned l = 0; l < philox_n_lanes; l++)
+				philox_round(c0[l], c1[l], c2[l], c3[l], k0, k1);
+		}
+
+		for (unsigned l = 0; l < philox_n_lanes; l++)
+		{
+			words[(b + l) * n_words +0] = c0[l];
+			words[(b + l) * n_words +1] = c1[l];
+			words[(b + l) * n_words +2] = c2[l];
+			words[(b + l) * n_words +3] = c3[l];
+		}
+	}
+
+	for (; b < n_blocks; b++)
+		this->block(first_counter + b, words + b * n_words);
+}
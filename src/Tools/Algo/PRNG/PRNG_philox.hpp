@@ -0,0 +1,71 @@
+/*!
+ * \file
+ * \brief The Philox4x32-10 counter-based pseudo-random number generator (PRNG).
+ *
+ * Philox (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11) is a bijection of a 128-bit counter
+ * keyed by a 64-bit key: there is no state to update, the n-th block of a stream is computed directly from n. This
+ * makes the skip-ahead free and the streams independent of the way the work is split between the threads.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+
+#ifndef PRNG_PHILOX_HPP
+#define PRNG_PHILOX_HPP
+
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class PRNG_philox
+ * \brief The Philox4x32-10 counter-based pseudo-random number generator (PRNG).
+ *
+ * The key is made of the seed and of the stream number, the block 'n' of a stream is the encryption of the counter
+ * {n & 0xFFFFFFFF, n >> 32, 0, 0} and contains 4 random 32-bit words.
+ */
+class PRNG_philox
+{
+public:
+	static constexpr unsigned n_words = 4; // number of 32-bit words per block
+
+protected:
+	uint32_t key[2];
+
+public:
+	explicit PRNG_philox(const uint32_t seed = 0, const uint32_t stream = 0);
+	virtual ~PRNG_philox();
+
+	/*!
+	 * \brief Sets the key of the generator.
+	 *
+	 * \param seed:   the first half of the key.
+	 * \param stream: the second half of the key, two streams of the same seed are independent.
+	 */
+	void seed(const uint32_t seed, const uint32_t stream = 0);
+
+	/*!
+	 * \brief Computes the block 'counter' of the stream.
+	 *
+	 * \param counter: the index of the block in the stream.
+	 * \param words:   the 4 random 32-bit words of the block.
+	 */
+	void block(const uint64_t counter, uint32_t words[4]) const;
+
+	/*!
+	 * \brief Computes 'n_blocks' consecutive blocks of the stream (same result than calling 'block' on each counter).
+	 *
+	 * The blocks are processed by groups of independent lanes so that the compiler can vectorize the rounds.
+	 *
+	 * \param first_counter: the index of the first block in the stream.
+	 * \param n_blocks:      the number of blocks.
+	 * \param words:         the 4 * 'n_blocks' random 32-bit words.
+	 */
+	void generate(const uint64_t first_counter, const unsigned n_blocks, uint32_t *words) const;
+};
+}
+}
+
+#endif /* PRNG_PHILOX_HPP */
@@ -2,8 +2,11 @@
 #define LC_SORTER_SIMD_HPP
 
 #include <cmath>
+#include <limits>
 #include <vector>
+#include <cstdint>
 #include <algorithm>
+#include <type_traits>
 #include <mipp.h>
 
 #include "Tools/Math/utils.h"
@@ -18,15 +21,21 @@ template <typename T>
 class LC_sorter_simd
 {
 private:
+	// the indexes are stored in registers of the same size than the values (the masks of the comparisons can be used
+	// to blend them), 64-bit values are sorted with the sequential LC_sorter
+	using I = typename std::conditional<sizeof(T) == 1, int8_t,
+	          typename std::conditional<sizeof(T) == 2, int16_t,
+	          typename std::conditional<sizeof(T) == 4, int32_t, int64_t>::type>::type>::type;
+
 	int               max_elmts;
-	mipp::vector<int> tree_idx;
+	mipp::vector<I>   tree_idx;
+	std::vector<int>  tree_idx_seq;
 	mipp::vector<T>   vals;
 
 public:
 	explicit LC_sorter_simd(const int max_elmts) : max_elmts(max_elmts), vals(2 * max_elmts)
 	{
-		tree_idx.resize(2 * max_elmts -1);
-		std::iota(tree_idx.begin(), tree_idx.begin() + this->max_elmts, 0);
+		this->resize(max_elmts);
 	}
 
 	void partial_sort_abs(const T* values, std::vector<int> &pos, int n_elmts = -1, int K = -1)
@@ -37,18 +46,13 @@ public:
 		auto depth = (int)std::log2(n_elmts);
 
 		if (n_elmts > max_elmts)
-		{
-			max_elmts = n_elmts;
-			tree_idx.resize(2 * max_elmts -1);
-			std::iota(tree_idx.begin(), tree_idx.begin() + this->max_elmts, 0);
-			vals.resize(max_elmts);
-		}
+			this->resize(n_elmts);
 
 		// copy the "values" vector in "vals"
 		for (auto i = 0; i < n_elmts; i++)
 			vals[i] = std::abs(values[i]);
 
-		if (n_elmts >= 2 * mipp::nElReg<T>())
+		if (this->is_simd(n_elmts))
 		{
 			_partial_sort_step1(vals.data(), pos, n_elmts, K, depth);
 
@@ -57,11 +61,11 @@ public:
 		}
 		else
 		{
-			LC_sorter<T>::_partial_sort_step1(vals.data(), pos, n_elmts, K, depth, max_elmts, tree_idx);
+			LC_sorter<T>::_partial_sort_step1(vals.data(), pos, n_elmts, K, depth, max_elmts, tree_idx_seq);
 			if (K == 2)
-				LC_sorter<T>::_partial_sort2_step2(vals.data(), pos, depth, max_elmts, tree_idx);
+				LC_sorter<T>::_partial_sort2_step2(vals.data(), pos, depth, max_elmts, tree_idx_seq);
 			else
-				LC_sorter<T>::_partial_sort_step2(vals.data(), pos, K, depth, max_elmts, tree_idx);
+				LC_sorter<T>::_partial_sort_step2(vals.data(), pos, K, depth, max_elmts, tree_idx_seq);
 		}
 	}
 
@@ -73,14 +77,9 @@ public:
 		auto depth = (int)std::log2(n_elmts);
 
 		if (n_elmts > max_elmts)
-		{
-			max_elmts = n_elmts;
-			tree_idx.resize(2 * max_elmts -1);
-			std::iota(tree_idx.begin(), tree_idx.begin() + this->max_elmts, 0);
-			vals.resize(max_elmts);
-		}
+			this->resize(n_elmts);
 
-		if (n_elmts >= 2 * mipp::nElReg<T>())
+		if (this->is_simd(n_elmts))
 		{
 			// copy the "values" vector in "vals"
 			for (auto i = 0; i < n_elmts; i++)
@@ -93,21 +92,39 @@ public:
 		}
 		else
 		{
-			LC_sorter<T>::_partial_sort_step1(values, pos, n_elmts, K, depth, max_elmts, tree_idx);
+			LC_sorter<T>::_partial_sort_step1(values, pos, n_elmts, K, depth, max_elmts, tree_idx_seq);
 			if (K == 2)
-				LC_sorter<T>::_partial_sort2_step2(values, pos, depth, max_elmts, tree_idx);
+				LC_sorter<T>::_partial_sort2_step2(values, pos, depth, max_elmts, tree_idx_seq);
 			else
 			{
 				// copy the "values" vector in "vals"
 				for (auto i = 0; i < n_elmts; i++)
 					vals[i] = values[i];
 
-				LC_sorter<T>::_partial_sort_step2(vals.data(), pos, K, depth, max_elmts, tree_idx);
+				LC_sorter<T>::_partial_sort_step2(vals.data(), pos, K, depth, max_elmts, tree_idx_seq);
 			}
 		}
 	}
 
 private:
+	void resize(const int n_elmts)
+	{
+		max_elmts = n_elmts;
+		vals.resize(2 * max_elmts);
+		tree_idx    .resize(2 * max_elmts -1);
+		tree_idx_seq.resize(2 * max_elmts -1);
+		for (auto i = 0; i < max_elmts; i++)
+			tree_idx[i] = (I)i;
+		std::iota(tree_idx_seq.begin(), tree_idx_seq.begin() + max_elmts, 0);
+	}
+
+	inline bool is_simd(const int n_elmts) const
+	{
+		return sizeof(T) <= sizeof(int32_t) &&
+		       n_elmts >= 2 * mipp::nElReg<T>() &&
+		       max_elmts -1 <= (int)std::numeric_limits<I>::max();
+	}
+
 	inline void _partial_sort_step1(T* values, std::vector<int> &pos, const int n_elmts, const int K, const int depth)
 	{
 		// sort all the tree (1)
@@ -116,8 +133,8 @@ private:
 		{
 			const auto val0 = mipp::Reg<T  >(&values  [2*j + 0*mipp::nElReg<T>()]); // load
 			const auto val1 = mipp::Reg<T  >(&values  [2*j + 1*mipp::nElReg<T>()]); // load
-			const auto idx0 = mipp::Reg<int>(&tree_idx[2*j + 0*mipp::nElReg<T>()]); // load
-			const auto idx1 = mipp::Reg<int>(&tree_idx[2*j + 1*mipp::nElReg<T>()]); // load
+			const auto idx0 = mipp::Reg<I  >(&tree_idx[2*j + 0*mipp::nElReg<T>()]); // load
+			const auto idx1 = mipp::Reg<I  >(&tree_idx[2*j + 1*mipp::nElReg<T>()]); // load
 
 			const auto min  = mipp::min(val0, val1);
 			const auto idx  = mipp::blend(idx0, idx1, val0 < val1);
@@ -135,8 +152,8 @@ private:
 			{
 				const auto val0 = mipp::Reg<T  >(&values  [offset + 2*j + 0*mipp::nElReg<T>()]); // load
 				const auto val1 = mipp::Reg<T  >(&values  [offset + 2*j + 1*mipp::nElReg<T>()]); // load
-				const auto idx0 = mipp::Reg<int>(&tree_idx[offset + 2*j + 0*mipp::nElReg<T>()]); // load
-				const auto idx1 = mipp::Reg<int>(&tree_idx[offset + 2*j + 1*mipp::nElReg<T>()]); // load
+				const auto idx0 = mipp::Reg<I  >(&tree_idx[offset + 2*j + 0*mipp::nElReg<T>()]); // load
+				const auto idx1 = mipp::Reg<I  >(&tree_idx[offset + 2*j + 1*mipp::nElReg<T>()]); // load
 
 				const auto min   = mipp::min(val0, val1);
 				const auto idx   = mipp::blend(idx0, idx1, val0 < val1);
@@ -149,10 +166,10 @@ private:
 		}
 
 		// sequential part (searching the min pos)
-		auto min_pos = 0;
-		auto min = std::numeric_limits<T>::max();
+		int min_pos = tree_idx[offset];
+		auto min = values[min_pos];
 
-		for (auto i = 0; i < mipp::nElReg<T>(); i++)
+		for (auto i = 1; i < mipp::nElReg<T>(); i++)
 		{
 			min_pos = values[tree_idx[offset +i]] < min ? tree_idx[offset +i] : min_pos;
 			min = std::min(values[tree_idx[offset +i]], min);
@@ -175,8 +192,8 @@ private:
 
 				const auto val0 = mipp::Reg<T  >(&values  [2*j + 0*mipp::nElReg<T>()]); // load
 				const auto val1 = mipp::Reg<T  >(&values  [2*j + 1*mipp::nElReg<T>()]); // load
-				const auto idx0 = mipp::Reg<int>(&tree_idx[2*j + 0*mipp::nElReg<T>()]); // load
-				const auto idx1 = mipp::Reg<int>(&tree_idx[2*j + 1*mipp::nElReg<T>()]); // load
+				const auto idx0 = mipp::Reg<I  >(&tree_idx[2*j + 0*mipp::nElReg<T>()]); // load
+				const auto idx1 = mipp::Reg<I  >(&tree_idx[2*j + 1*mipp::nElReg<T>()]); // load
 
 				const auto min   = mipp::min(val0, val1);
 				const auto idx   = mipp::blend(idx0, idx1, val0 < val1);
@@ -195,8 +212,8 @@ private:
 
 				const auto val0 = mipp::Reg<T  >(&values  [offset + 2*j + 0*mipp::nElReg<T>()]); // load
 				const auto val1 = mipp::Reg<T  >(&values  [offset + 2*j + 1*mipp::nElReg<T>()]); // load
-				const auto idx0 = mipp::Reg<int>(&tree_idx[offset + 2*j + 0*mipp::nElReg<T>()]); // load
-				const auto idx1 = mipp::Reg<int>(&tree_idx[offset + 2*j + 1*mipp::nElReg<T>()]); // load
+				const auto idx0 = mipp::Reg<I  >(&tree_idx[offset + 2*j + 0*mipp::nElReg<T>()]); // load
+				const auto idx1 = mipp::Reg<I  >(&tree_idx[offset + 2*j + 1*mipp::nElReg<T>()]); // load
 
 				const auto min   = mipp::min(val0, val1);
 				const auto idx   = mipp::blend(idx0, idx1, val0 < val1);
@@ -209,10 +226,10 @@ private:
 			}
 
 			// sequential part (searching the min pos)
-			auto min_pos = 0;
-			auto min = std::numeric_limits<T>::max();
+			int min_pos = tree_idx[offset];
+			auto min = values[min_pos];
 
-			for (auto i = 0; i < mipp::nElReg<T>(); i++)
+			for (auto i = 1; i < mipp::nElReg<T>(); i++)
 			{
 				min_pos = values[tree_idx[offset +i]] < min ? tree_idx[offset +i] : min_pos;
 				min = std::min(values[tree_idx[offset +i]], min);
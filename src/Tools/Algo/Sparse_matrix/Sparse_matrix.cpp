@@ -2,6 +2,7 @@
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <limits>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -18,7 +19,8 @@ Sparse_matrix
   cols_max_degree(0     ),
   n_connections  (0     ),
   row_to_cols    (n_rows),
-  col_to_rows    (n_cols)
+  col_to_rows    (n_cols),
+  compressed     (nullptr)
 {
 }
 
@@ -137,6 +139,123 @@ void Sparse_matrix
 	cols_max_degree = std::max(cols_max_degree, (unsigned)this->col_to_rows[col_index].size());
 
 	this->n_connections++;
+
+	this->compressed = nullptr;
+}
+
+void Sparse_matrix
+::add_row_connections(const size_t row_index, const std::vector<unsigned> &col_indexes)
+{
+	if (row_index >= this->n_rows)
+	{
+		std::stringstream message;
+		message << "'row_index' has to be smaller than 'n_rows' ('row_index' = " << row_index
+		        << ", 'n_rows' = " << this->n_rows << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (!this->row_to_cols[row_index].empty())
+	{
+		std::stringstream message;
+		message << "The row has to be empty ('row_index' = " << row_index << ", 'row_to_cols[row_index].size()' = "
+		        << this->row_to_cols[row_index].size() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t i = 0; i < col_indexes.size(); i++)
+	{
+		if (col_indexes[i] >= this->n_cols)
+		{
+			std::stringstream message;
+			message << "'col_indexes[i]' has to be smaller than 'n_cols' ('i' = " << i << ", 'col_indexes[i]' = "
+			        << col_indexes[i] << ", 'n_cols' = " << this->n_cols << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (i > 0 && col_indexes[i] <= col_indexes[i -1])
+		{
+			std::stringstream message;
+			message << "'col_indexes' has to be sorted in ascending order without duplicates ('i' = " << i
+			        << ", 'col_indexes[i -1]' = " << col_indexes[i -1] << ", 'col_indexes[i]' = " << col_indexes[i]
+			        << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->row_to_cols[row_index] = col_indexes;
+	for (auto c : col_indexes)
+	{
+		this->col_to_rows[c].push_back((unsigned)row_index);
+		cols_max_degree = std::max(cols_max_degree, (unsigned)this->col_to_rows[c].size());
+	}
+
+	rows_max_degree = std::max(rows_max_degree, (unsigned)col_indexes.size());
+
+	this->n_connections += (unsigned)col_indexes.size();
+
+	this->compressed = nullptr;
+}
+
+const Sparse_matrix::Compressed& Sparse_matrix
+::get_compressed() const
+{
+	auto c = std::atomic_load(&this->compressed);
+	if (c == nullptr)
+	{
+		// concurrent first calls may build the representation several times but they all produce the same one
+		c = this->compress();
+		std::atomic_store(&this->compressed, c);
+	}
+
+	return *c;
+}
+
+std::shared_ptr<const Sparse_matrix::Compressed> Sparse_matrix
+::compress() const
+{
+	auto c = std::make_shared<Compressed>();
+
+	c->row_ptr.resize(this->n_rows +1);
+	c->row_ptr[0] = 0;
+	for (size_t r = 0; r < this->n_rows; r++)
+		c->row_ptr[r +1] = c->row_ptr[r] + (unsigned)this->row_to_cols[r].size();
+
+	c->col_ptr.resize(this->n_cols +1);
+	c->col_ptr[0] = 0;
+	for (size_t i = 0; i < this->n_cols; i++)
+		c->col_ptr[i +1] = c->col_ptr[i] + (unsigned)this->col_to_rows[i].size();
+
+	c->row_idx.resize(this->n_connections);
+	for (size_t r = 0; r < this->n_rows; r++)
+		std::copy(this->row_to_cols[r].begin(), this->row_to_cols[r].end(), c->row_idx.begin() + c->row_ptr[r]);
+
+	c->col_idx.resize(this->n_connections);
+	for (size_t i = 0; i < this->n_cols; i++)
+		std::copy(this->col_to_rows[i].begin(), this->col_to_rows[i].end(), c->col_idx.begin() + c->col_ptr[i]);
+
+	// the k-th occurrence of a row in the column order is matched with the k-th edge of this row in the row order
+	// (same convention as the historical "transpose" tables of the LDPC BP decoders)
+	c->col_to_row.resize(this->n_connections);
+	c->row_to_col.resize(this->n_connections);
+	std::vector<unsigned> next(c->row_ptr.begin(), c->row_ptr.end() -1);
+	for (unsigned e = 0; e < this->n_connections; e++)
+	{
+		const auto r = c->col_idx[e];
+		const auto p = next[r]++;
+
+		c->col_to_row[e] = p;
+		c->row_to_col[p] = e;
+	}
+
+	c->is_16bit = this->n_rows <= (unsigned)std::numeric_limits<uint16_t>::max() &&
+	              this->n_cols <= (unsigned)std::numeric_limits<uint16_t>::max();
+	if (c->is_16bit)
+	{
+		c->row_idx_16.assign(c->row_idx.begin(), c->row_idx.end());
+		c->col_idx_16.assign(c->col_idx.begin(), c->col_idx.end());
+	}
+
+	return c;
 }
 
 Sparse_matrix Sparse_matrix
@@ -155,6 +274,8 @@ void Sparse_matrix
 	std::swap(this->n_rows,          this->n_cols         );
 	std::swap(this->rows_max_degree, this->cols_max_degree);
 	std::swap(this->row_to_cols,     this->col_to_rows    );
+
+	this->compressed = nullptr;
 }
 
 float Sparse_matrix
@@ -189,4 +310,6 @@ void Sparse_matrix
 	for (size_t i = 0; i < this->col_to_rows.size(); i++)
 		for (size_t j = 0; j < this->col_to_rows[i].size(); j++)
 			this->row_to_cols[this->col_to_rows[i][j]].push_back(i);
+
+	this->compressed = nullptr;
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <cstdint>
 
 namespace aff3ct
 {
@@ -10,6 +12,26 @@ namespace tools
 {
 class Sparse_matrix
 {
+public:
+	/*
+	 * Flat (compressed) representation of the matrix: CSR (rows) + CSC (columns) and the edge permutations between
+	 * the two orderings. In the LDPC decoders, the rows are the variable nodes and the columns are the check nodes.
+	 */
+	struct Compressed
+	{
+		std::vector<unsigned> row_ptr;      // 'n_rows +1' offsets in 'row_idx'
+		std::vector<unsigned> row_idx;      // column indexes of the ones, row by row    ('n_connections' elements)
+		std::vector<unsigned> col_ptr;      // 'n_cols +1' offsets in 'col_idx'
+		std::vector<unsigned> col_idx;      // row    indexes of the ones, column by column ('n_connections' elements)
+		std::vector<unsigned> col_to_row;   // position in the row    order of each edge taken in the column order
+		std::vector<unsigned> row_to_col;   // position in the column order of each edge taken in the row    order
+
+		// 16-bit copies of 'row_idx' and 'col_idx', only filled when 'is_16bit' is true (n_rows and n_cols < 65536)
+		bool                  is_16bit;
+		std::vector<uint16_t> row_idx_16;
+		std::vector<uint16_t> col_idx_16;
+	};
+
 private:
 	unsigned n_rows;
 	unsigned n_cols;
@@ -20,6 +42,9 @@ private:
 	std::vector<std::vector<unsigned>> row_to_cols;
 	std::vector<std::vector<unsigned>> col_to_rows;
 
+	// built on demand and dropped each time the matrix is modified (shared between the copies of the matrix)
+	mutable std::shared_ptr<const Compressed> compressed;
+
 public:
 	Sparse_matrix(const unsigned n_rows = 0, const unsigned n_cols = 1);
 	virtual ~Sparse_matrix();
@@ -42,6 +67,17 @@ public:
 
 	void add_connection(const size_t row_index, const size_t col_index);
 
+	/*
+	 * Add all the connections of an empty row at once, 'col_indexes' have to be sorted in ascending order
+	 * (much faster than 'add_connection' to fill large and dense matrices)
+	 */
+	void add_row_connections(const size_t row_index, const std::vector<unsigned> &col_indexes);
+
+	/*
+	 * Return the flat CSR/CSC representation of the matrix (built at the first call after a modification)
+	 */
+	const Compressed& get_compressed() const;
+
 	/*
 	 * Return the transposed matrix of this matrix
 	 */
@@ -62,6 +98,9 @@ public:
 	 * The "order" parameter can be "ASC" for ascending or "DSC" for descending
 	 */
 	void sort_cols_per_density(std::string order = "DSC");
+
+private:
+	std::shared_ptr<const Compressed> compress() const;
 };
 }
 }
@@ -1,7 +1,13 @@
 #include <functional>
 #include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <cstdio>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+#include "Tools/Math/bits.h"
 
 #include "LDPC_matrix_handler.hpp"
 
@@ -23,58 +29,105 @@ Sparse_matrix LDPC_matrix_handler
 {
 	Sparse_matrix sparse((unsigned)full.size(), (unsigned)full.front().size());
 
+	std::vector<unsigned> cols;
 	for (unsigned i = 0; i < full.size(); i++)
+	{
+		cols.clear();
 		for (unsigned j = 0; j < full[i].size(); j++)
 			if (full[i][j])
-				sparse.add_connection(i,j);
+				cols.push_back(j);
+		sparse.add_row_connections(i, cols);
+	}
 
 	return sparse;
 }
 
-Sparse_matrix LDPC_matrix_handler
-::transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos)
+GF2_matrix LDPC_matrix_handler
+::full_to_GF2(const Full_matrix& full)
 {
-	LDPC_matrix_handler::Full_matrix mat;
+	GF2_matrix mat((unsigned)full.size(), full.empty() ? 0 : (unsigned)full.front().size());
 
-	if (H.get_n_rows() > H.get_n_cols())
-		LDPC_matrix_handler::sparse_to_full(H.transpose(), mat);
-	else
-		LDPC_matrix_handler::sparse_to_full(H, mat);
-
-	LDPC_matrix_handler::transform_H_to_G(mat, info_bits_pos);
+	for (unsigned i = 0; i < mat.get_n_rows(); i++)
+		for (unsigned j = 0; j < mat.get_n_cols(); j++)
+			if (full[i][j])
+				mat.set(i, j);
 
-	return LDPC_matrix_handler::full_to_sparse(mat);
+	return mat;
 }
 
 void LDPC_matrix_handler
-::transform_H_to_G(Full_matrix& mat, std::vector<unsigned>& info_bits_pos)
+::GF2_to_full(const GF2_matrix& mat, Full_matrix& full)
 {
-	unsigned n_row = (unsigned)mat.size();
-	unsigned n_col = (unsigned)mat.front().size();
+	full.clear();
+	full.resize(mat.get_n_rows(), std::vector<bool>(mat.get_n_cols(), 0));
+
+	for (unsigned i = 0; i < mat.get_n_rows(); i++)
+		for (unsigned j = 0; j < mat.get_n_cols(); j++)
+			full[i][j] = mat.at(i, j);
+}
 
-	if (n_row > n_col)
+Sparse_matrix LDPC_matrix_handler
+::transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos, const std::string& G_cache_dir)
+{
+	auto mat = GF2_matrix::from_sparse((H.get_n_rows() > H.get_n_cols()) ? H.transpose() : H);
+
+	std::string cache_path;
+	if (!G_cache_dir.empty())
 	{
-		std::stringstream message;
-		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << n_row
-		        << ", 'n_col' = " << n_col << ").";
-		throw length_error(__FILE__, __LINE__, __func__, message.str());
+		std::stringstream path;
+		path << G_cache_dir << "/G_" << std::hex << std::setw(16) << std::setfill('0') << mat.hash() << ".bin";
+		cache_path = path.str();
 	}
 
 	std::vector<unsigned> swapped_cols;
-	LDPC_matrix_handler::create_diagonal(mat, swapped_cols);
-	LDPC_matrix_handler::create_identity(mat);
+	if (cache_path.empty() || !LDPC_matrix_handler::read_G_cache(cache_path, mat, swapped_cols))
+	{
+		mat.create_diagonal(swapped_cols);
+		mat.create_identity();
 
-	for (unsigned i = 0; i < n_row; i++) // erase the just created identity in the left part of H
-		mat[i].erase( mat[i].begin(), mat[i].begin() + n_row );
+		if (!cache_path.empty())
+			LDPC_matrix_handler::write_G_cache(cache_path, mat, swapped_cols);
+	}
 
-	// mat dimension is now n_col*n_row (above it was n_row*n_col)
-	mat.resize(n_col, std::vector<bool>(n_col - n_row, 0));
-	for (unsigned i = n_row; i < n_col; i++) // Add identity at the end
-		mat[i][i-n_row] = 1;
+	return LDPC_matrix_handler::reduced_H_to_G(mat, swapped_cols, info_bits_pos);
+}
 
-	// Re-organization: get G
+Sparse_matrix LDPC_matrix_handler
+::reduced_H_to_G(const GF2_matrix& mat, const std::vector<unsigned>& swapped_cols,
+                 std::vector<unsigned>& info_bits_pos)
+{
+	const unsigned n_row = mat.get_n_rows();
+	const unsigned n_col = mat.get_n_cols();
+
+	// the left part of mat is the identity, G is made of its right part with an identity at the end, then the rows
+	// of G are reorganized following the columns swaps: rows_pos[i] gives the row (before reorganization) of the i-th
+	// row of G
+	std::vector<unsigned> rows_pos(n_col);
+	std::iota(rows_pos.begin(), rows_pos.end(), 0);
 	for (unsigned l = (unsigned)(swapped_cols.size() / 2); l > 0; l--)
-		std::swap(mat[swapped_cols[l*2-2]], mat[swapped_cols[l*2-1]]);
+		std::swap(rows_pos[swapped_cols[l*2-2]], rows_pos[swapped_cols[l*2-1]]);
+
+	Sparse_matrix G(n_col, n_col - n_row);
+	std::vector<unsigned> cols;
+	for (unsigned i = 0; i < n_col; i++)
+	{
+		cols.clear();
+		if (rows_pos[i] < n_row)
+		{
+			const auto *row = mat.get_row(rows_pos[i]);
+			for (unsigned w = n_row / 64; w < mat.get_n_words(); w++)
+				for (auto word = row[w]; word; word &= word -1)
+				{
+					const auto j = w * 64 + tools::ctz(word);
+					if (j >= n_row)
+						cols.push_back(j - n_row);
+				}
+		}
+		else
+			cols.push_back(rows_pos[i] - n_row);
+
+		G.add_row_connections(i, cols);
+	}
 
 	// return info bits positions
 	info_bits_pos.resize(n_col - n_row);
@@ -86,92 +139,85 @@ void LDPC_matrix_handler
 		std::swap(bits_pos[swapped_cols[l*2-2]], bits_pos[swapped_cols[l*2-1]]);
 
 	std::copy(bits_pos.begin() + n_row, bits_pos.end(), info_bits_pos.begin());
+
+	return G;
 }
 
-void LDPC_matrix_handler
-::create_diagonal(Full_matrix& mat, std::vector<unsigned>& swapped_cols)
+bool LDPC_matrix_handler
+::read_G_cache(const std::string& path, GF2_matrix& mat, std::vector<unsigned>& swapped_cols)
 {
-	unsigned n_row = (unsigned)mat.size();
-	unsigned n_col = (unsigned)mat.front().size();
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
 
-	if (n_row > n_col)
+	try
 	{
-		std::stringstream message;
-		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << n_row
-		        << ", 'n_col' = " << n_col << ").";
-		throw length_error(__FILE__, __LINE__, __func__, message.str());
-	}
+		auto reduced = GF2_matrix::read(file);
 
-	unsigned i = 0;
-	bool found = false;
+		uint32_t n_swapped = 0;
+		file.read(reinterpret_cast<char*>(&n_swapped), sizeof(n_swapped));
+		std::vector<uint32_t> swapped(n_swapped);
+		file.read(reinterpret_cast<char*>(swapped.data()), n_swapped * sizeof(uint32_t));
 
-	while (i < n_row)
-	{
-		if (mat[i][i])
-		{
-			for (unsigned j = i +1; j < n_row; j++)
- 				if( mat[j][i] )
-					std::transform(mat[j].begin(), mat[j].end(), mat[i].begin(), mat[j].begin(), std::not_equal_to<int8_t>());
-		}
-		else
-		{
-			for (unsigned j = i +1; j < n_row; j++) // find an other row which is good
-				if (mat[j][i])
-				{
-					std::swap(mat[i], mat[j]);
-					i--;
-					found = true;
-					break;
-				}
+		if (!file.good() || reduced.get_n_cols() != mat.get_n_cols() || reduced.get_n_rows() > mat.get_n_rows())
+			return false;
 
-			if (!found) // if does not fund
-				for (unsigned j = i +1; j < n_col; j++) // find an other column which is good
-					if (mat[i][j])
-					{
-						swapped_cols.push_back(i);
-						swapped_cols.push_back(j);
-
-						// swap the columns
-						std::vector<int8_t> column_save(n_row);
-						for (unsigned l = 0; l < n_row; l++) column_save[l] = (mat[l][i]);
-						for (unsigned l = 0; l < n_row; l++) mat[l][i] = mat[l][j];
-						for (unsigned l = 0; l < n_row; l++) mat[l][j] = column_save[l];
-
-						i--;
-						found = true;
-						break;
-					}
-
-			if (!found) // if does not fund again this mean that the row is the null vector
-			{
-				mat.erase(mat.begin() +i);
-				i--;
-				n_row--;
-			}
-			found = false;
-		}
-		i++;
+		for (auto c : swapped)
+			if (c >= reduced.get_n_cols())
+				return false;
+
+		mat = std::move(reduced);
+		swapped_cols.assign(swapped.begin(), swapped.end());
+	}
+	catch (runtime_error const&)
+	{
+		return false;
 	}
+
+	return true;
 }
 
 void LDPC_matrix_handler
-::create_identity(Full_matrix& mat)
+::write_G_cache(const std::string& path, const GF2_matrix& mat, const std::vector<unsigned>& swapped_cols)
 {
-	unsigned n_row = (unsigned)mat.size();
-	unsigned n_col = (unsigned)mat.front().size();
+	// write in a temporary file first: several threads or processes can build the same G at the same time
+	std::stringstream tmp_path;
+	tmp_path << path << ".tmp" << std::hex << std::random_device()();
 
-	if (n_row > n_col)
+	std::ofstream file(tmp_path.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (file.is_open())
 	{
-		std::stringstream message;
-		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << n_row
-		        << ", 'n_col' = " << n_col << ").";
-		throw length_error(__FILE__, __LINE__, __func__, message.str());
+		mat.write(file);
+
+		const std::vector<uint32_t> swapped(swapped_cols.begin(), swapped_cols.end());
+		const auto n_swapped = (uint32_t)swapped.size();
+		file.write(reinterpret_cast<const char*>(&n_swapped), sizeof(n_swapped));
+		file.write(reinterpret_cast<const char*>(swapped.data()), n_swapped * sizeof(uint32_t));
+		file.close();
+
+		if (!file.fail() && std::rename(tmp_path.str().c_str(), path.c_str()) == 0)
+			return;
+
+		std::remove(tmp_path.str().c_str());
 	}
 
-	for (unsigned i = n_row - 1 ; i > 0; i--)
-		for (unsigned j = i; j > 0; j--)
-			if (mat[j-1][i])
-				std::transform (mat[j-1].begin(), mat[j-1].end(), mat[i].begin(), mat[j-1].begin(), std::not_equal_to<int8_t>());
+	std::clog << format_warning("The G matrix could not be cached in \"" + path + "\".") << std::endl;
+}
+
+void LDPC_matrix_handler
+::create_diagonal(Full_matrix& mat, std::vector<unsigned>& swapped_cols)
+{
+	auto packed = LDPC_matrix_handler::full_to_GF2(mat);
+	packed.create_diagonal(swapped_cols);
+	LDPC_matrix_handler::GF2_to_full(packed, mat);
+}
+
+void LDPC_matrix_handler
+::create_identity(Full_matrix& mat)
+{
+	auto packed = LDPC_matrix_handler::full_to_GF2(mat);
+	packed.create_identity();
+	LDPC_matrix_handler::GF2_to_full(packed, mat);
 }
 
 float LDPC_matrix_handler
@@ -259,97 +305,37 @@ LDPC_matrix_handler::QCFull_matrix LDPC_matrix_handler
 	else
 		H = _H;
 
-	unsigned M = H.get_n_rows();
-	unsigned N = H.get_n_cols();
-	unsigned K = N - M;
-
-	QCFull_matrix MatriceCalcul;
-	MatriceCalcul.clear();
-	MatriceCalcul.resize(M, mipp::vector<int8_t>(2 * M, 0));
+	const unsigned M = H.get_n_rows();
+	const unsigned N = H.get_n_cols();
+	const unsigned K = N - M;
 
-	//Copy H2 on left
+	// Gauss-Jordan elimination on [H2 | I] gives [I | inv(H2)]
+	GF2_matrix mat(M, 2 * M);
 	for (unsigned i = 0; i < M; i++)
-		for (unsigned j = 0; j < H.get_cols_from_row(i).size(); j++)
-			if (H.get_cols_from_row(i)[j] >= K)
-				MatriceCalcul[i][H.get_cols_from_row(i)[j] - K] = 1;
-
-	//Create identity on right
-	for (unsigned i = 0; i < M; i++)
-			MatriceCalcul[i][M + i] = 1;
-
-	//Pivot de Gauss (Forward)
-	for (unsigned indLgn = 0; indLgn < M; indLgn++)
 	{
-		if (MatriceCalcul[indLgn][indLgn] == 0)
-		{
-			unsigned indLgnSwap = 0;
-			for (unsigned indLgn2 = indLgn + 1; indLgn2 < M; indLgn2++)
-			{
-				if (MatriceCalcul[indLgn2][indLgn] != 0)
-				{
-					indLgnSwap = indLgn2;
-					break;
-				}
-			}
-			if (indLgnSwap == 0)
-			{
-				std::stringstream message;
-				message << "Matrix H2 (H = [H1 H2]) is not invertible";
-				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-			std::swap(MatriceCalcul[indLgn], MatriceCalcul[indLgnSwap]);
-		}
-
-		//XOR des lignes
-		for (unsigned indLgn2 = indLgn + 1; indLgn2 < M; indLgn2++)
-		{
-			if (MatriceCalcul[indLgn2][indLgn] != 0)
-			{
-				const auto loop_size1 = (unsigned)(2 * M / mipp::nElReg<int8_t>());
-				for (unsigned i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<int8_t>(&MatriceCalcul[indLgn][i * mipp::nElReg<int8_t>()]);
-					const auto rLgn2 = mipp::Reg<int8_t>(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-				}
-				for (unsigned i = loop_size1 * mipp::nElReg<int8_t>(); i < 2 * M; i++)
-					MatriceCalcul[indLgn2][i] = MatriceCalcul[indLgn2][i] ^ MatriceCalcul[indLgn][i];
-			}
-		}
+		for (auto j : H.get_cols_from_row(i))
+			if (j >= K)
+				mat.set(i, j - K);
+		mat.set(i, M + i);
 	}
 
-	//Pivot de Gauss (Backward)
-	for (unsigned indLgn = M - 1; indLgn > 0; indLgn--)
+	std::vector<unsigned> swapped_cols;
+	mat.create_diagonal(swapped_cols);
+
+	// a column swap or a removed row means that there is no pivot for one of the columns of H2
+	if (!swapped_cols.empty() || mat.get_n_rows() != M)
 	{
-		//XOR des lignes
-		for (unsigned indLgn2 = indLgn - 1; indLgn2 > 0; indLgn2--)
-		{
-			if (MatriceCalcul[indLgn2][indLgn] != 0)
-			{
-				const auto loop_size1 = (unsigned)(2 * M / mipp::nElReg<int8_t>());
-				for (unsigned i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<int8_t>(&MatriceCalcul[indLgn][i * mipp::nElReg<int8_t>()]);
-					const auto rLgn2 = mipp::Reg<int8_t>(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&MatriceCalcul[indLgn2][i * mipp::nElReg<int8_t>()]);
-				}
-				for (unsigned i = loop_size1 * mipp::nElReg<int8_t>(); i < 2 * M; i++)
-					MatriceCalcul[indLgn2][i] = MatriceCalcul[indLgn2][i] ^ MatriceCalcul[indLgn][i];
-			}
-		}
+		std::stringstream message;
+		message << "Matrix H2 (H = [H1 H2]) is not invertible";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	QCFull_matrix invH2;
-	invH2.clear();
-	invH2.resize(M, mipp::vector<int8_t>(M, 0));
+	mat.create_identity();
 
+	QCFull_matrix invH2(M, mipp::vector<int8_t>(M, 0));
 	for (unsigned i = 0; i < M; i++)
 		for (unsigned j = 0; j < M; j++)
-			invH2[i][j] = MatriceCalcul[i][M + j];
-
-	MatriceCalcul.clear();
+			invH2[i][j] = (int8_t)mat.at(i, M + j);
 
 	return invH2;
 }
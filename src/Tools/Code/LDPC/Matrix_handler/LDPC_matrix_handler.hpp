@@ -2,11 +2,13 @@
 #define LDPC_MATRIX_HANDLER_HPP_
 
 #include <vector>
+#include <string>
 #include <algorithm>
 #include <numeric>
 #include <mipp.h>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/GF2_matrix/GF2_matrix.hpp"
 
 namespace aff3ct
 {
@@ -52,8 +54,11 @@ public:
 	 * Compute a G matrix related to the given H matrix.
 	 * Warning G is transposed !
 	 * Return also the information bits positions in the returned G matrix.
+	 * If G_cache_dir is not empty, the result of the Gaussian elimination is read from/written in this directory
+	 * (the cached files are identified by a hash of H).
 	 */
-	static Sparse_matrix transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos);
+	static Sparse_matrix transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos,
+	                                      const std::string& G_cache_dir = "");
 
 	/*
 	 * integrate an interleaver inside the matrix to avoid this step.
@@ -77,7 +82,18 @@ public:
 	static QCFull_matrix invert_H2(const Sparse_matrix& H);
 
 protected :
-	static void transform_H_to_G(Full_matrix& mat, std::vector<unsigned>& info_bits_pos);
+	/*
+	 * Build G (transposed) and the information bits positions from the result of 'create_diagonal' and
+	 * 'create_identity' applied on H
+	 */
+	static Sparse_matrix reduced_H_to_G(const GF2_matrix& mat, const std::vector<unsigned>& swapped_cols,
+	                                    std::vector<unsigned>& info_bits_pos);
+
+	static bool read_G_cache (const std::string& path,       GF2_matrix& mat,       std::vector<unsigned>& swapped_cols);
+	static void write_G_cache(const std::string& path, const GF2_matrix& mat, const std::vector<unsigned>& swapped_cols);
+
+	static GF2_matrix full_to_GF2(const Full_matrix& full);
+	static void       GF2_to_full(const GF2_matrix& mat, Full_matrix& full);
 };
 }
 }
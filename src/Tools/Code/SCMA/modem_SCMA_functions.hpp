@@ -2,6 +2,7 @@
 #define MODEM_SCMA_FUNCTIONS_HPP
 
 #include <complex>
+#include <mipp.h>
 
 #ifndef _MSC_VER
 #ifndef __forceinline
@@ -17,6 +18,10 @@ namespace tools
 template <typename R>
 using proto_psi = R (*)(const std::complex<R>& d, const R& n0);
 
+// logarithm of a psi function on registers, 'd2' is the squared norm of the distance
+template <typename R>
+using proto_log_psi_i = mipp::Reg<R> (*)(const mipp::Reg<R> d2, const mipp::Reg<R> n0);
+
 // ------------------------------------------------------------------------------------------- special function headers
 
 template <typename R>
@@ -31,6 +36,18 @@ __forceinline R psi_2(const std::complex<R>& d, const R& n0);
 template <typename R>
 __forceinline R psi_3(const std::complex<R>& d, const R& n0);
 
+template <typename R>
+__forceinline mipp::Reg<R> log_psi_0_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0);
+
+template <typename R>
+__forceinline mipp::Reg<R> log_psi_1_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0);
+
+template <typename R>
+__forceinline mipp::Reg<R> log_psi_2_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0);
+
+template <typename R>
+__forceinline mipp::Reg<R> log_psi_3_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0);
+
 }
 }
 
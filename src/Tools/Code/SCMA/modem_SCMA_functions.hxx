@@ -29,5 +29,29 @@ inline R psi_3(const std::complex<R>& d, const R& n0)
 {
 	return (R)((R)1 / (4 * std::pow(std::norm(d),2) + n0));
 }
+
+template <typename R>
+inline mipp::Reg<R> log_psi_0_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0)
+{
+	return mipp::Reg<R>((R)0) - d2 / n0;
+}
+
+template <typename R>
+inline mipp::Reg<R> log_psi_1_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0)
+{
+	return mipp::Reg<R>((R)0) - mipp::log(d2 + n0);
+}
+
+template <typename R>
+inline mipp::Reg<R> log_psi_2_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0)
+{
+	return mipp::Reg<R>((R)0) - mipp::log(mipp::Reg<R>((R)8) * d2 * d2 + n0);
+}
+
+template <typename R>
+inline mipp::Reg<R> log_psi_3_i(const mipp::Reg<R> d2, const mipp::Reg<R> n0)
+{
+	return mipp::Reg<R>((R)0) - mipp::log(mipp::Reg<R>((R)4) * d2 * d2 + n0);
+}
 }
 }
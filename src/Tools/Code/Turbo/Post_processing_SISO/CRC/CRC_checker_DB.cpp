@@ -9,7 +9,8 @@ template <typename B, typename R>
 CRC_checker_DB<B,R>
 ::CRC_checker_DB(module::CRC<B> &crc, const int start_crc_check_ite, const int simd_inter_frame_level)
 : CRC_checker<B,R>(crc, start_crc_check_ite, simd_inter_frame_level),
-  apost           (2 * (crc.get_K() + crc.get_size()) * simd_inter_frame_level)
+  apost           (2 * (crc.get_K() + crc.get_size()) * simd_inter_frame_level),
+  s_nat           (simd_inter_frame_level > 1 ? (crc.get_K() + crc.get_size()) * simd_inter_frame_level : 0)
 {
 }
 
@@ -31,14 +32,34 @@ bool CRC_checker_DB<B,R>
 		for (auto i = 0; i < (int)apost.size(); i++)
 			apost[i] = sys[i] + ext[i];
 
-		// compute the hard decision (for the CRC)
-		const auto loop_size = (int)s.size();
-		for (auto i = 0; i < loop_size; i+=2)
+		const auto n_frames = this->simd_inter_frame_level;
+		if (n_frames == 1)
 		{
-			s[i  ] = (std::max(apost[2*i+2], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+1])) > 0;
-			s[i+1] = (std::max(apost[2*i+1], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+2])) > 0;
+			// compute the hard decision (for the CRC)
+			const auto loop_size = (int)s.size();
+			for (auto i = 0; i < loop_size; i+=2)
+			{
+				s[i  ] = (std::max(apost[2*i+2], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+1])) > 0;
+				s[i+1] = (std::max(apost[2*i+1], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+2])) > 0;
+			}
+			return this->crc.check(s, n_frames);
+		}
+		else
+		{
+			// the frames are interleaved (element i of the frame f is at i * n_frames + f): compute the hard decision
+			// in the decoder layout (the decoder reorders 's' itself) and check the CRC on the natural frames
+			const auto K = (int)s.size() / n_frames;
+			for (auto i = 0; i < K; i+=2)
+				for (auto f = 0; f < n_frames; f++)
+				{
+					const auto a0 = apost[(2*i+0) * n_frames +f], a1 = apost[(2*i+1) * n_frames +f];
+					const auto a2 = apost[(2*i+2) * n_frames +f], a3 = apost[(2*i+3) * n_frames +f];
+
+					s[(i+0) * n_frames +f] = s_nat[f * K + i +0] = (std::max(a2, a3) - std::max(a0, a1)) > 0;
+					s[(i+1) * n_frames +f] = s_nat[f * K + i +1] = (std::max(a1, a3) - std::max(a0, a2)) > 0;
+				}
+			return this->crc.check(s_nat, n_frames);
 		}
-		return this->crc.check(s, this->simd_inter_frame_level);
 	}
 
 	return false;
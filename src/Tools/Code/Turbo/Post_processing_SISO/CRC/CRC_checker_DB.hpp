@@ -14,6 +14,7 @@ class CRC_checker_DB : public CRC_checker<B,R>
 {
 protected:
 	std::vector<R> apost;
+	std::vector<B> s_nat; // hard decisions in the natural frame order (only used with inter frame SIMD)
 
 public:
 	CRC_checker_DB(module::CRC<B> &crc, const int start_crc_check_ite = 2, const int simd_inter_frame_level = 1);
@@ -0,0 +1,211 @@
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+
+#include "Checkpoint_BFER.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static const std::string checkpoint_magic = "AFF3CT_BFER_CHECKPOINT_1";
+
+// the SNR points are written with 4 decimals
+static inline bool same_snr(const float snr1, const float snr2)
+{
+	return std::abs(snr1 - snr2) < 5e-4f;
+}
+
+template <typename B>
+Checkpoint_BFER<B>
+::Checkpoint_BFER(const std::string &path, const uint64_t params_hash, const module::Monitor_BFER<B> &monitor,
+                  const bool writer)
+: path(path),
+  params_hash(params_hash),
+  monitor(monitor),
+  writer(writer),
+  run(0),
+  stop_chkpt(false)
+{
+	if (path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'path' can't be empty.");
+}
+
+template <typename B>
+Checkpoint_BFER<B>
+::~Checkpoint_BFER()
+{
+	stop_periodic_save();
+}
+
+template <typename B>
+void Checkpoint_BFER<B>
+::load()
+{
+	std::ifstream file(this->path);
+	if (!file.is_open())
+		return;
+
+	std::string magic;
+	uint64_t hash = 0;
+	std::string key_hash, key_run;
+	unsigned prev_run = 0;
+
+	file >> magic >> key_hash >> std::hex >> hash >> std::dec >> key_run >> prev_run;
+	if (file.fail() || magic != checkpoint_magic || key_hash != "hash" || key_run != "run")
+	{
+		std::stringstream message;
+		message << "The file is not a valid BFER checkpoint ('path' = " << this->path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (hash != this->params_hash)
+	{
+		std::stringstream message;
+		message << "The checkpoint has been written by a simulation with other parameters ('path' = " << this->path
+		        << ", 'hash' = " << std::hex << hash << ", expected 'hash' = " << this->params_hash << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->points.clear();
+	Point p;
+	while (file >> p.snr >> p.n_fra >> p.n_fe >> p.n_be)
+		this->points.push_back(p);
+
+	this->run = prev_run +1;
+}
+
+template <typename B>
+unsigned Checkpoint_BFER<B>
+::get_run() const
+{
+	return this->run;
+}
+
+template <typename B>
+bool Checkpoint_BFER<B>
+::find(const float snr, Point &point) const
+{
+	for (auto &p : this->points)
+		if (same_snr(p.snr, snr))
+		{
+			point = p;
+			return true;
+		}
+
+	return false;
+}
+
+template <typename B>
+void Checkpoint_BFER<B>
+::save(const float snr)
+{
+	std::lock_guard<std::mutex> lock(this->mutex_chkpt);
+
+	Point cur = {snr, this->monitor.get_n_analyzed_fra(), this->monitor.get_n_fe(), this->monitor.get_n_be()};
+
+	auto found = false;
+	for (auto &p : this->points)
+		if (same_snr(p.snr, snr))
+		{
+			p = cur;
+			found = true;
+		}
+	if (!found)
+		this->points.push_back(cur);
+
+	if (!this->writer)
+		return;
+
+	const auto tmp_path = this->path + ".tmp";
+	std::ofstream file(tmp_path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to write the checkpoint ('path' = " << tmp_path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file << checkpoint_magic << std::endl;
+	file << "hash " << std::hex << this->params_hash << std::dec << std::endl;
+	file << "run "  << this->run << std::endl;
+	for (auto &p : this->points)
+		file << std::fixed << std::setprecision(4) << p.snr << " " << p.n_fra << " " << p.n_fe << " " << p.n_be
+		     << std::endl;
+	file.close();
+
+	if (std::rename(tmp_path.c_str(), this->path.c_str()))
+	{
+		std::stringstream message;
+		message << "Impossible to rename the checkpoint ('tmp_path' = " << tmp_path << ", 'path' = " << this->path
+		        << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B>
+void Checkpoint_BFER<B>
+::start_periodic_save(const float snr, const std::chrono::seconds freq)
+{
+	this->stop_periodic_save();
+
+	// launch a thread dedicated to the checkpoints
+	chkpt_thread = std::thread(Checkpoint_BFER<B>::start_thread_checkpoint, this, snr, freq);
+}
+
+template <typename B>
+void Checkpoint_BFER<B>
+::stop_periodic_save()
+{
+	if (chkpt_thread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_chkpt);
+			stop_chkpt = true;
+		}
+		cond_chkpt.notify_all();
+		chkpt_thread.join();
+		stop_chkpt = false;
+	}
+}
+
+template <typename B>
+void Checkpoint_BFER<B>
+::start_thread_checkpoint(Checkpoint_BFER<B> *chkpt, const float snr, const std::chrono::seconds freq)
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(chkpt->mutex_chkpt);
+			if (chkpt->cond_chkpt.wait_for(lock, freq, [chkpt]() { return chkpt->stop_chkpt; }))
+				return;
+		}
+
+		try
+		{
+			chkpt->save(snr);
+		}
+		catch (std::exception const& e)
+		{
+			// a failed checkpoint should not kill a simulation of several days, the next one may succeed
+			std::cerr << tools::apply_on_each_line(e.what(), &tools::format_warning) << std::endl;
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation 
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Checkpoint_BFER<B_8>;
+template class aff3ct::tools::Checkpoint_BFER<B_16>;
+template class aff3ct::tools::Checkpoint_BFER<B_32>;
+template class aff3ct::tools::Checkpoint_BFER<B_64>;
+#else
+template class aff3ct::tools::Checkpoint_BFER<B>;
+#endif
+// ==================================================================================== explicit template instantiation
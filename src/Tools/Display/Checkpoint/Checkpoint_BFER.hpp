@@ -0,0 +1,92 @@
+#ifndef CHECKPOINT_BFER_HPP_
+#define CHECKPOINT_BFER_HPP_
+
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <condition_variable>
+
+#include "Module/Monitor/BFER/Monitor_BFER.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Checkpoint_BFER
+ *
+ * \brief Saves the counters of the BFER simulation in a small text file to resume it after a crash or a pre-emption.
+ *
+ * The file contains the hash of the simulation parameters, the number of runs which contributed to the counters and
+ * one line per SNR point (n_fra, n_fe, n_be). It is written in a temporary file and then renamed, so a killed process
+ * can not leave a truncated checkpoint.
+ */
+template <typename B = int>
+class Checkpoint_BFER
+{
+public:
+	struct Point
+	{
+		float              snr;
+		unsigned long long n_fra;
+		unsigned long long n_fe;
+		unsigned long long n_be;
+	};
+
+private:
+	const std::string              path;
+	const uint64_t                 params_hash;
+	const module::Monitor_BFER<B> &monitor;
+	const bool                     writer; // only one process writes the file (the MPI rank 0)
+	      unsigned                 run;    // number of runs which already contributed to the counters
+	      std::vector<Point>       points;
+
+	std::thread             chkpt_thread;
+	std::mutex              mutex_chkpt;
+	std::condition_variable cond_chkpt;
+	bool                    stop_chkpt;
+
+public:
+	Checkpoint_BFER(const std::string &path, const uint64_t params_hash, const module::Monitor_BFER<B> &monitor,
+	                const bool writer = true);
+	virtual ~Checkpoint_BFER();
+
+	/*!
+	 * \brief Reads the checkpoint file (nothing is done if it does not exist).
+	 *
+	 * Throws if the file has been written by a simulation with other parameters. After the load, 'get_run' gives the
+	 * number of the current run (0 for a new simulation).
+	 */
+	void load();
+
+	unsigned get_run() const;
+
+	/*!
+	 * \brief Gives the counters of a previous run for the SNR 'snr'.
+	 *
+	 * \return false if the SNR point has never been simulated.
+	 */
+	bool find(const float snr, Point &point) const;
+
+	/*!
+	 * \brief Updates the point 'snr' from the monitor and writes the file.
+	 */
+	void save(const float snr);
+
+	/*!
+	 * \brief Saves the point 'snr' every 'freq' in a dedicated thread until 'stop_periodic_save' is called.
+	 */
+	void start_periodic_save(const float snr, const std::chrono::seconds freq);
+
+	void stop_periodic_save();
+
+private:
+	static void start_thread_checkpoint(Checkpoint_BFER<B> *chkpt, const float snr, const std::chrono::seconds freq);
+};
+}
+}
+
+#endif /* CHECKPOINT_BFER_HPP_ */
@@ -2,6 +2,7 @@
 #include <iomanip>
 
 #include "Tools/Display/bash_tools.h"
+#include "Tools/Perf/Perf_counters/Perf_counters.hpp"
 
 #include "Statistics.hpp"
 
@@ -184,6 +185,149 @@ void Statistics
 	       << std::endl;
 }
 
+void Statistics
+::show_counters_line(const std::string           &module_sname,
+                     const std::string           &task_name,
+                     const std::string           &timer_name,
+                     const size_t                 n_elmts,
+                     const size_t                 n_frames,
+                     const uint32_t               n_calls,
+                     const std::vector<uint64_t> &counters,
+                           std::ostream          &stream)
+{
+	if (n_calls == 0 || counters.empty())
+		return;
+
+	const auto &events = Perf_counters::get_events();
+	const auto  it_cyc = std::find(events.begin(), events.end(), "CYCLES"      );
+	const auto  it_ins = std::find(events.begin(), events.end(), "INSTRUCTIONS");
+
+	const auto is_timer = timer_name != "*";
+	auto fmt = [is_timer](const std::string &str) -> std::string
+	{
+		return is_timer ? tools::format(str, tools::Style::ITALIC) : str;
+	};
+
+	auto value = [](const float v) -> std::string
+	{
+		std::stringstream ss;
+		ss << std::setprecision(2) << (v > 99999.99f ? std::scientific : std::fixed) << std::setw(8) << v;
+		return ss.str();
+	};
+
+	std::stringstream ssmodule, ssprocess, sssp;
+	ssmodule  << std::setw(12) << module_sname;
+	ssprocess << std::setw(17) << task_name;
+	sssp      << std::setw( 7) << timer_name;
+
+	stream << "# ";
+	stream << ssmodule.str()       << tools::format(" | ",  tools::Style::BOLD)
+	       << fmt(ssprocess.str()) << tools::format(" | ",  tools::Style::BOLD)
+	       << fmt(sssp     .str());
+
+	if (it_cyc != events.end() && it_ins != events.end())
+	{
+		const auto cyc = counters[std::distance(events.begin(), it_cyc)];
+		const auto ins = counters[std::distance(events.begin(), it_ins)];
+		stream << tools::format(" || ", tools::Style::BOLD) << fmt(value(cyc ? (float)ins / (float)cyc : 0.f));
+	}
+
+	const auto n_fra  = (float)n_calls * (float)n_frames;
+	const auto n_bits = (float)n_calls * (float)n_elmts;
+	for (size_t e = 0; e < events.size(); e++)
+		stream << tools::format(" || ", tools::Style::BOLD) << fmt(value((float)counters[e] / n_fra ))
+		       << tools::format(" | ",  tools::Style::BOLD) << fmt(value((float)counters[e] / n_bits));
+
+	stream << std::endl;
+}
+
+void Statistics
+::show_counters(const std::vector<std::vector<const module::Task*>> &tasks, std::ostream &stream)
+{
+	const auto &events = Perf_counters::get_events();
+
+	auto counted = false;
+	for (auto &vt : tasks)
+		for (auto *t : vt)
+			for (auto c : t->get_counters_total())
+				counted |= c != 0;
+
+	if (!counted)
+		return;
+
+	const auto ipc = std::find(events.begin(), events.end(), "CYCLES"      ) != events.end() &&
+	                 std::find(events.begin(), events.end(), "INSTRUCTIONS") != events.end();
+
+	std::string sep1 = "-------------------------------------------";
+	std::string sep2 = "-------------|-------------------|---------";
+	std::string tit1 = "     Hardware counters for the given task  ";
+	std::string tit2 = "    ('*' = any, '-' = same as previous)    ";
+	std::string col1 = "      MODULE |              TASK |   TIMER ";
+	std::string col2 = "             |                   |         ";
+	if (ipc)
+	{
+		sep1 += "||----------"; sep2 += "||----------";
+		tit1 += "||          "; tit2 += "||          ";
+		col1 += "||      IPC "; col2 += "||          ";
+	}
+	for (auto &e : events)
+	{
+		std::stringstream ss;
+		ss << std::setw(19) << e << "  ";
+		sep1 += "||---------------------"; sep2 += "||----------|----------";
+		tit1 += "||" + ss.str();       tit2 += "||                     ";
+		col1 += "||  / FRAME |    / BIT "; col2 += "||          |          ";
+	}
+
+	stream << "#" << std::endl;
+	stream << "# " << tools::format(sep1, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(tit1, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(tit2, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(sep1, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(sep2, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(col1, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(col2, tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format(sep2, tools::Style::BOLD) << std::endl;
+
+	for (auto &vt : tasks)
+	{
+		if (vt.empty() || vt[0]->get_counters_total().size() != events.size())
+			continue;
+
+		auto n_calls  = (uint32_t)0;
+		auto counters = std::vector<uint64_t>(events.size(), 0);
+		for (auto *t : vt)
+		{
+			n_calls += t->get_n_calls();
+			for (size_t e = 0; e < t->get_counters_total().size(); e++)
+				counters[e] += t->get_counters_total()[e];
+		}
+
+		const auto n_elmts  = vt[0]->sockets.back()->get_n_elmts();
+		const auto n_frames = (size_t)vt[0]->get_module().get_n_frames();
+		Statistics::show_counters_line(vt[0]->get_module().get_short_name(), vt[0]->get_name(), "*", n_elmts,
+		                               n_frames, n_calls, counters, stream);
+
+		const auto &timers_name = vt[0]->get_timers_name();
+		for (size_t tn = 0; tn < timers_name.size(); tn++)
+		{
+			std::fill(counters.begin(), counters.end(), 0);
+			for (auto *t : vt)
+				if (tn < t->get_timers_counters().size())
+					for (size_t e = 0; e < t->get_timers_counters()[tn].size(); e++)
+						counters[e] += t->get_timers_counters()[tn][e];
+
+			auto counted_timer = false;
+			for (auto c : counters)
+				counted_timer |= c != 0;
+
+			if (counted_timer)
+				Statistics::show_counters_line("-", "-", timers_name[tn], n_elmts, n_frames, n_calls, counters, stream);
+		}
+	}
+	stream << "# " << tools::format(sep2, tools::Style::BOLD) << std::endl;
+}
+
 void Statistics
 ::show(std::vector<const module::Module*> modules, const bool ordered, std::ostream &stream)
 {
@@ -285,6 +429,11 @@ void Statistics
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
 		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+
+		std::vector<std::vector<const module::Task*>> vtasks;
+		for (auto *t : tasks)
+			vtasks.push_back({t});
+		Statistics::show_counters(vtasks, stream);
 	}
 	else
 	{
@@ -431,6 +580,8 @@ void Statistics
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
 		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+
+		Statistics::show_counters(tasks, stream);
 	}
 	else
 	{
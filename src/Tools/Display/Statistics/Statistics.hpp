@@ -54,6 +54,18 @@ private:
 	                       const std::chrono::nanoseconds timer_min_duration,
 	                       const std::chrono::nanoseconds timer_max_duration,
 	                             std::ostream             &stream = std::cout);
+
+	static void show_counters(const std::vector<std::vector<const module::Task*>> &tasks,
+	                          std::ostream &stream = std::cout);
+
+	static void show_counters_line(const std::string           &module_sname,
+	                               const std::string           &task_name,
+	                               const std::string           &timer_name,
+	                               const size_t                 n_elmts,
+	                               const size_t                 n_frames,
+	                               const uint32_t               n_calls,
+	                               const std::vector<uint64_t> &counters,
+	                                     std::ostream          &stream = std::cout);
 };
 
 using Stats = Statistics;
@@ -1,3 +1,5 @@
+#include "Tools/Perf/Tracer/Tracer.hpp"
+
 #include "Terminal.hpp"
 
 using namespace aff3ct;
@@ -56,6 +58,16 @@ void Terminal
 	{
 		std::unique_lock<std::mutex> lock(terminal->mutex_terminal);
 		if (terminal->cond_terminal.wait_for(lock, sleep_time) == std::cv_status::timeout)
+		{
+			const auto begin = tools::Tracer::now();
 			terminal->temp_report(std::clog); // display statistics in the terminal
+
+			// the reports appear in the timelines to see if they disturb the simulation threads
+			if (tools::Tracer::is_enabled())
+			{
+				static const auto name_id = tools::Tracer::register_name("Terminal::temp_report");
+				tools::Tracer::record(name_id, begin, tools::Tracer::now());
+			}
+		}
 	}
 }
@@ -93,6 +93,10 @@ Interleaver_core_ARP_DVB_RCS1<T>
 			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 			break;
 	}
+
+	// pi(i) = (p0 * i + {0, size/2 + p1, p2, size/2 + p3}[i % 4] + 1) % size
+	this->law.f_1     = p0;
+	this->law.offsets = {1, size/2 + p1 +1, p2 +1, size/2 + p3 +1};
 }
 
 template <typename T>
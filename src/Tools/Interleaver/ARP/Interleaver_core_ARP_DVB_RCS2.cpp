@@ -147,6 +147,10 @@ Interleaver_core_ARP_DVB_RCS2<T>
 			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 			break;
 	}
+
+	// pi(i) = (p * i + {0, 4*q1, 4*q0*p + 4*q2, 4*q0*p + 4*q3}[i % 4] + 3) % size
+	this->law.f_1     = p;
+	this->law.offsets = {3, 4*q1 +3, 4*q0*p + 4*q2 +3, 4*q0*p + 4*q3 +3};
 }
 
 template <typename T>
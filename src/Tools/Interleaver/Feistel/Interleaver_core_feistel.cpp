@@ -0,0 +1,192 @@
+#include <mipp.h>
+
+#include "Interleaver_core_feistel.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename T>
+Interleaver_core_feistel<T>
+::Interleaver_core_feistel(const int size, const int seed, const bool uniform, const int n_frames)
+: Interleaver_core<T>(size, "feistel", uniform, n_frames, true),
+  rd_engine(),
+  n_bits(compute_n_bits(size)),
+  r_bits(n_bits / 2),
+  keys(n_rounds * (uniform ? n_frames : 1), 0)
+{
+	rd_engine.seed(seed);
+}
+
+template <typename T>
+Interleaver_core_feistel<T>
+::~Interleaver_core_feistel()
+{
+}
+
+template <typename T>
+void Interleaver_core_feistel<T>
+::set_seed(const int seed)
+{
+	rd_engine.seed(seed);
+}
+
+template <typename T>
+void Interleaver_core_feistel<T>
+::gen_addr(T *addr, const int start, const int n, const int frame_id, const bool inverse) const
+{
+	const auto k = this->get_keys(frame_id);
+
+	// the network is computed on 'mipp::nElReg<int32_t>()' addresses at once, the addresses that are still out of
+	// [0, size) after two steps of cycle-walking are finished one by one
+	constexpr auto n_lanes = mipp::nElReg<int32_t>();
+	int32_t lanes[n_lanes];
+	for (auto l = 0; l < n_lanes; l++)
+		lanes[l] = l;
+
+	mipp::Reg<int32_t> r_i;
+	r_i.loadu(lanes);
+	r_i += mipp::Reg<int32_t>((int32_t)start);
+
+	const auto r_size = mipp::Reg<int32_t>((int32_t)this->get_size());
+	const auto r_inc  = mipp::Reg<int32_t>((int32_t)n_lanes);
+
+	const auto vec_loop_size = (n / n_lanes) * n_lanes;
+	for (auto j = 0; j < vec_loop_size; j += n_lanes)
+	{
+		auto r_x = inverse ? this->decrypt(r_i, k) : this->encrypt(r_i, k);
+		r_x = mipp::blend(inverse ? this->decrypt(r_x, k) : this->encrypt(r_x, k), r_x, r_x >= r_size);
+		r_x.storeu(lanes);
+
+		for (auto l = 0; l < n_lanes; l++)
+		{
+			auto x = (uint32_t)lanes[l];
+			while (x >= (uint32_t)this->get_size())
+				x = inverse ? this->decrypt(x, k) : this->encrypt(x, k);
+			addr[j + l] = (T)x;
+		}
+
+		r_i += r_inc;
+	}
+
+	for (auto j = vec_loop_size; j < n; j++)
+		addr[j] = (T)(inverse ? this->compute_inv((uint32_t)(start + j), frame_id)
+		                      : this->compute    ((uint32_t)(start + j), frame_id));
+}
+
+template <typename T>
+uint32_t Interleaver_core_feistel<T>
+::compute(const uint32_t i, const int frame_id) const
+{
+	const auto k = this->get_keys(frame_id);
+
+	// cycle-walking: the network is a bijection on [0, 2^n_bits), it is applied until the result is in [0, size)
+	auto x = this->encrypt(i, k);
+	while (x >= (uint32_t)this->get_size())
+		x = this->encrypt(x, k);
+
+	return x;
+}
+
+template <typename T>
+uint32_t Interleaver_core_feistel<T>
+::compute_inv(const uint32_t i, const int frame_id) const
+{
+	const auto k = this->get_keys(frame_id);
+
+	auto x = this->decrypt(i, k);
+	while (x >= (uint32_t)this->get_size())
+		x = this->decrypt(x, k);
+
+	return x;
+}
+
+template <typename T>
+void Interleaver_core_feistel<T>
+::gen_lut(T *lut, const int frame_id)
+{
+	this->gen_addr(lut, 0, this->get_size(), frame_id, false);
+}
+
+template <typename T>
+void Interleaver_core_feistel<T>
+::gen_key(const int frame_id)
+{
+	for (auto j = 0; j < n_rounds; j++)
+		keys[frame_id * n_rounds + j] = (uint32_t)rd_engine();
+}
+
+template <typename T>
+const uint32_t* Interleaver_core_feistel<T>
+::get_keys(const int frame_id) const
+{
+	return keys.data() + (this->is_uniform() ? (frame_id % this->get_n_frames()) * n_rounds : 0);
+}
+
+template <typename T>
+template <class V>
+V Interleaver_core_feistel<T>
+::encrypt(V x, const uint32_t *k) const
+{
+	for (auto j = 0; j < n_rounds; j++)
+	{
+		// the right part of a round becomes the left part of the next one
+		const auto w_r = (j % 2) ? n_bits - r_bits : r_bits;
+		const auto w_l = n_bits - w_r;
+
+		const auto l = x >> w_r;
+		const auto r = x & V((int32_t)((1u << w_r) -1));
+		x = (r << w_l) | ((l ^ round_function(r, k[j])) & V((int32_t)((1u << w_l) -1)));
+	}
+
+	return x;
+}
+
+template <typename T>
+template <class V>
+V Interleaver_core_feistel<T>
+::decrypt(V x, const uint32_t *k) const
+{
+	for (auto j = n_rounds -1; j >= 0; j--)
+	{
+		const auto w_r = (j % 2) ? n_bits - r_bits : r_bits;
+		const auto w_l = n_bits - w_r;
+
+		const auto r = x >> w_l;
+		const auto t = x & V((int32_t)((1u << w_l) -1));
+		x = (((t ^ round_function(r, k[j])) & V((int32_t)((1u << w_l) -1))) << w_r) | r;
+	}
+
+	return x;
+}
+
+template <typename T>
+template <class V>
+V Interleaver_core_feistel<T>
+::round_function(const V x, const uint32_t key)
+{
+	// integer hash with a good avalanche effect, the right shifts are masked as they may be arithmetic on the SIMD
+	// registers
+	auto h = x ^ V((int32_t)key);
+	h = h ^ ((h >> 16) & V((int32_t)0x0000ffff)); h = h * V((int32_t)0x7feb352d);
+	h = h ^ ((h >> 15) & V((int32_t)0x0001ffff)); h = h * V((int32_t)0x846ca68b);
+	h = h ^ ((h >> 16) & V((int32_t)0x0000ffff));
+	return h;
+}
+
+template <typename T>
+int Interleaver_core_feistel<T>
+::compute_n_bits(const int size)
+{
+	auto b = 2;
+	while (b < 31 && (1u << b) < (unsigned)size)
+		b++;
+	return b;
+}
+
+// ==================================================================================== explicit template instantiation
+#include <cstdint>
+template class aff3ct::tools::Interleaver_core_feistel<uint8_t >;
+template class aff3ct::tools::Interleaver_core_feistel<uint16_t>;
+template class aff3ct::tools::Interleaver_core_feistel<uint32_t>;
+template class aff3ct::tools::Interleaver_core_feistel<uint64_t>;
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,61 @@
+#ifndef INTERLEAVER_CORE_FEISTEL_HPP
+#define INTERLEAVER_CORE_FEISTEL_HPP
+
+#include <random>
+#include <vector>
+
+#include "../Interleaver_core.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Interleaver_core_feistel
+ *
+ * \brief Pseudo random interleaver defined by a keyed bijection: a Feistel network on the smallest number of bits
+ *        that covers [0, size) with cycle-walking to stay in [0, size).
+ *
+ * Any address of the interleaver or of the deinterleaver is computed in O(1) (on average) from the round keys of the
+ * frame. In uniform mode, only the keys are redrawn for each new frame and no lookup table is ever built. When the
+ * number of bits is odd, the two halves of the network have different sizes and they are swapped at each round.
+ */
+template <typename T = uint32_t>
+class Interleaver_core_feistel : public Interleaver_core<T>
+{
+private:
+	static constexpr int n_rounds = 4;
+
+	std::mt19937          rd_engine;
+	const int             n_bits; // the network permutes [0, 2^n_bits)
+	const int             r_bits; // number of bits of the right part of the even rounds (of the left part otherwise)
+	std::vector<uint32_t> keys;   // round keys of the frames ('n_rounds' per frame)
+
+public:
+	Interleaver_core_feistel(const int size, const int seed = 0, const bool uniform = false, const int n_frames = 1);
+	virtual ~Interleaver_core_feistel();
+
+	void set_seed(const int seed);
+
+	void gen_addr(T *addr, const int start, const int n, const int frame_id, const bool inverse) const;
+
+	uint32_t compute    (const uint32_t i, const int frame_id) const;
+	uint32_t compute_inv(const uint32_t i, const int frame_id) const;
+
+protected:
+	void gen_lut(T *lut, const int frame_id);
+	void gen_key(const int frame_id);
+
+private:
+	inline const uint32_t* get_keys(const int frame_id) const;
+
+	template <class V> inline V encrypt(V x, const uint32_t *keys) const;
+	template <class V> inline V decrypt(V x, const uint32_t *keys) const;
+
+	template <class V> static inline V   round_function(const V x, const uint32_t key);
+	                   static inline int compute_n_bits(const int size);
+};
+}
+}
+
+#endif	/* INTERLEAVER_CORE_FEISTEL_HPP */
@@ -21,6 +21,13 @@ Interleaver_core_golden<T>
 {
 }
 
+template <typename T>
+void Interleaver_core_golden<T>
+::set_seed(const int seed)
+{
+	gen.seed(seed);
+}
+
 template <typename T>
 void Interleaver_core_golden<T>
 ::gen_lut(T *lut, const int frame_id)
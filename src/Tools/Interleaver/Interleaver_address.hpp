@@ -0,0 +1,80 @@
+/*!
+ * \file
+ * \brief Computes or gathers the addresses of an interleaver.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef INTERLEAVER_ADDRESS_HPP_
+#define INTERLEAVER_ADDRESS_HPP_
+
+#include <cstdint>
+
+#include "Interleaver_core.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Interleaver_address
+ *
+ * \brief Computes the addresses of an algebraic interleaver on the fly (no load from the lookup tables).
+ *
+ * The quadratic term is computed with additions modulo 'size': with q(i) = (f_1 * i + f_2 * i^2) % size,
+ * q(i + L) = (q(i) + d(i)) % size and d(i + L) = (d(i) + 2 * f_2 * L^2) % size. The L = mipp::N<int32_t>()
+ * addresses of a SIMD register are computed at once.
+ *
+ * \tparam T: the type of the addresses.
+ */
+template <typename T = uint32_t>
+class Interleaver_address
+{
+private:
+	const int size;
+	const int f_1;
+	const int f_2;
+	const int period;
+	int       offsets[4];
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param size: the size of the interleaver.
+	 * \param law:  the algebraic law of the interleaver (has to be not empty).
+	 */
+	Interleaver_address(const int size, const Interleaver_law &law);
+
+	/*!
+	 * \brief Computes the addresses pi(start), pi(start +1), ..., pi(start + n -1).
+	 *
+	 * \param addr:  the output addresses (of size n).
+	 * \param start: the first index.
+	 * \param n:     the number of addresses to compute.
+	 */
+	void generate(T *addr, const int start, const int n) const;
+
+private:
+	inline int compute(const int i) const;
+};
+
+/*!
+ * \class Interleaver_gather
+ *
+ * \brief Gathers the data of a frame: out[i] = in[addr[i]] (with the AVX2 gather instructions when it is possible).
+ *
+ * \tparam D: the type of the data.
+ * \tparam T: the type of the addresses.
+ */
+template <typename D, typename T>
+struct Interleaver_gather
+{
+	static void apply(const D *in, D *out, const T *addr, const int n);
+};
+}
+}
+
+#include "Interleaver_address.hxx"
+
+#endif /* INTERLEAVER_ADDRESS_HPP_ */
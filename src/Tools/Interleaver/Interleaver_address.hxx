@@ -0,0 +1,131 @@
+#include <sstream>
+#include <mipp.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Interleaver_address.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+Interleaver_address<T>
+::Interleaver_address(const int size, const Interleaver_law &law)
+: size(size),
+  f_1(((law.f_1 % size) + size) % size),
+  f_2(((law.f_2 % size) + size) % size),
+  period((int)law.offsets.size())
+{
+	if (period == 0 || 4 % period)
+	{
+		std::stringstream message;
+		message << "'law.offsets.size()' has to be equal to 1, 2 or 4 ('law.offsets.size()' = " << period << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto p = 0; p < period; p++)
+		offsets[p] = ((law.offsets[p] % size) + size) % size;
+}
+
+template <typename T>
+int Interleaver_address<T>
+::compute(const int i) const
+{
+	const auto lin  = ((int64_t)f_1 * i) % size;
+	const auto quad = (((int64_t)f_2 * i) % size * i) % size;
+
+	return (int)((lin + quad + offsets[i % period]) % size);
+}
+
+template <typename T>
+void Interleaver_address<T>
+::generate(T *addr, const int start, const int n) const
+{
+	constexpr int L = mipp::N<int32_t>();
+	auto i = 0;
+	if (L % period == 0 && n >= L)
+	{
+		int32_t q[L], d[L], c[L], a[L];
+		for (auto l = 0; l < L; l++)
+		{
+			const auto idx = (int64_t)(start + l);
+			q[l] = (int32_t)((((int64_t)f_1 * idx) % size + (((int64_t)f_2 * idx) % size * idx) % size) % size);
+			d[l] = (int32_t)((((int64_t)f_1 * L) % size + ((int64_t)f_2 * ((2 * idx * L + L * L) % size)) % size) % size);
+			c[l] = offsets[idx % period];
+		}
+
+		const auto r_size = mipp::Reg<int32_t>((int32_t)size);
+		const auto r_D    = mipp::Reg<int32_t>((int32_t)(((int64_t)f_2 * 2 * L * L) % size));
+		mipp::Reg<int32_t> r_c, r_q, r_d;
+		r_c.loadu(c);
+		r_q.loadu(q);
+		r_d.loadu(d);
+
+		for (; i <= n - L; i += L)
+		{
+			// pi(i) = (q(i) + c(i)) % size, all the additions are made modulo 'size'
+			auto r_a = r_q + r_c;
+			r_a = mipp::blend(r_a - r_size, r_a, r_a >= r_size);
+			r_a.storeu(a);
+			for (auto l = 0; l < L; l++)
+				addr[i + l] = (T)a[l];
+
+			r_q += r_d;
+			r_q = mipp::blend(r_q - r_size, r_q, r_q >= r_size);
+			r_d += r_D;
+			r_d = mipp::blend(r_d - r_size, r_d, r_d >= r_size);
+		}
+	}
+
+	for (; i < n; i++)
+		addr[i] = (T)this->compute(start + i);
+}
+
+template <typename D, typename T>
+void Interleaver_gather<D,T>
+::apply(const D *in, D *out, const T *addr, const int n)
+{
+	for (auto i = 0; i < n; i++)
+		out[i] = in[addr[i]];
+}
+
+#ifdef __AVX2__
+template <>
+struct Interleaver_gather<float, uint32_t>
+{
+	static void apply(const float *in, float *out, const uint32_t *addr, const int n)
+	{
+		auto i = 0;
+		for (; i <= n - 8; i += 8)
+		{
+			const auto idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr + i));
+			_mm256_storeu_ps(out + i, _mm256_i32gather_ps(in, idx, 4));
+		}
+		for (; i < n; i++)
+			out[i] = in[addr[i]];
+	}
+};
+
+template <>
+struct Interleaver_gather<int32_t, uint32_t>
+{
+	static void apply(const int32_t *in, int32_t *out, const uint32_t *addr, const int n)
+	{
+		auto i = 0;
+		for (; i <= n - 8; i += 8)
+		{
+			const auto idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+			                    _mm256_i32gather_epi32(reinterpret_cast<const int*>(in), idx, 4));
+		}
+		for (; i < n; i++)
+			out[i] = in[addr[i]];
+	}
+};
+#endif
+}
+}
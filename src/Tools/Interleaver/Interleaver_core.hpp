@@ -2,6 +2,7 @@
 #define INTERLEAVER_CORE_HPP_
 
 #include <cstdint>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -14,6 +15,22 @@ namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \struct Interleaver_law
+ *
+ * \brief Algebraic description of an interleaver:
+ *        pi(i) = (f_1 * i + f_2 * i^2 + offsets[i % offsets.size()]) % size.
+ *
+ * It covers the quadratic permutation polynomials (LTE QPP, f_2 != 0) and the almost regular permutations (DVB-RCS ARP,
+ * f_2 = 0 and 4 offsets). An empty 'offsets' vector means that the interleaver is only described by its lookup table.
+ */
+struct Interleaver_law
+{
+	int f_1 = 0;              /*!< Linear coefficient */
+	int f_2 = 0;              /*!< Quadratic coefficient */
+	std::vector<int> offsets; /*!< Periodic offsets (the period has to be 1, 2 or 4) */
+};
+
 template <typename T = uint32_t>
 class Interleaver_core
 {
@@ -22,9 +39,11 @@ protected:
 	const std::string name;
 	const int n_frames;
 	      bool uniform;
+	const bool keyed;
 	      bool initialized;
 	std::vector<T> pi;     /*!< Lookup table for the interleaving process */
 	std::vector<T> pi_inv; /*!< Lookup table for the deinterleaving process */
+	Interleaver_law law;   /*!< Algebraic law of the interleaver (for the on-the-fly address generation) */
 
 public:
 	/*!
@@ -33,10 +52,13 @@ public:
 	 * \param size:     number of the data to interleave or to deinterleave.
 	 * \param n_frames: number of frames to process in the Interleaver.
 	 * \param name:     Interleaver's name.
+	 * \param keyed:    the addresses are computed on the fly from a key per frame (see 'gen_addr'), the lookup
+	 *                  tables are not built.
 	 */
-	Interleaver_core(const int size, const std::string &name, const bool uniform = false, const int n_frames = 1)
-	: size(size), name(name), n_frames(n_frames), uniform(uniform), initialized(false),
-	  pi(size * n_frames, 0), pi_inv(size * n_frames, 0)
+	Interleaver_core(const int size, const std::string &name, const bool uniform = false, const int n_frames = 1,
+	                 const bool keyed = false)
+	: size(size), name(name), n_frames(n_frames), uniform(uniform), keyed(keyed), initialized(false),
+	  pi(keyed ? 0 : size * n_frames, 0), pi_inv(keyed ? 0 : size * n_frames, 0)
 	{
 		if (size <= 0)
 		{
@@ -66,14 +88,42 @@ public:
 
 	const std::vector<T>& get_lut() const
 	{
+		if (keyed)
+		{
+			std::stringstream message;
+			message << "The lookup tables are not built for a keyed interleaver ('name' = " << name << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
 		return pi;
 	}
 
 	const std::vector<T>& get_lut_inv() const
 	{
+		if (keyed)
+		{
+			std::stringstream message;
+			message << "The lookup tables are not built for a keyed interleaver ('name' = " << name << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
 		return pi_inv;
 	}
 
+	/*!
+	 * \brief Computes the interleaving addresses 'start' to 'start + n -1' of the frame 'frame_id' (or the
+	 *        deinterleaving addresses when 'inverse' is set).
+	 *
+	 * The default implementation reads the lookup tables, the keyed interleavers compute the addresses from the key of
+	 * the frame.
+	 */
+	virtual void gen_addr(T *addr, const int start, const int n, const int frame_id, const bool inverse) const
+	{
+		const auto &lut = inverse ? pi_inv : pi;
+		const auto off = (frame_id % n_frames) * size + start;
+		std::copy(lut.data() + off, lut.data() + off + n, addr);
+	}
+
 	int get_size() const
 	{
 		return size;
@@ -84,11 +134,34 @@ public:
 		return n_frames;
 	}
 
+	/*!
+	 * \brief Returns true if the addresses of the interleaver can be computed from its algebraic law (see
+	 *        'get_law') instead of being loaded from the lookup tables.
+	 */
+	bool is_algebraic() const
+	{
+		return !law.offsets.empty();
+	}
+
+	const Interleaver_law& get_law() const
+	{
+		return law;
+	}
+
 	bool is_uniform() const
 	{
 		return uniform;
 	}
 
+	/*!
+	 * \brief Returns true if the addresses of the interleaver are computed on the fly from a key per frame (see
+	 *        'gen_addr'), the lookup tables are then not available.
+	 */
+	bool is_keyed() const
+	{
+		return keyed;
+	}
+
 	bool is_initialized() const
 	{
 		return initialized;
@@ -99,6 +172,14 @@ public:
 		return name;
 	}
 
+	/*!
+	 * \brief Reseeds the pseudo random generator of the core (if any), the next refresh draws the permutations from
+	 *        this seed.
+	 */
+	virtual void set_seed(const int seed)
+	{
+	}
+
 	void init()
 	{
 		this->refresh();
@@ -107,6 +188,14 @@ public:
 
 	void refresh()
 	{
+		if (keyed)
+		{
+			// only the keys are regenerated, the addresses are computed on the fly
+			for (auto f = 0; f < (uniform ? this->n_frames : 1); f++)
+				this->gen_key(f);
+			return;
+		}
+
 		this->gen_lut(this->pi.data(), 0);
 		for (auto i = 0; i < (int)this->get_size(); i++)
 			this->pi_inv[this->pi[i]] = i;
@@ -135,6 +224,10 @@ public:
 
 protected:
 	virtual void gen_lut(T *lut, const int frame_id) = 0;
+
+	virtual void gen_key(const int frame_id)
+	{
+	}
 };
 }
 }
@@ -219,6 +219,10 @@ void Interleaver_core_LTE<T>
 	auto size = (int)this->get_size();
 	if (f_1.find(size) != f_1.end())
 	{
+		this->law.f_1     = (int)f_1[size];
+		this->law.f_2     = (int)f_2[size];
+		this->law.offsets = {0};
+
 		for (auto i = 0; i < size; i++)
 			lut[i] = (T)pi_LTE(i, (int)f_1[size], (int)f_2[size], size);
 	}
@@ -20,6 +20,13 @@ Interleaver_core_random<T>
 {
 }
 
+template <typename T>
+void Interleaver_core_random<T>
+::set_seed(const int seed)
+{
+	rd_engine.seed(seed);
+}
+
 template <typename T>
 void Interleaver_core_random<T>
 ::gen_lut(T *lut, const int frame_id)
@@ -19,6 +19,8 @@ public:
 	Interleaver_core_random(const int size, const int seed = 0, const bool uniform = false, const int n_frames = 1);
 	virtual ~Interleaver_core_random();
 
+	void set_seed(const int seed);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
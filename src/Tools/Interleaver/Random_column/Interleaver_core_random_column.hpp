@@ -23,6 +23,8 @@ public:
 	                               const int n_frames = 1);
 	virtual ~Interleaver_core_random_column();
 
+	void set_seed(const int seed);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -0,0 +1,53 @@
+#ifndef BITS_H
+#define BITS_H
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief Index of the least significant set bit of a word ('x' has to be different from 0).
+ */
+inline unsigned ctz(const uint64_t x)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+	unsigned long idx;
+	_BitScanForward64(&idx, x);
+	return (unsigned)idx;
+#elif defined(_MSC_VER)
+	unsigned long idx;
+	if (_BitScanForward(&idx, (unsigned long)x))
+		return (unsigned)idx;
+	_BitScanForward(&idx, (unsigned long)(x >> 32));
+	return (unsigned)idx + 32;
+#else
+	return (unsigned)__builtin_ctzll((unsigned long long)x);
+#endif
+}
+
+/*!
+ * \brief Number of set bits in a word.
+ */
+inline unsigned popcount(const uint64_t x)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	return (unsigned)__popcnt64(x);
+#elif defined(_MSC_VER)
+	uint64_t v = x - ((x >> 1) & 0x5555555555555555ULL);
+	v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+	v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (unsigned)((v * 0x0101010101010101ULL) >> 56);
+#else
+	return (unsigned)__builtin_popcountll((unsigned long long)x);
+#endif
+}
+}
+}
+
+#endif /* BITS_H */
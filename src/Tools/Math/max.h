@@ -24,6 +24,9 @@ using proto_min = R (*)(const R a, const R b);
 template <typename R>
 using proto_max_i = mipp::Reg<R> (*)(const mipp::Reg<R> a, const mipp::Reg<R> b);
 
+template <typename R>
+using proto_min_i = mipp::Reg<R> (*)(const mipp::Reg<R> a, const mipp::Reg<R> b);
+
 // ------------------------------------------------------------------------------------------- special function headers
 
 template <typename R> __forceinline R max          (const R a, const R b);
@@ -38,6 +41,10 @@ template <typename R> __forceinline R min_star        (const R a, const R b);
 template <typename R> __forceinline mipp::Reg<R> max_i       (const mipp::Reg<R> a, const mipp::Reg<R> b);
 template <typename R> __forceinline mipp::Reg<R> max_linear_i(const mipp::Reg<R> a, const mipp::Reg<R> b);
 template <typename R> __forceinline mipp::Reg<R> max_star_i  (const mipp::Reg<R> a, const mipp::Reg<R> b);
+
+template <typename R> __forceinline mipp::Reg<R> min_i             (const mipp::Reg<R> a, const mipp::Reg<R> b);
+template <typename R> __forceinline mipp::Reg<R> min_star_linear2_i(const mipp::Reg<R> a, const mipp::Reg<R> b);
+template <typename R> __forceinline mipp::Reg<R> min_star_i        (const mipp::Reg<R> a, const mipp::Reg<R> b);
 }
 }
 
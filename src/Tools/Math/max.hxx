@@ -113,5 +113,34 @@ inline R min_star(const R a, const R b)
 {
 	return std::min(a, b) + (R)std::log1p(std::exp(-(a + b))) - (R)std::log1p(std::exp(-std::abs(a - b)));
 }
+
+template <typename R>
+inline mipp::Reg<R> min_i(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return mipp::min(a, b);
+}
+
+template <typename R>
+inline mipp::Reg<R> correction_linear2_i(const mipp::Reg<R> x)
+{
+	mipp::Reg<R> zero = (R)0.0, one = (R)1.0, lim = (R)2.625;
+	const auto low  = mipp::Reg<R>((R)-0.3750) * x + mipp::Reg<R>((R)0.6825);
+	const auto high = mipp::Reg<R>((R)-0.1875) * x + mipp::Reg<R>((R)0.5);
+	return mipp::blend(zero, mipp::blend(low, high, x < one), x > lim);
+}
+
+template <typename R>
+inline mipp::Reg<R> min_star_linear2_i(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return mipp::min(a, b) + correction_linear2_i(a + b) - correction_linear2_i(mipp::abs(a - b));
+}
+
+template <typename R>
+inline mipp::Reg<R> min_star_i(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	mipp::Reg<R> zero = (R)0.0, one = (R)1.0;
+	return mipp::min(a, b) + mipp::log(one + mipp::exp(zero - (a + b)))
+	                       - mipp::log(one + mipp::exp(zero - mipp::abs(a - b)));
+}
 }
 }
@@ -0,0 +1,93 @@
+#ifndef MAX_LOG_PAM_H_
+#define MAX_LOG_PAM_H_
+
+#include <algorithm>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Max-log LLRs of the Gray mapped 2^m-PAM used by the PAM and QAM modems (the points are the odd integers
+ * -(2^m -1), ..., -1, +1, ..., +(2^m -1) divided by 'sqrt_es', the bit m-1 is the sign and the bit 0 is the deepest).
+ *
+ * Each level of the mapping is folded on the positive side (z <- 2^j - |z|) because the nearest point of any subset
+ * is always on the same side than z: the LLR of the sign bit of each level is then given by the closed form
+ * (|z| +1)^2 - (|z| -p)^2 where p is the nearest positive point. The cost is O(m) per dimension instead of O(2^m).
+ *
+ * \param Y:          the 'n_dims' real dimensions (a QAM symbol is made of two dimensions).
+ * \param W:          the square gain of each dimension (after equalization), nullptr means 1.
+ * \param L:          the LLRs, the 'm' bits of the dimension 'd' are stored from 'd * m', only the 'n_bits' first LLRs
+ *                    are written.
+ * \param inv_sigma2: the factor applied to the squared Euclidean distances.
+ */
+template <typename R>
+inline void max_log_PAM(const R *Y, const R *W, R *L, const int n_dims, const int m, const int n_bits,
+                        const R sqrt_es, const R inv_sigma2)
+{
+	constexpr int n_el = mipp::nElReg<R>();
+
+	const auto r_one    = mipp::Reg<R>((R)1);
+	const auto r_half   = mipp::Reg<R>((R)0.5);
+	const auto r_two    = mipp::Reg<R>((R)2);
+	const auto r_scale  = mipp::Reg<R>(sqrt_es);
+	const auto r_factor = mipp::Reg<R>(inv_sigma2 / (sqrt_es * sqrt_es));
+
+	R y_tail[n_el], w_tail[n_el];
+	mipp::vector<R> llr(m * n_el);
+
+	for (auto d = 0; d < n_dims; d += n_el)
+	{
+		const auto n_lanes = std::min(n_el, n_dims - d);
+
+		mipp::Reg<R> r_z, r_w = r_one;
+		if (n_lanes == n_el)
+		{
+			r_z.loadu(Y + d);
+			if (W != nullptr) r_w.loadu(W + d);
+		}
+		else
+		{
+			std::fill(y_tail, y_tail + n_el, (R)0);
+			std::fill(w_tail, w_tail + n_el, (R)1);
+			std::copy(Y + d, Y + d + n_lanes, y_tail);
+			if (W != nullptr) std::copy(W + d, W + d + n_lanes, w_tail);
+			r_z.loadu(y_tail);
+			r_w.loadu(w_tail);
+		}
+
+		r_z *= r_scale;
+		const auto r_llr_factor = r_factor * r_w;
+
+		for (auto j = m -1; j >= 0; j--)
+		{
+			const auto r_abs = mipp::abs(r_z);
+			const auto r_max = mipp::Reg<R>((R)((1 << (j +1)) -1));
+
+			// nearest positive point of the current level
+			auto r_p = r_two * mipp::round((r_abs - r_one) * r_half) + r_one;
+			r_p = mipp::min(mipp::max(r_p, r_one), r_max);
+
+			const auto r_far  = r_abs + r_one;
+			const auto r_near = r_abs - r_p;
+			const auto r_llr  = (r_far * r_far - r_near * r_near) * r_llr_factor;
+
+			mipp::copysign(r_llr, r_z).storeu(&llr[j * n_el]);
+
+			r_z = mipp::Reg<R>((R)(1 << j)) - r_abs;
+		}
+
+		for (auto l = 0; l < n_lanes; l++)
+			for (auto j = 0; j < m; j++)
+			{
+				const auto n = (d + l) * m + j;
+				if (n < n_bits)
+					L[n] = llr[j * n_el + l];
+			}
+	}
+}
+}
+}
+
+#endif /* MAX_LOG_PAM_H_ */
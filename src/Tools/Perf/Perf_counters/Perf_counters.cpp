@@ -0,0 +1,206 @@
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+
+#include "Perf_counters.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static std::vector<std::string> pc_events;
+static std::atomic<unsigned>    pc_generation(0);
+static std::once_flag           pc_warning;
+
+static thread_local std::unique_ptr<Perf_counters> pc_local;
+
+static const std::vector<std::string> pc_event_names = {"CYCLES", "INSTRUCTIONS", "BRANCH_MISSES", "L1D_MISSES",
+                                                        "LLC_MISSES"};
+
+Perf_counters
+::Perf_counters()
+: generation(0), available(false)
+{
+}
+
+Perf_counters
+::~Perf_counters()
+{
+	this->close();
+}
+
+void Perf_counters
+::set_events(const std::vector<std::string> &events)
+{
+	for (auto &e : events)
+		if (!Perf_counters::is_event(e))
+		{
+			std::stringstream message;
+			message << "Unknown hardware event ('event' = " << e << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	pc_events = events;
+	pc_generation++;
+}
+
+const std::vector<std::string>& Perf_counters
+::get_events()
+{
+	return pc_events;
+}
+
+const std::vector<std::string>& Perf_counters
+::get_event_names()
+{
+	return pc_event_names;
+}
+
+bool Perf_counters
+::is_event(const std::string &name)
+{
+	return std::find(pc_event_names.begin(), pc_event_names.end(), name) != pc_event_names.end();
+}
+
+bool Perf_counters
+::read(uint64_t *values)
+{
+	if (!pc_local)
+		pc_local.reset(new Perf_counters());
+
+	if (pc_local->generation != pc_generation)
+	{
+		pc_local->close();
+		pc_local->open();
+	}
+
+	return pc_local->read_group(values);
+}
+
+#if defined(__linux__)
+static bool event_attr(const std::string &name, perf_event_attr &attr)
+{
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+
+	const uint64_t read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+
+	     if (name == "CYCLES"       ) { attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CPU_CYCLES;          }
+	else if (name == "INSTRUCTIONS" ) { attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_INSTRUCTIONS;        }
+	else if (name == "BRANCH_MISSES") { attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_BRANCH_MISSES;       }
+	else if (name == "L1D_MISSES"   ) { attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss; }
+	else if (name == "LLC_MISSES"   ) { attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_LL  | read_miss; }
+	else
+		return false;
+
+	attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+
+	return true;
+}
+#endif
+
+void Perf_counters
+::open()
+{
+	this->generation = pc_generation;
+	this->available  = false;
+
+	const auto events = pc_events;
+	if (events.empty())
+		return;
+
+#if defined(__linux__)
+	std::string error;
+	for (auto &e : events)
+	{
+		perf_event_attr attr;
+		event_attr(e, attr);
+		attr.disabled = this->fds.empty() ? 1 : 0; // the whole group is enabled by its leader
+
+		const int leader = this->fds.empty() ? -1 : this->fds[0];
+		const int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+		if (fd < 0)
+		{
+			error = "'" + e + "' can't be opened (" + std::strerror(errno) + ")";
+			break;
+		}
+		this->fds.push_back(fd);
+	}
+
+	if (this->fds.size() == events.size())
+	{
+		ioctl(this->fds[0], PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+		ioctl(this->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		this->buffer.resize(3 + events.size());
+		this->available = true;
+	}
+	else
+	{
+		this->close();
+		std::call_once(pc_warning, [&error]()
+		{
+			std::clog << format_warning("The hardware counters are unavailable, only the time is measured: " + error +
+			                            ", check '/proc/sys/kernel/perf_event_paranoid'.") << std::endl;
+		});
+	}
+#else
+	std::call_once(pc_warning, []()
+	{
+		std::clog << format_warning("The hardware counters are only available on Linux, only the time is measured.")
+		          << std::endl;
+	});
+#endif
+}
+
+void Perf_counters
+::close()
+{
+#if defined(__linux__)
+	// the members are closed before the leader
+	for (auto fd = this->fds.rbegin(); fd != this->fds.rend(); fd++)
+		::close(*fd);
+#endif
+	this->fds.clear();
+	this->available = false;
+}
+
+bool Perf_counters
+::read_group(uint64_t *values)
+{
+	if (!this->available)
+		return false;
+
+#if defined(__linux__)
+	const auto n_bytes = this->buffer.size() * sizeof(uint64_t);
+	if (::read(this->fds[0], this->buffer.data(), n_bytes) != (ssize_t)n_bytes)
+		return false;
+
+	// scale the values when the counters have been multiplexed with other events
+	const auto time_enabled = this->buffer[1];
+	const auto time_running = this->buffer[2];
+	for (size_t e = 0; e < this->fds.size(); e++)
+		values[e] = (time_running && time_running != time_enabled) ?
+		            (uint64_t)((double)this->buffer[3 + e] * ((double)time_enabled / (double)time_running)) :
+		            this->buffer[3 + e];
+
+	return true;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,71 @@
+/*!
+ * \file
+ * \brief Hardware performance counters of the calling thread (Linux perf_event_open).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PERF_COUNTERS_HPP_
+#define PERF_COUNTERS_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Perf_counters
+ *
+ * \brief Group of hardware counters read around the task executions when the statistics are enabled.
+ *
+ * The events are configured once for the whole process ('set_events') and each thread opens its own group of counters
+ * the first time it reads them (the counters follow the calling thread only, user space only). All the events of the
+ * group are read with a single system call and scaled when the kernel multiplexes the counters.
+ *
+ * When the counters can't be opened (not a Linux system, no PMU in a container, 'perf_event_paranoid' too strict) a
+ * warning is displayed once and 'read' returns false: the statistics fall back on the wall-clock time only.
+ */
+class Perf_counters
+{
+private:
+	std::vector<int>      fds;        // one file descriptor per event, the first one is the group leader
+	std::vector<uint64_t> buffer;     // read buffer of the group (nr, time_enabled, time_running, values)
+	unsigned              generation; // generation of the configuration when the group has been opened
+	bool                  available;
+
+	Perf_counters();
+
+public:
+	~Perf_counters();
+
+	/*
+	 * Set the events to count (names from 'get_event_names'), an empty list disables the counters
+	 */
+	static void set_events(const std::vector<std::string> &events);
+
+	static const std::vector<std::string>& get_events();
+
+	static const std::vector<std::string>& get_event_names();
+
+	static bool is_event(const std::string &name);
+
+	static inline bool is_enabled() { return !Perf_counters::get_events().empty(); }
+
+	/*
+	 * Read the counters of the calling thread in 'values' (one value per event in the order of 'get_events'),
+	 * return false if the counters are not available.
+	 */
+	static bool read(uint64_t *values);
+
+private:
+	void open ();
+	void close();
+	bool read_group(uint64_t *values);
+};
+}
+}
+
+#endif /* PERF_COUNTERS_HPP_ */
@@ -0,0 +1,181 @@
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+
+#include "Tracer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+std::atomic<bool>                                  Tracer::enabled(false);
+std::chrono::time_point<std::chrono::steady_clock> Tracer::epoch = std::chrono::steady_clock::now();
+
+namespace
+{
+struct Event
+{
+	uint32_t name_id;
+	uint64_t begin;
+	uint64_t end;
+};
+
+struct Buffer
+{
+	const uint32_t        tid;
+	std::vector<Event>    events;
+	std::atomic<uint64_t> n_recorded;
+	std::atomic<bool>     retired; // true when the thread is over
+
+	Buffer(const uint32_t tid, const size_t capacity)
+	: tid(tid), events(capacity), n_recorded(0), retired(false) {}
+};
+
+// the buffer of a thread is retired (and freed by the next dump) when the thread ends
+struct Buffer_handle
+{
+	std::shared_ptr<Buffer> buffer;
+	~Buffer_handle() { if (buffer) buffer->retired = true; }
+};
+
+std::mutex                           tr_mutex;
+std::vector<std::shared_ptr<Buffer>> tr_buffers;
+std::vector<std::string>             tr_names;
+size_t                               tr_capacity = 0;
+uint32_t                             tr_next_tid = 0;
+
+thread_local Buffer_handle tr_local;
+}
+
+Tracer
+::Tracer()
+{
+}
+
+Tracer
+::~Tracer()
+{
+}
+
+void Tracer
+::enable(const size_t capacity)
+{
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::lock_guard<std::mutex> lock(tr_mutex);
+	tr_capacity = capacity;
+	Tracer::epoch = std::chrono::steady_clock::now();
+	Tracer::enabled = true;
+}
+
+void Tracer
+::disable()
+{
+	Tracer::enabled = false;
+}
+
+uint32_t Tracer
+::register_name(const std::string &name)
+{
+	std::lock_guard<std::mutex> lock(tr_mutex);
+
+	auto it = std::find(tr_names.begin(), tr_names.end(), name);
+	if (it != tr_names.end())
+		return (uint32_t)std::distance(tr_names.begin(), it);
+
+	tr_names.push_back(name);
+	return (uint32_t)(tr_names.size() -1);
+}
+
+void Tracer
+::record(const uint32_t name_id, const uint64_t begin, const uint64_t end)
+{
+	auto &buffer = tr_local.buffer;
+	if (!buffer)
+	{
+		std::lock_guard<std::mutex> lock(tr_mutex);
+		buffer = std::make_shared<Buffer>(tr_next_tid++, tr_capacity);
+		tr_buffers.push_back(buffer);
+	}
+
+	const auto n = buffer->n_recorded.load(std::memory_order_relaxed);
+	buffer->events[n % buffer->events.size()] = {name_id, begin, end};
+	buffer->n_recorded.store(n +1, std::memory_order_release);
+}
+
+static std::string json_escape(const std::string &str)
+{
+	std::string escaped;
+	for (auto c : str)
+	{
+		if (c == '"' || c == '\\')
+			escaped += '\\';
+		escaped += c;
+	}
+	return escaped;
+}
+
+void Tracer
+::dump(const std::string &path)
+{
+	std::lock_guard<std::mutex> lock(tr_mutex);
+
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the trace file ('path' = " << path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	uint64_t n_overwritten = 0;
+	auto first = true;
+
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	for (auto &b : tr_buffers)
+	{
+		const auto n_recorded = b->n_recorded.load(std::memory_order_acquire);
+		if (n_recorded == 0)
+			continue;
+
+		const auto capacity = (uint64_t)b->events.size();
+		const auto n_first  = n_recorded > capacity ? n_recorded - capacity : 0;
+		n_overwritten += n_first;
+
+		file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << b->tid
+		     << ",\"args\":{\"name\":\"thread " << b->tid << "\"}}";
+		first = false;
+
+		file << std::fixed << std::setprecision(3);
+		for (auto n = n_first; n < n_recorded; n++)
+		{
+			const auto &e = b->events[n % capacity];
+			file << ",\n{\"name\":\"" << json_escape(tr_names[e.name_id]) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+			     << b->tid << ",\"ts\":" << (double)e.begin * 1e-3 << ",\"dur\":" << (double)(e.end - e.begin) * 1e-3
+			     << "}";
+		}
+
+		b->n_recorded = 0;
+	}
+	file << "\n]}" << std::endl;
+
+	tr_buffers.erase(std::remove_if(tr_buffers.begin(), tr_buffers.end(),
+	                                [](const std::shared_ptr<Buffer> &b) { return b->retired.load(); }),
+	                 tr_buffers.end());
+
+	if (n_overwritten)
+		std::clog << format_warning("The trace buffers were too small, the " + std::to_string(n_overwritten) +
+		                            " oldest events have been overwritten ('" + path + "').") << std::endl;
+}
@@ -0,0 +1,83 @@
+/*!
+ * \file
+ * \brief Timeline of the task executions of each thread, exported in the Chrome trace event format.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TRACER_HPP_
+#define TRACER_HPP_
+
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Tracer
+ *
+ * \brief Records the begin and the end of the task executions in a ring buffer per thread.
+ *
+ * A thread allocates its buffer the first time it records an event and it is the only writer of this buffer: the
+ * recording is a store in the buffer followed by an atomic increment of its counter (no lock, no system call). When a
+ * buffer is full the oldest events are overwritten.
+ *
+ * 'dump' writes the events of all the threads in a JSON file in the Chrome trace event format (it can be opened in
+ * chrome://tracing or in the Perfetto UI) and clears the buffers. It has to be called when the threads which record
+ * events are stopped (between two SNR points for instance).
+ */
+class Tracer
+{
+private:
+	static std::atomic<bool>                                  enabled;
+	static std::chrono::time_point<std::chrono::steady_clock> epoch;
+
+	Tracer();
+
+public:
+	virtual ~Tracer();
+
+	/*
+	 * Start the recording, 'capacity' is the number of events kept per thread
+	 */
+	static void enable(const size_t capacity);
+
+	static void disable();
+
+	static inline bool is_enabled()
+	{
+		return Tracer::enabled.load(std::memory_order_relaxed);
+	}
+
+	/*
+	 * Nanoseconds since the call to 'enable'
+	 */
+	static inline uint64_t now()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+		                                                                      Tracer::epoch).count();
+	}
+
+	/*
+	 * Return the identifier of an event name (the same name always gives the same identifier)
+	 */
+	static uint32_t register_name(const std::string &name);
+
+	/*
+	 * Record an event of the calling thread, 'begin' and 'end' are given by 'now'
+	 */
+	static void record(const uint32_t name_id, const uint64_t begin, const uint64_t end);
+
+	/*
+	 * Write the recorded events in 'path' (Chrome trace event JSON) and clear the buffers
+	 */
+	static void dump(const std::string &path);
+};
+}
+}
+
+#endif /* TRACER_HPP_ */
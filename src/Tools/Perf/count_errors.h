@@ -0,0 +1,87 @@
+#ifndef COUNT_ERRORS_H_
+#define COUNT_ERRORS_H_
+
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Math/bits.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Number of positions where one of 'U' and 'V' is zero and the other is not (same result as the sum of
+ * '!U[i] != !V[i]').
+ *
+ * Each lane of the accumulator is incremented at most once per register, it is reduced before it can overflow (every
+ * 127 registers for 8-bit data).
+ */
+template <typename B = int>
+inline int count_errors(const B *U, const B *V, const int size)
+{
+	constexpr int n_el     = mipp::nElReg<B>();
+	constexpr long long b_max = (long long)std::numeric_limits<B>::max();
+	constexpr int max_regs = (b_max < (1 << 20)) ? (int)b_max : (1 << 20);
+
+	const auto vec_loop_size = (size / n_el) * n_el;
+	const auto r_zero = mipp::Reg<B>((B)0);
+
+	B lanes[n_el];
+	auto n_errors = 0;
+	for (auto i = 0; i < vec_loop_size;)
+	{
+		const auto stop = std::min(vec_loop_size, i + max_regs * n_el);
+
+		auto r_acc = r_zero;
+		for (; i < stop; i += n_el)
+		{
+			mipp::Reg<B> r_U, r_V;
+			r_U.loadu(&U[i]);
+			r_V.loadu(&V[i]);
+
+			// the lanes of a true mask are all ones (-1)
+			r_acc -= mipp::toReg<B>((r_U == r_zero) ^ (r_V == r_zero));
+		}
+
+		r_acc.storeu(lanes);
+		for (auto l = 0; l < n_el; l++)
+			n_errors += (int)lanes[l];
+	}
+
+	for (auto i = vec_loop_size; i < size; i++)
+		n_errors += !U[i] != !V[i];
+
+	return n_errors;
+}
+
+/*
+ * Number of different bits between two frames packed with the 'Bit_packer' ('n_bits' bits stored in
+ * ceil('n_bits' / 8) bytes). The padding bits of the last byte have to be zero in both frames, this is always the
+ * case after a 'Bit_packer::pack'.
+ */
+inline int count_errors_packed(const uint8_t *U, const uint8_t *V, const int n_bits)
+{
+	const auto n_bytes = (n_bits + 7) / 8;
+
+	auto n_errors = 0;
+	auto b = 0;
+	for (; b + 8 <= n_bytes; b += 8)
+	{
+		uint64_t u, v;
+		std::memcpy(&u, U + b, sizeof(u));
+		std::memcpy(&v, V + b, sizeof(v));
+		n_errors += (int)popcount(u ^ v);
+	}
+	for (; b < n_bytes; b++)
+		n_errors += (int)popcount((uint64_t)(U[b] ^ V[b]));
+
+	return n_errors;
+}
+}
+}
+
+#endif /* COUNT_ERRORS_H_ */
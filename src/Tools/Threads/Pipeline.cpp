@@ -0,0 +1,203 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Pipeline.hpp"
+
+using namespace aff3ct::tools;
+
+static size_t compute_n_tokens(const std::vector<size_t> &n_replicas, const size_t queue_size)
+{
+	size_t n_tokens = 0;
+	for (auto n : n_replicas)
+		n_tokens += n;
+	if (!n_replicas.empty())
+		n_tokens += (n_replicas.size() -1) * queue_size;
+	return n_tokens;
+}
+
+Pipeline
+::Pipeline(const std::vector<size_t> &n_replicas, const size_t queue_size)
+: n_replicas(n_replicas),
+  queue_size(queue_size),
+  n_tokens(compute_n_tokens(n_replicas, queue_size)),
+  free_replicas(n_replicas.size()),
+  queues(n_replicas.size()),
+  blocked(n_replicas.size()),
+  feeding(false)
+{
+	if (n_replicas.size() == 0)
+	{
+		std::stringstream message;
+		message << "'n_replicas.size()' has to be greater than 0 ('n_replicas.size()' = " << n_replicas.size() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t s = 0; s < n_replicas.size(); s++)
+		if (n_replicas[s] == 0)
+		{
+			std::stringstream message;
+			message << "'n_replicas[s]' has to be greater than 0 ('s' = " << s << ", 'n_replicas[s]' = "
+			        << n_replicas[s] << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	if (queue_size == 0)
+	{
+		std::stringstream message;
+		message << "'queue_size' has to be greater than 0 ('queue_size' = " << queue_size << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Pipeline
+::~Pipeline()
+{
+}
+
+size_t Pipeline
+::get_n_stages() const
+{
+	return n_replicas.size();
+}
+
+size_t Pipeline
+::get_n_tokens() const
+{
+	return n_tokens;
+}
+
+void Pipeline
+::run(Work_stealing_pool &pool, admit_t admit, exec_t exec)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_sched);
+
+		this->admit = admit;
+		this->exec  = exec;
+
+		free_tokens.clear();
+		for (size_t t = 0; t < n_tokens; t++)
+			free_tokens.push_back(t);
+
+		for (size_t s = 0; s < n_replicas.size(); s++)
+		{
+			free_replicas[s].clear();
+			for (size_t r = n_replicas[s]; r > 0; r--)
+				free_replicas[s].push_back(r -1);
+			queues [s].clear();
+			blocked[s].clear();
+		}
+
+		feeding         = true;
+		first_exception = nullptr;
+
+		this->dispatch(pool);
+	}
+
+	pool.wait();
+
+	if (first_exception)
+		std::rethrow_exception(first_exception);
+}
+
+void Pipeline
+::dispatch(Work_stealing_pool &pool)
+{
+	const auto n_stages = n_replicas.size();
+
+	auto progress = true;
+	while (progress)
+	{
+		progress = false;
+
+		// from the last stage to the first one: the downstream stages have the priority to drain the pipeline
+		for (auto s = n_stages; s > 0; s--)
+		{
+			const auto stage = s -1;
+
+			// move the blocked tokens in the next queue when there is some room
+			if (stage < n_stages -1)
+				while (!blocked[stage].empty() && queues[stage +1].size() < queue_size)
+				{
+					const auto rt = blocked[stage].front();
+					blocked[stage].pop_front();
+					queues[stage +1].push_back(rt.second);
+					free_replicas[stage].push_back(rt.first);
+					progress = true;
+				}
+
+			while (!free_replicas[stage].empty())
+			{
+				size_t token;
+				if (stage == 0)
+				{
+					if (!feeding || free_tokens.empty())
+						break;
+
+					if (!this->admit())
+					{
+						feeding = false;
+						break;
+					}
+
+					token = free_tokens.front();
+					free_tokens.pop_front();
+				}
+				else
+				{
+					if (queues[stage].empty())
+						break;
+
+					token = queues[stage].front();
+					queues[stage].pop_front();
+				}
+
+				const auto replica = free_replicas[stage].back();
+				free_replicas[stage].pop_back();
+
+				pool.submit([this, &pool, stage, replica, token]()
+				{
+					this->job(pool, stage, replica, token);
+				});
+				progress = true;
+			}
+		}
+	}
+}
+
+void Pipeline
+::job(Work_stealing_pool &pool, const size_t stage, const size_t replica, const size_t token)
+{
+	auto failed = false;
+	try
+	{
+		this->exec(stage, replica, token);
+	}
+	catch (...)
+	{
+		failed = true;
+
+		std::lock_guard<std::mutex> lock(mutex_sched);
+		if (!first_exception)
+			first_exception = std::current_exception();
+		feeding = false;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_sched);
+
+	if (failed || stage == n_replicas.size() -1)
+	{
+		free_tokens.push_back(token);
+		free_replicas[stage].push_back(replica);
+	}
+	else if (blocked[stage].empty() && queues[stage +1].size() < queue_size)
+	{
+		queues[stage +1].push_back(token);
+		free_replicas[stage].push_back(replica);
+	}
+	else
+		blocked[stage].push_back(std::make_pair(replica, token));
+
+	this->dispatch(pool);
+}
@@ -0,0 +1,88 @@
+/*!
+ * \file
+ * \brief Schedules the stages of a processing chain on a Work_stealing_pool with bounded queues between the stages.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PIPELINE_HPP
+#define PIPELINE_HPP
+
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <functional>
+
+#include "Work_stealing_pool.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Pipeline
+ *
+ * \brief Schedules the stages of a processing chain on a Work_stealing_pool with bounded queues between the stages.
+ *
+ * A stage is executed by one of its replicas: a stage with n replicas can process up to n tokens at the same time
+ * and one replica never processes two tokens at the same time. A token (typically a set of frame buffers) enters the
+ * first stage, goes through all the stages in order and is recycled when the last stage is done. When the input queue
+ * of a stage is full, the replica of the previous stage keeps its token until there is some room (back-pressure).
+ */
+class Pipeline
+{
+public:
+	using admit_t = std::function<bool(void)>;
+	using exec_t  = std::function<void(const size_t stage, const size_t replica, const size_t token)>;
+
+private:
+	const std::vector<size_t> n_replicas;
+	const size_t              queue_size;
+	const size_t              n_tokens;
+
+	std::mutex mutex_sched;
+
+	std::vector<std::vector<size_t>>                     free_replicas;
+	std::deque<size_t>                                   free_tokens;
+	std::vector<std::deque<size_t>>                      queues;  // input queue of each stage
+	std::vector<std::deque<std::pair<size_t,size_t>>>    blocked; // (replica, token) done but not yet enqueued
+	bool                                                 feeding;
+	std::exception_ptr                                   first_exception;
+
+	admit_t admit;
+	exec_t  exec;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param n_replicas: number of replicas for each stage (the size of this vector gives the number of stages).
+	 * \param queue_size: maximal number of tokens waiting in the input queue of each stage.
+	 */
+	Pipeline(const std::vector<size_t> &n_replicas, const size_t queue_size);
+
+	virtual ~Pipeline();
+
+	size_t get_n_stages() const;
+	size_t get_n_tokens() const;
+
+	/*!
+	 * \brief Blocking method, runs the pipeline until 'admit' returns false and all the admitted tokens are done.
+	 *
+	 * \param pool:  the pool of threads which executes the stages.
+	 * \param admit: called before a new token enters the first stage, the pipeline stops to admit new tokens as soon
+	 *               as it returns false.
+	 * \param exec:  executes a stage of a replica on a token.
+	 */
+	void run(Work_stealing_pool &pool, admit_t admit, exec_t exec);
+
+private:
+	void dispatch(Work_stealing_pool &pool);
+	void job     (Work_stealing_pool &pool, const size_t stage, const size_t replica, const size_t token);
+};
+}
+}
+
+#endif /* PIPELINE_HPP */
@@ -0,0 +1,163 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Work_stealing_pool.hpp"
+
+using namespace aff3ct::tools;
+
+// the pool and the id of the current worker thread (if the current thread is a worker thread)
+static thread_local const Work_stealing_pool* tl_pool = nullptr;
+static thread_local size_t                    tl_tid  = 0;
+
+Work_stealing_pool
+::Work_stealing_pool(const size_t n_threads)
+: n_threads(n_threads), n_pending(0), n_queued(0), next_deque(0), is_stopped(false)
+{
+	if (n_threads == 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t t = 0; t < n_threads; t++)
+		deques.push_back(new Worker_deque());
+
+	for (size_t t = 0; t < n_threads; t++)
+		threads.push_back(std::thread(&Work_stealing_pool::worker_loop, this, t));
+}
+
+Work_stealing_pool
+::~Work_stealing_pool()
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex_sleep);
+		cond_done.wait(lock, [this](){ return this->n_pending == 0; });
+		is_stopped = true;
+	}
+	cond_sleep.notify_all();
+
+	for (auto &t : threads)
+		t.join();
+
+	for (auto *d : deques)
+		delete d;
+}
+
+size_t Work_stealing_pool
+::get_n_threads() const
+{
+	return n_threads;
+}
+
+void Work_stealing_pool
+::submit(job_t job)
+{
+	// a worker pushes in its own deque, an external thread dispatches the jobs in a round-robin way
+	const auto d = (tl_pool == this) ? tl_tid : (next_deque++ % n_threads);
+
+	// the job is counted as pending before it can be executed (and finished) by a worker, but it is counted as queued
+	// only once it is in the deque: a worker woken up by 'n_queued' always finds it
+	n_pending++;
+	{
+		std::lock_guard<std::mutex> lock(deques[d]->mutex);
+		deques[d]->jobs.push_back(std::move(job));
+		n_queued++;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_sleep);
+	}
+	cond_sleep.notify_one();
+}
+
+void Work_stealing_pool
+::wait()
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex_sleep);
+		cond_done.wait(lock, [this](){ return this->n_pending == 0; });
+	}
+
+	if (first_exception)
+	{
+		auto e = first_exception;
+		first_exception = nullptr;
+		std::rethrow_exception(e);
+	}
+}
+
+bool Work_stealing_pool
+::pop(const size_t tid, job_t &job)
+{
+	std::lock_guard<std::mutex> lock(deques[tid]->mutex);
+	if (deques[tid]->jobs.empty())
+		return false;
+
+	job = std::move(deques[tid]->jobs.back());
+	deques[tid]->jobs.pop_back();
+	n_queued--;
+	return true;
+}
+
+bool Work_stealing_pool
+::steal(const size_t tid, job_t &job)
+{
+	for (size_t i = 1; i < n_threads; i++)
+	{
+		auto &victim = *deques[(tid + i) % n_threads];
+
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.jobs.empty())
+		{
+			job = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			n_queued--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Work_stealing_pool
+::worker_loop(const size_t tid)
+{
+	tl_pool = this;
+	tl_tid  = tid;
+
+	while (true)
+	{
+		job_t job;
+		if (this->pop(tid, job) || this->steal(tid, job))
+		{
+			try
+			{
+				job();
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(mutex_sleep);
+				if (!first_exception)
+					first_exception = std::current_exception();
+			}
+
+			if (--n_pending == 0)
+			{
+				std::lock_guard<std::mutex> lock(mutex_sleep);
+				cond_done.notify_all();
+			}
+		}
+		else
+		{
+			std::unique_lock<std::mutex> lock(mutex_sleep);
+			cond_sleep.wait(lock, [this](){ return this->is_stopped || this->n_queued > 0; });
+
+			if (is_stopped && n_queued == 0)
+				break;
+		}
+	}
+
+	tl_pool = nullptr;
+}
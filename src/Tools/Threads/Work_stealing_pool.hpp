@@ -0,0 +1,98 @@
+/*!
+ * \file
+ * \brief Pool of threads where each thread owns a deque of jobs and steals the jobs of the others when it is idle.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Work_stealing_pool
+ *
+ * \brief Pool of threads where each thread owns a deque of jobs and steals the jobs of the others when it is idle.
+ *
+ * A job submitted from a worker is pushed at the back of the deque of this worker and the worker pops its own jobs
+ * from the back (LIFO, good for the data locality). An idle worker steals the jobs from the front of the deques of
+ * the other workers (FIFO).
+ */
+class Work_stealing_pool
+{
+public:
+	using job_t = std::function<void(void)>;
+
+private:
+	struct Worker_deque
+	{
+		std::mutex        mutex;
+		std::deque<job_t> jobs;
+	};
+
+	const size_t n_threads;
+
+	std::vector<Worker_deque*> deques;
+	std::vector<std::thread>   threads;
+
+	std::mutex              mutex_sleep;
+	std::condition_variable cond_sleep;
+	std::condition_variable cond_done;
+
+	std::atomic<size_t> n_pending; // number of jobs submitted but not finished yet
+	std::atomic<size_t> n_queued;  // number of jobs waiting in the deques
+	std::atomic<size_t> next_deque;
+	bool                is_stopped;
+
+	std::exception_ptr first_exception;
+
+public:
+	/*!
+	 * \brief Constructor, starts the worker threads.
+	 *
+	 * \param n_threads: number of worker threads.
+	 */
+	explicit Work_stealing_pool(const size_t n_threads);
+
+	/*!
+	 * \brief Destructor, waits the end of the submitted jobs and joins the worker threads.
+	 */
+	~Work_stealing_pool();
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Submits a job.
+	 *
+	 * \param job: the job to execute.
+	 */
+	void submit(job_t job);
+
+	/*!
+	 * \brief Blocking method, waits until all the submitted jobs (and the jobs they submitted) are done.
+	 *
+	 * Rethrows the first exception raised by a job (if any).
+	 */
+	void wait();
+
+private:
+	void worker_loop(const size_t tid);
+	bool pop         (const size_t tid, job_t &job);
+	bool steal       (const size_t tid, job_t &job);
+};
+}
+}
+
+#endif /* WORK_STEALING_POOL_HPP */